@@ -0,0 +1,97 @@
+//============================================================================
+//                                  I B E X
+// File        : propag.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Propagation throughput.
+ *
+ * Calls HC4 (CtcHC4) on a set of sub-boxes of the initial box
+ * of a system and reports the number of contractions per second
+ * and the number of heap allocations per contraction.
+ *
+ * Example: ./propag ../benchs/benchs-satisfaction/benchlib2/kolev36.bch 100000
+ */
+
+static long nb_alloc=0;
+
+void* operator new(size_t size) {
+	nb_alloc++;
+	void* p=malloc(size);
+	if (!p) throw bad_alloc();
+	return p;
+}
+
+void* operator new[](size_t size) {
+	nb_alloc++;
+	void* p=malloc(size);
+	if (!p) throw bad_alloc();
+	return p;
+}
+
+void operator delete(void* p) throw() {
+	free(p);
+}
+
+void operator delete[](void* p) throw() {
+	free(p);
+}
+
+int main(int argc, char** argv) {
+
+	if (argc<2) {
+		cerr << "usage: propag filename [nb_contractions]" << endl;
+		exit(1);
+	}
+
+	System sys(argv[1]);
+
+	int n=argc>2 ? atoi(argv[2]) : 100000;
+
+	CtcHC4 hc4(sys);
+
+	// sub-boxes obtained by halving some domains
+	const int NB_BOXES=64;
+	vector<IntervalVector> boxes;
+	srand(1);
+	for (int k=0; k<NB_BOXES; k++) {
+		IntervalVector box(sys.box);
+		for (int i=0; i<box.size(); i++) {
+			if (box[i].is_unbounded()) box[i]=Interval(-1e3,1e3);
+			switch(rand()%3) {
+			case 0: box[i]=box[i].bisect(0.5).first;  break;
+			case 1: box[i]=box[i].bisect(0.5).second; break;
+			}
+		}
+		boxes.push_back(box);
+	}
+
+	IntervalVector box(sys.box);
+
+	long alloc0=nb_alloc;
+	Timer::start();
+
+	for (int k=0; k<n; k++) {
+		box=boxes[k%NB_BOXES];
+		hc4.contract(box);
+	}
+
+	Timer::stop();
+
+	cout << argv[1] << ": " << n/Timer::VIRTUAL_TIMELAPSE() << " contractions/s, "
+		 << double(nb_alloc-alloc0)/n << " allocations/contraction" << endl;
+
+	return 0;
+}
@@ -5,11 +5,13 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Oct 31, 2013
-// Last Update : Oct 31, 2013
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearRelaxFixed.h"
+#include "ibex_JacobianCache.h"
+#include "ibex_Cell.h"
 
 using namespace std;
 
@@ -48,12 +50,17 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 	// is it necessary?  YES (BNE) Soplex can give false infeasible results with large numbers
 	//cout << "[polytope-hull] box before LR (linear relaxation): " << box << endl;
 
+	// the relaxation can store the derivatives in the cell
+	if (cell() && cell()->has<JacobianCache>())
+		lr.jacobian_cache=&cell()->get<JacobianCache>();
+
 	try {
 		// Update the bounds the variables
 		mylinearsolver->initBoundVar(box);
 
 		//returns the number of constraints in the linearized system
 		int cont = lr.linearization(box, *mylinearsolver);
+		lr.jacobian_cache=NULL;
 
 		//cout << "[polytope-hull] end of LR" << endl;
 
@@ -69,12 +76,17 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 		mylinearsolver->cleanConst();
 	}
 	catch(LPException&) {
+		lr.jacobian_cache=NULL;
 		mylinearsolver->cleanConst();
 	}
 	catch(PolytopeHullEmptyBoxException& e) {
 		box.set_empty(); // empty the box before exiting
 		mylinearsolver->cleanConst();
 	}
+	catch(...) {
+		lr.jacobian_cache=NULL;
+		throw;
+	}
 
 }
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Oct 30, 2013
-// Last Update : Oct 30, 2013
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_LinearRelax.h"
@@ -13,14 +13,14 @@
 
 namespace ibex {
 
-LinearRelax::LinearRelax(const System& sys) : _nb_ctr(sys.nb_ctr), _nb_var(sys.nb_var), _goal_var(-1)/* by default */ {
+LinearRelax::LinearRelax(const System& sys) : jacobian_cache(NULL), _nb_ctr(sys.nb_ctr), _nb_var(sys.nb_var), _goal_var(-1)/* by default */ {
 	if (dynamic_cast<const ExtendedSystem*>(&sys)) {
 		_goal_var=((const ExtendedSystem&) sys).goal_var();
 	}
 
 }
 
-LinearRelax::LinearRelax(int nb_ctr, int nb_var, int goal_var) : _nb_ctr(nb_ctr), _nb_var(nb_var), _goal_var(goal_var) {
+LinearRelax::LinearRelax(int nb_ctr, int nb_var, int goal_var) : jacobian_cache(NULL), _nb_ctr(nb_ctr), _nb_var(nb_var), _goal_var(goal_var) {
 
 }
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Oct 30, 2013
-// Last Update : Oct 30, 2013
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_LINEAR_RELAXATION_H__
@@ -16,6 +16,8 @@
 
 namespace ibex {
 
+class JacobianCache;
+
 /**
  * \brief Linear relaxation
  *
@@ -85,6 +87,15 @@ public:
 	 */
 	int goal_var() const;
 
+	/**
+	 * \brief Derivatives of the current cell (NULL if none).
+	 *
+	 * Set by #ibex::CtcPolytopeHull during the linearization, when it is called with a cell
+	 * that contains a #ibex::JacobianCache. A relaxation that computes the Jacobian
+	 * matrix of the system can store it there.
+	 */
+	JacobianCache* jacobian_cache;
+
 private:
 	int _nb_ctr;
 	int _nb_var;
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jul 1, 2012
-// Last Update : Nov 15, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_LinearRelaxCombo.h"
@@ -164,6 +164,8 @@ int LinearRelaxCombo::linearization(const IntervalVector& box, LinearSolver& lp_
 
 	int cont = 0;
 
+	if (myxnewton) myxnewton->jacobian_cache=jacobian_cache;
+
 	switch (lmode) {
 	case XNEWTON:
 	case TAYLOR:
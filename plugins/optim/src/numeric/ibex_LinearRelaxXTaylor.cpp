@@ -5,13 +5,14 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jul 1, 2012
-// Last Update : Jul 02, 2013 (Gilles Chabert)
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_LinearRelaxXTaylor.h"
 #include "ibex_ExtendedSystem.h"
 #include "ibex_ExprDiff.h"
 #include "ibex_Random.h"
+#include "ibex_JacobianCache.h"
 
 using namespace std;
 
@@ -222,6 +223,11 @@ int LinearRelaxXTaylor::linearization(const IntervalVector& box, LinearSolver& l
 
 	int cont =0;
 
+	// in Taylor mode, the gradients of all the constraints give the
+	// Jacobian matrix of the system, which is stored in the cell
+	IntervalMatrix* J = (lmode==TAYLOR && jacobian_cache && sys.f.image_dim()==sys.nb_ctr) ?
+			new IntervalMatrix(sys.nb_ctr, sys.nb_var) : NULL;
+
 	// Create the linear relaxation of each constraint
 	for(int ctr=0; ctr<sys.nb_ctr; ctr++) {
 		//cout << "[LinearRelaxXTaylor] ctr n°" << ctr << endl;
@@ -229,6 +235,7 @@ int LinearRelaxXTaylor::linearization(const IntervalVector& box, LinearSolver& l
 
 		if(lmode==TAYLOR) {                 // derivatives are computed once (Taylor)
 			sys.ctrs[ctr].f.gradient(box,G);
+			if (J) J->set_row(ctr,G);
 		}
 		else {
 			// to set all the constant derivatives that have been already computed
@@ -246,9 +253,15 @@ int LinearRelaxXTaylor::linearization(const IntervalVector& box, LinearSolver& l
 					cont += X_Linearization(box, ctr, cpoints[k],  G, k, nb_nonlinear_vars,lp_solver);
 			}
 		} catch(LinearRelaxXTaylorUnsatisfiability&) {
+			if (J) delete J;
 			return -1;
 		}
 	}
+
+	if (J) {
+		jacobian_cache->store(sys.f, box, *J);
+		delete J;
+	}
 	return cont;
 }
 
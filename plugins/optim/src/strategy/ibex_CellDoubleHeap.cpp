@@ -0,0 +1,241 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDoubleHeap.cpp
+// Author      : Gilles Chabert, Jordan Ninin
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Sep 12, 2014
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_CellDoubleHeap.h"
+
+#include <sstream>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+CellDoubleHeap::CellDoubleHeap(CellCostFunc& cost1, CellCostFunc& cost2, int critpr) :
+		DoubleHeap<Cell>(cost1,cost1.depends_on_loup,cost2,cost2.depends_on_loup, critpr),
+		mem_capacity(0), on_disk(0), loup(POS_INFINITY) { }
+
+CellDoubleHeap::~CellDoubleHeap() {
+	flush();
+	for (vector<Backtrackable*>::iterator it=prototypes.begin(); it!=prototypes.end(); it++)
+		delete *it;
+}
+
+void CellDoubleHeap::flush() {
+	DoubleHeap<Cell>::flush();
+	while (!batches.empty()) drop(batches.size()-1);
+	file.clear();
+}
+
+unsigned int CellDoubleHeap::size() const {
+	return DoubleHeap<Cell>::size()+on_disk;
+}
+
+bool CellDoubleHeap::empty() const {
+	return size()==0;
+}
+
+void CellDoubleHeap::push(Cell* cell) {
+	DoubleHeap<Cell>::push(cell);
+	if (mem_capacity>0 && DoubleHeap<Cell>::size()>mem_capacity) spill();
+}
+
+Cell* CellDoubleHeap::pop() {
+	load_next(current_heap_id);
+	return DoubleHeap<Cell>::pop();
+}
+
+Cell* CellDoubleHeap::pop1() {
+	load_next(0);
+	return DoubleHeap<Cell>::pop1();
+}
+
+Cell* CellDoubleHeap::pop2() {
+	load_next(1);
+	return DoubleHeap<Cell>::pop2();
+}
+
+Cell* CellDoubleHeap::top() const {
+	if (batches.empty()) return DoubleHeap<Cell>::top();
+
+	// select the heap as in DoubleHeap::top()
+	if (RNG::rand() % 100 >= static_cast<unsigned>(critpr))
+		return top1();
+	else
+		return top2();
+}
+
+Cell* CellDoubleHeap::top1() const {
+	load_next(0);
+	return DoubleHeap<Cell>::top1();
+}
+
+Cell* CellDoubleHeap::top2() const {
+	load_next(1);
+	return DoubleHeap<Cell>::top2();
+}
+
+double CellDoubleHeap::minimum() const {
+	return minimum1();
+}
+
+double CellDoubleHeap::minimum1() const {
+	double m=DoubleHeap<Cell>::empty() ? POS_INFINITY : heap1->minimum();
+	for (vector<Batch>::const_iterator it=batches.begin(); it!=batches.end(); it++)
+		if (it->min1<m) m=it->min1;
+	return m;
+}
+
+double CellDoubleHeap::minimum2() const {
+	double m=DoubleHeap<Cell>::empty() ? POS_INFINITY : heap2->minimum();
+	for (vector<Batch>::const_iterator it=batches.begin(); it!=batches.end(); it++)
+		if (it->min2<m) m=it->min2;
+	return m;
+}
+
+std::ostream& CellDoubleHeap::print(std::ostream& os) const {
+	os << "==============================================================================\n";
+	if (DoubleHeap<Cell>::empty()) {
+		os << " (no cell in memory) ";
+	} else {
+		os << " first heap " << " size " << heap1->size() << " top " << heap1->top()->box << std::endl;
+		os << " second heap " << " size " << heap2->size() << " top " << heap2->top()->box ;
+	}
+	if (on_disk>0) os << std::endl << " on disk " << on_disk;
+	return  os << std::endl;
+}
+
+void CellDoubleHeap::contract(double new_loup) {
+
+	// DoubleHeap::contract requires the costs of
+	// the first heap to be up-to-date.
+	if (cost1().depends_on_loup) {
+		cost1().set_loup(new_loup);
+		heap1->sort();
+	}
+
+	cost2().set_loup(new_loup);
+	DoubleHeap<Cell>::contract(new_loup);
+
+	loup=new_loup;
+
+	// the batches that contain cells to be removed are read back
+	// (the cells are removed when they are read)
+	for (int i=batches.size()-1; i>=0; i--) {
+		if (batches[i].min1>loup) drop(i);
+		else if (batches[i].max1>loup) load_batch(i);
+	}
+}
+
+void CellDoubleHeap::spill() {
+	if (cost1().depends_on_loup)
+		ibex_error("CellDoubleHeap: cannot spill cells with a first cost depending on the loup");
+
+	vector<Cell*> cells;
+	vector<double> crit1, crit2;
+	pop_coldest(DoubleHeap<Cell>::size()/2, cells, crit1, crit2);
+
+	ostringstream os;
+	bool serialized=true;
+	for (unsigned int i=0; i<cells.size(); i++) {
+		serialized &= cells[i]->serialize(os,prototypes);
+		delete cells[i];
+	}
+
+	Batch b;
+	b.block=file.write(os.str());
+	b.nb_cells=cells.size();
+	b.detached=!serialized;
+	b.min1=*min_element(crit1.begin(),crit1.end());
+	b.max1=*max_element(crit1.begin(),crit1.end());
+	b.min2=*min_element(crit2.begin(),crit2.end());
+	batches.push_back(b);
+	on_disk+=b.nb_cells;
+}
+
+void CellDoubleHeap::load_batch(int i) const {
+	CellDoubleHeap& heap=const_cast<CellDoubleHeap&>(*this);
+
+	Batch b=batches[i];
+	batches.erase(batches.begin()+i);
+
+	string bytes;
+	file.read(b.block,bytes);
+	file.erase(b.block);
+	on_disk-=b.nb_cells;
+
+	// the costs are calculated again
+	istringstream is(bytes);
+	for (unsigned int k=0; k<b.nb_cells; k++) {
+		Cell* c=Cell::deserialize(is,prototypes);
+		if (heap.cost1().cost(*c)>loup)
+			delete c;
+		else
+			heap.DoubleHeap<Cell>::push(c);
+		// note: the memory capacity may be exceeded until the next push
+	}
+}
+
+void CellDoubleHeap::load_next(int heap_id) const {
+	while (!batches.empty()) {
+		// the batch with the smallest cost
+		int best=0;
+		for (unsigned int i=1; i<batches.size(); i++)
+			if ((heap_id==0 ? batches[i].min1<batches[best].min1 : batches[i].min2<batches[best].min2))
+				best=i;
+
+		double m=heap_id==0 ? batches[best].min1 : batches[best].min2;
+		if (DoubleHeap<Cell>::empty() || m<(heap_id==0 ? heap1->minimum() : heap2->minimum()))
+			load_batch(best);
+		else
+			break;
+	}
+}
+
+void CellDoubleHeap::drop(int i) {
+	// the cells are read back to delete the data kept in memory
+	string bytes;
+	file.read(batches[i].block,bytes);
+	istringstream is(bytes);
+	for (unsigned int k=0; k<batches[i].nb_cells; k++)
+		delete Cell::deserialize(is,prototypes);
+
+	file.erase(batches[i].block);
+	on_disk-=batches[i].nb_cells;
+	batches.erase(batches.begin()+i);
+}
+
+void CellDoubleHeap::save(std::ostream& os) {
+	for (vector<Batch>::iterator it=batches.begin(); it!=batches.end(); it++)
+		if (it->detached) ibex_error("CellDoubleHeap::save: data cannot be serialized");
+
+	// the cells in memory are popped and pushed back
+	vector<Cell*> cells;
+	while (!DoubleHeap<Cell>::empty())
+		cells.push_back(DoubleHeap<Cell>::pop1());
+
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		(*it)->add_prototypes(prototypes);
+
+	// same format as CellBuffer::save
+	unsigned int nb=size()+cells.size();
+	os.write((const char*) &nb, sizeof(nb));
+	Cell::serialize_classes(os,prototypes);
+
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		(*it)->serialize(os,prototypes,false);
+
+	for (vector<Batch>::iterator it=batches.begin(); it!=batches.end(); it++)
+		file.copy(it->block,os);
+
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		DoubleHeap<Cell>::push(*it);
+}
+
+} // namespace ibex
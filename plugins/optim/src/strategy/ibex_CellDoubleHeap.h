@@ -5,6 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Sep 12, 2014
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_CELL_DOUBLE_HEAP_H__
@@ -13,6 +14,7 @@
 #include "ibex_DoubleHeap.h"
 #include "ibex_CellCostFunc.h"
 #include "ibex_CellBuffer.h"
+#include "ibex_SpillFile.h"
 
 namespace ibex {
 
@@ -21,6 +23,9 @@ namespace ibex {
  *
  * See "A new multi-selection technique in interval methods for global optimization", L.G. Casado, Computing, 2000
  * (TODO: check ref)
+ *
+ * The number of cells in memory can be bounded (see #mem_capacity). The other
+ * cells are written to a temporary file, as in #ibex::CellFileBuffer.
  */
 class CellDoubleHeap : public DoubleHeap<Cell>, public CellBuffer {
 
@@ -39,6 +44,11 @@ public:
 	 */
 	CellDoubleHeap(CellCostFunc& cost1, CellCostFunc& cost2, int critpr=50);
 
+	/**
+	 * \brief Delete *this (and the remaining cells).
+	 */
+	~CellDoubleHeap();
+
 	/**
 	 * \brief Flush the buffer.
 	 *
@@ -58,9 +68,29 @@ public:
 	/** \brief Pop a cell from the stack and return it.*/
 	Cell* pop();
 
+	/** \brief Pop a cell from the first heap and return it.*/
+	Cell* pop1();
+
+	/** \brief Pop a cell from the second heap and return it.*/
+	Cell* pop2();
+
 	/** \brief Return the next box (but does not pop it).*/
 	Cell* top() const;
 
+	/** \brief Return the next box of the first heap (but does not pop it).*/
+	Cell* top1() const;
+
+	/** \brief Return the next box of the second heap (but does not pop it).*/
+	Cell* top2() const;
+
+	/** \brief Return the minimum (the criterion for the first heap). */
+	double minimum() const;
+
+	/** \brief Return the first minimum (the criterion for the first heap). */
+	double minimum1() const;
+
+	/** \brief Return the second minimum (the criterion for the second heap). */
+	double minimum2() const;
 
 	std::ostream& print(std::ostream& os) const;
 
@@ -83,51 +113,82 @@ public:
 	 * \brief Cost function of the second heap
 	 */
 	CellCostFunc& cost2();
-};
 
-/*================================== inline implementations ========================================*/
+	/** \brief Return the number of cells on disk. */
+	unsigned int nb_cells_on_disk() const;
 
-inline CellDoubleHeap::CellDoubleHeap(CellCostFunc& cost1, CellCostFunc& cost2, int critpr) :
-		DoubleHeap<Cell>(cost1,cost1.depends_on_loup,cost2,cost2.depends_on_loup, critpr) { }
+	/**
+	 * \brief Write the cells in a binary stream.
+	 *
+	 * The cells on disk are copied from the temporary file, without
+	 * being read back. The cells can be read by #ibex::CellBuffer::load().
+	 */
+	void save(std::ostream& os);
 
-inline void CellDoubleHeap::flush()               { DoubleHeap<Cell>::flush(); }
+	/**
+	 * \brief The maximal number of cells in memory.
+	 *
+	 * Beyond this number, the half of the cells in memory that would be
+	 * popped last from both heaps is written to a temporary file in one batch.
+	 * A batch is read back as soon as it may contain the next cell of
+	 * the selected heap, or when the heap is contracted below the cost of
+	 * one of its cells. The box and the backtrackable data are written to
+	 * the file, see #ibex::CellFileBuffer.
+	 *
+	 * Cells can only be written to the file if the first cost does not
+	 * depend on the loup. If the second cost does, the costs of the cells
+	 * on disk are updated when they are read back: until then, a batch may
+	 * be read back too early or too late (which only changes the order
+	 * of the cells).
+	 *
+	 * The value can be fixed by the user. By default: 0 (no limit).
+	 */
+	unsigned int mem_capacity;
 
-inline unsigned int CellDoubleHeap::size() const  { return DoubleHeap<Cell>::size(); }
+private:
+	/* A batch of cells in the file. */
+	struct Batch {
+		int block;             // block of the file
+		unsigned int nb_cells;
+		bool detached;         // true if data of the cells is kept in memory
+		double min1, max1;     // bounds of the first costs
+		double min2;           // minimum of the second costs (when written)
+	};
 
-inline bool CellDoubleHeap::empty() const         { return DoubleHeap<Cell>::empty(); }
+	/* Write the coldest half of the cells in memory. */
+	void spill();
 
-inline void CellDoubleHeap::push(Cell* cell)      { DoubleHeap<Cell>::push(cell); }
+	/* Read the batch and remove it from the list. */
+	void load_batch(int b) const;
 
-inline Cell* CellDoubleHeap::pop()                { return DoubleHeap<Cell>::pop(); }
+	/* Read the batches that may contain the next cell of a heap. */
+	void load_next(int heap_id) const;
 
-inline Cell* CellDoubleHeap::top() const          { return DoubleHeap<Cell>::top(); }
+	/* Delete the cells of the batch and remove it from the list. */
+	void drop(int b);
 
- inline std::ostream& CellDoubleHeap::print(std::ostream& os) const
- {	os << "==============================================================================\n";
-   os << " first heap " << " size " << heap1->size() << " top " << heap1->top()->box << std::endl;
-     os << " second heap " << " size " << heap2->size() << " top " << heap2->top()->box ;
-     return  os << std::endl;
- }
+	/* Cells on disk */
+	mutable std::vector<Batch> batches;
 
- //{return DoubleHeap<Cell>::print( os);}
+	mutable unsigned int on_disk;
 
-inline void CellDoubleHeap::contract(double new_loup) {
+	/* The temporary file */
+	mutable SpillFile file;
 
-	// DoubleHeap::contract requires the costs of
-	// the first heap to be up-to-date.
-	if (cost1().depends_on_loup) {
-		cost1().set_loup(new_loup);
-		heap1->sort();
-	}
+	/* Prototypes of the backtrackable data (see Cell::deserialize) */
+	mutable std::vector<Backtrackable*> prototypes;
 
-	cost2().set_loup(new_loup);
-	DoubleHeap<Cell>::contract(new_loup);
-}
+	/* Cells read back with a greater first cost are deleted */
+	double loup;
+};
+
+/*================================== inline implementations ========================================*/
 
 inline CellCostFunc& CellDoubleHeap::cost1()      { return (CellCostFunc&) heap1->costf; }
 
 inline CellCostFunc& CellDoubleHeap::cost2()      { return (CellCostFunc&) heap2->costf; }
 
+inline unsigned int CellDoubleHeap::nb_cells_on_disk() const { return on_disk; }
 
 } // namespace ibex
 
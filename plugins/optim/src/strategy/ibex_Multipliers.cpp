@@ -41,6 +41,24 @@ std::pair<Backtrackable*,Backtrackable*> Multipliers::down() {
 	return std::pair<Backtrackable*,Backtrackable*>(new Multipliers(*this),new Multipliers(*this));
 }
 
+bool Multipliers::serialize(std::ostream& os) const {
+	int n=lambda.size();
+	os.write((const char*) &n, sizeof(n));
+	for (int i=0; i<n; i++)
+		os.write((const char*) &lambda[i], sizeof(Interval));
+	return true;
+}
+
+Backtrackable* Multipliers::deserialize(std::istream& is) const {
+	Multipliers* m=new Multipliers();
+	int n;
+	is.read((char*) &n, sizeof(n));
+	m->lambda.resize(n);
+	for (int i=0; i<n; i++)
+		is.read((char*) &m->lambda[i], sizeof(Interval));
+	return m;
+}
+
 Multipliers::~Multipliers() {
 
 }
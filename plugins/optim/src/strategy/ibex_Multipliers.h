@@ -53,6 +53,16 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Write the multipliers.
+	 */
+	bool serialize(std::ostream& os) const;
+
+	/**
+	 * \brief Read the multipliers.
+	 */
+	Backtrackable* deserialize(std::istream& is) const;
+
 	IntervalVector lambda;
 protected:
 
@@ -22,6 +22,19 @@ std::pair<Backtrackable*,Backtrackable*> OptimData::down() {
 	return std::pair<Backtrackable*,Backtrackable*>(new OptimData(*this),new OptimData(*this));
 }
 
+bool OptimData::serialize(std::ostream& os) const {
+	os.write((const char*) &pf, sizeof(pf));
+	os.write((const char*) &pu, sizeof(pu));
+	return true;
+}
+
+Backtrackable* OptimData::deserialize(std::istream& is) const {
+	OptimData* d=new OptimData();
+	is.read((char*) &d->pf, sizeof(pf));
+	is.read((char*) &d->pu, sizeof(pu));
+	return d;
+}
+
 OptimData::~OptimData() {
 
 }
@@ -38,6 +38,16 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Write pf and pu.
+	 */
+	bool serialize(std::ostream& os) const;
+
+	/**
+	 * \brief Read pf and pu.
+	 */
+	Backtrackable* deserialize(std::istream& is) const;
+
 	/**
 	 * \brief Initialize the value of "pf"
 	 *
@@ -4,7 +4,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : December 24, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Optimizer.h"
@@ -27,6 +27,9 @@
 
 #include <float.h>
 #include <stdlib.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 
 using namespace std;
 
@@ -39,6 +42,40 @@ const int    Optimizer::default_sample_size = 10;
 const double Optimizer::default_equ_eps = 1e-08;
 const double Optimizer::default_loup_tolerance = 0.1;
 
+namespace {
+
+// first bytes of a checkpoint file
+const char magic[]="IBEX-OPTIMIZER-1";
+
+template<typename T>
+void write(ostream& os, const T& x) {
+	os.write((const char*) &x, sizeof(T));
+}
+
+template<typename T>
+void read(istream& is, T& x) {
+	is.read((char*) &x, sizeof(T));
+}
+
+template<typename V>
+void write_vector(ostream& os, const V& x) {
+	int n=x.size();
+	write(os,n);
+	for (int i=0; i<n; i++)
+		write(os,x[i]);
+}
+
+template<typename V>
+void read_vector(istream& is, V& x) {
+	int n;
+	read(is,n);
+	x.resize(n);
+	for (int i=0; i<n; i++)
+		read(is,x[i]);
+}
+
+}
+
 void Optimizer::write_ext_box(const IntervalVector& box, IntervalVector& ext_box) {
 	int i2=0;
 	for (int i=0; i<n; i++,i2++) {
@@ -65,10 +102,10 @@ Optimizer::Optimizer(System& user_sys, Ctc& ctc, Bsc& bsc, double prec,
                 				buffer(*new CellCostVarLB(n), *CellCostFunc::get_cost(crit2, n), critpr),  // first buffer with LB, second buffer with ct (default UB))
                 				prec(prec), goal_rel_prec(goal_rel_prec), goal_abs_prec(goal_abs_prec),
                 				sample_size(sample_size), mono_analysis_flag(true), in_HC4_flag(true), trace(false),
-                				timeout(1e08),
+                				timeout(1e08), checkpoint_interval(600),
                 				loup(POS_INFINITY), pseudo_loup(POS_INFINITY),uplo(NEG_INFINITY),
                 				loup_point(n), loup_box(n), nb_cells(0),
-                				df(NULL), loup_changed(false),	initial_loup(POS_INFINITY), rigor(rigor),
+                				df(NULL), loup_changed(false),	initial_loup(POS_INFINITY), initial_box(n), last_checkpoint(0), rigor(rigor),
                 				uplo_of_epsboxes(POS_INFINITY) {
 
 
@@ -318,13 +355,12 @@ void Optimizer::contract_and_bound(Cell& c, const IntervalVector& init_box) {
 	//cout << " [contract]  x before=" << c.box << endl;
 	//cout << " [contract]  y before=" << y << endl;
 
-	ctc.contract(c.box);
+	ctc.contract(c);
 
 	if (c.box.is_empty()) return;
 
 	//cout << " [contract]  x after=" << c.box << endl;
 	//cout << " [contract]  y after=" << y << endl;
-	// TODO: no more cell in argument here (just a box). Does it matter?
 	/*====================================================================*/
 
 	/*========================= update loup =============================*/
@@ -418,6 +454,28 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 
 	buffer.flush();
 
+	Cell* root=root_cell(init_box);
+
+	for (vector<CtcProfiler*>::iterator it=profilers.begin(); it!=profilers.end(); it++)
+		(*it)->reset();
+
+	entailed=&root->get<EntailedCtr>();
+
+	loup_changed=false;
+	initial_loup=obj_init_bound;
+	initial_box=init_box;
+	loup_point=init_box.mid();
+	time=0;
+	last_checkpoint=0;
+	Timer::start();
+	handle_cell(*root,init_box);
+
+	update_uplo();
+
+	return search(init_box);
+}
+
+Cell* Optimizer::root_cell(const IntervalVector& init_box) {
 	Cell* root=new Cell(IntervalVector(n+1));
 
 	write_ext_box(init_box,root->box);
@@ -428,21 +486,18 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 	// add data "pu" and "pf" (if required)
 	buffer.cost2().add_backtrackable(*root);
 
+	// add data required by the contractor
+	ctc.add_backtrackable(*root);
+
 	// add data required by optimizer + Fritz John contractor
 	root->add<EntailedCtr>();
 	//root->add<Multipliers>();
-	entailed=&root->get<EntailedCtr>();
-	entailed->init_root(user_sys,sys);
+	root->get<EntailedCtr>().init_root(user_sys,sys);
 
-	loup_changed=false;
-	initial_loup=obj_init_bound;
-	loup_point=init_box.mid();
-	time=0;
-	Timer::start();
-	handle_cell(*root,init_box);
-
-	update_uplo();
+	return root;
+}
 
+Optimizer::Status Optimizer::search(const IntervalVector& init_box) {
 	try {
 		while (!buffer.empty()) {
 		  //			if (trace >= 2) cout << " buffer " << buffer << endl;
@@ -454,15 +509,13 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 			Cell *c = buffer.top();
 
 			try {
-				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
-
-				pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+				vector<Cell*> new_cells=bsc.split(*c);
 
 				buffer.pop();
 				delete c; // deletes the cell.
 
-				handle_cell(*new_cells.first, init_box);
-				handle_cell(*new_cells.second, init_box);
+				for (vector<Cell*>::iterator it=new_cells.begin(); it!=new_cells.end(); it++)
+					handle_cell(**it, init_box);
 
 				if (uplo_of_epsboxes == NEG_INFINITY) {
 					cout << " possible infinite minimum " << endl;
@@ -490,6 +543,10 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 				update_uplo();
 				time_limit_check();
 
+				if (!checkpoint_file.empty() && time-last_checkpoint>=checkpoint_interval) {
+					checkpoint(checkpoint_file.c_str());
+					last_checkpoint=time;
+				}
 			}
 			catch (NoBisectableVariableException& ) {
 				update_uplo_of_epsboxes((c->box)[ext_sys.goal_var()].lb());
@@ -502,6 +559,7 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 		}
 	}
 	catch (TimeOutException& ) {
+		if (!checkpoint_file.empty()) checkpoint(checkpoint_file.c_str());
 		return TIME_OUT;
 	}
 
@@ -518,6 +576,85 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 		return SUCCESS;
 }
 
+Optimizer::Status Optimizer::resume(const char* filename) {
+	ifstream is(filename, ios::in | ios::binary);
+	if (!is) ibex_error("Optimizer: cannot open checkpoint file");
+
+	char mg[sizeof(magic)];
+	is.read(mg,sizeof(magic));
+	if (!is || strncmp(mg,magic,sizeof(magic))!=0) ibex_error("Optimizer: not a checkpoint file");
+
+	int n2;
+	read(is,n2);
+	if (n2!=n) ibex_error("Optimizer: checkpoint of a different problem");
+
+	read_vector(is,initial_box);
+	read(is,initial_loup);
+	read(is,loup);
+	read(is,pseudo_loup);
+	read(is,uplo);
+	read(is,uplo_of_epsboxes);
+	read_vector(is,loup_point);
+	read_vector(is,loup_box);
+
+	read(is,nb_cells);
+	read(is,time);
+	read(is,nb_simplex);
+	read(is,diam_simplex);
+	read(is,nb_rand);
+	read(is,diam_rand);
+
+	buffer.flush();
+
+	// the costs of the cells depend on the loup
+	buffer.contract(loup);
+
+	// the root cell gives the prototypes of the data
+	Cell* root=root_cell(initial_box);
+	buffer.load(is,*root);
+	delete root;
+
+	for (vector<CtcProfiler*>::iterator it=profilers.begin(); it!=profilers.end(); it++)
+		(*it)->reset();
+
+	loup_changed=false;
+	last_checkpoint=time;
+	Timer::start();
+
+	return search(initial_box);
+}
+
+void Optimizer::checkpoint(const char* filename) {
+	string tmp=string(filename)+".tmp";
+	{
+		ofstream os(tmp.c_str(), ios::out | ios::binary | ios::trunc);
+		if (!os) ibex_error("Optimizer: cannot write checkpoint file");
+
+		os.write(magic,sizeof(magic));
+		write(os,n);
+		write_vector(os,initial_box);
+		write(os,initial_loup);
+		write(os,loup);
+		write(os,pseudo_loup);
+		write(os,uplo);
+		write(os,uplo_of_epsboxes);
+		write_vector(os,loup_point);
+		write_vector(os,loup_box);
+
+		write(os,nb_cells);
+		write(os,time);
+		write(os,nb_simplex);
+		write(os,diam_simplex);
+		write(os,nb_rand);
+		write(os,diam_rand);
+
+		buffer.save(os);
+
+		if (!os) ibex_error("Optimizer: cannot write checkpoint file");
+	}
+	if (std::rename(tmp.c_str(),filename)!=0) ibex_error("Optimizer: cannot write checkpoint file");
+}
+
 void Optimizer::update_uplo_of_epsboxes(double ymin) {
 
 	// the current box cannot be bisected.  ymin is a lower bound of the objective on this box
@@ -578,6 +715,11 @@ void Optimizer::report() {
 		cout << " cpu time used " << time << "s." << endl;
 		cout << " number of cells " << nb_cells << endl;
 	}
+
+	if (!profilers.empty()) {
+		cout << endl;
+		report_profile();
+	}
 	/*   // statistics on upper bounding
     if (trace) {
       cout << " nbrand " << nb_rand << " nb_inhc4 " << nb_inhc4 << " nb simplex " << nb_simplex << endl;
@@ -585,6 +727,14 @@ void Optimizer::report() {
     }
 	 */
 }
+
+void Optimizer::report_profile(ostream& os, bool json) const {
+	if (json)
+		CtcProfiler::print_json(os,profilers);
+	else
+		CtcProfiler::print_table(os,profilers);
+}
+
 /* minimal report for benchmarking */
 void Optimizer::time_cells_report() {
 	if (timeout >0 &&  time >=timeout ) {
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : May 14, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_OPTIMIZER_H__
@@ -15,6 +15,7 @@
 #include "ibex_CtcHC4.h"
 #include "ibex_Ctc3BCid.h"
 #include "ibex_CtcUnion.h"
+#include "ibex_CtcProfiler.h"
 #include "ibex_Backtrackable.h"
 #include "ibex_CellCostFunc.h"
 #include "ibex_CellDoubleHeap.h"
@@ -26,6 +27,8 @@
 #include "ibex_Random.h"
 #include "ibex_LinearRelaxCombo.h"
 
+#include <string>
+
 namespace ibex {
 
 /**
@@ -109,6 +112,33 @@ public:
 	 */
 	Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
 
+	/**
+	 * \brief Resume an optimization from a checkpoint.
+	 *
+	 * \param filename - a file written by #checkpoint().
+	 *
+	 * The optimizer must be built with the same system, contractor and bisector as
+	 * the one that wrote the checkpoint (possibly in another process). The optimization
+	 * continues with the buffer, the loup, the loup point and the number of cells
+	 * of the checkpoint. The return status is the same as in #optimize().
+	 *
+	 * The running time includes the time spent before the checkpoint:
+	 * #timeout must be increased to resume an optimization that timed out.
+	 */
+	Status resume(const char* filename);
+
+	/**
+	 * \brief Write a checkpoint.
+	 *
+	 * Write the pending cells, the bounds of the objective (loup and uplo),
+	 * the loup point, the initial box and the statistics in a binary file,
+	 * for #resume(). Can be called after #optimize() has returned TIME_OUT.
+	 *
+	 * The file is written under a temporary name, then renamed: a
+	 * previous checkpoint is not lost if the process is killed meanwhile.
+	 */
+	void checkpoint(const char* filename);
+
 	/**
 	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&).
 	 *
@@ -117,6 +147,7 @@ public:
 	 *     <li> the best feasible point found
 	 *     <li>total running time
 	 *     <li>total number of cells created during the exploration
+	 *     <li>the statistics of the profilers (if any, see #profilers)
 	 * </ul>
 	 */
 	void report();
@@ -143,6 +174,14 @@ public:
 	 */
 	void report_perf();
 
+	/**
+	 * \brief Print the statistics of the profilers.
+	 *
+	 * \param json - if true, the statistics are printed in JSON
+	 *               (see #ibex::CtcProfiler::print_json), otherwise as a table.
+	 */
+	void report_profile(std::ostream& os=std::cout, bool json=false) const;
+
 	/**
 	 * \brief The original system
 	 *
@@ -196,6 +235,8 @@ public:
 	Two buffers are used for node selection. the first one corresponds to minimize  the minimum of the objective estimate,
 	the second one to minimize another criterion (by default the maximum of the objective estimate).
 	The second one is chosen at each node with a probability critpr/100 (default value critpr=50)
+	The number of cells in memory can be bounded with buffer.mem_capacity (the other cells
+	are written to a temporary file, see #ibex::CellDoubleHeap::mem_capacity).
 	 */
 	CellDoubleHeap buffer;
 
@@ -231,6 +272,15 @@ public:
 	  2 for printing each handled node */
 	int trace;
 
+	/**
+	 * \brief Profilers.
+	 *
+	 * The profilers wrapping the contractors of the pipeline #ctc
+	 * (see #ibex::CtcProfiler). They are reset when an optimization starts.
+	 * Empty by default.
+	 */
+	std::vector<CtcProfiler*> profilers;
+
 	/**
 	 * \brief Time limit.
 	 *
@@ -243,6 +293,18 @@ public:
 	/* Remember running time of the last exploration */
 	double time;
 
+	/**
+	 * \brief Checkpoint file.
+	 *
+	 * If not empty, a checkpoint (see #checkpoint()) is written in this file
+	 * every #checkpoint_interval seconds and when the time limit is reached.
+	 * Empty by default.
+	 */
+	std::string checkpoint_file;
+
+	/** CPU time (in seconds) between two checkpoints. By default: 600. */
+	double checkpoint_interval;
+
 	void time_limit_check();
 
 	/** Default bisection precision: 1e-07 */
@@ -320,6 +382,16 @@ protected:
 	 */
 	void handle_cell(Cell& c, const IntervalVector& init_box);
 
+	/**
+	 * \brief Create the root cell with the data required by the optimizer.
+	 */
+	Cell* root_cell(const IntervalVector& init_box);
+
+	/**
+	 * \brief Main loop: process the cells of the buffer.
+	 */
+	Status search(const IntervalVector& init_box);
+
 	/**
 	 * \brief Contract and bound procedure for processing a box.
 	 *
@@ -528,6 +600,16 @@ protected:
 	 */
 	double initial_loup;
 
+	/**
+	 * \brief The initial box of the last optimization (for checkpoints).
+	 */
+	IntervalVector initial_box;
+
+	/**
+	 * \brief Time of the last checkpoint.
+	 */
+	double last_checkpoint;
+
 	Ctc3BCid* objshaver;
 	
 private:
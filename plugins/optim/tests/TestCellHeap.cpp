@@ -13,6 +13,10 @@
 #include "ibex_OptimData.h"
 #include "ibex_CellDoubleHeap.h"
 
+#include <set>
+#include <cstdlib>
+#include <sstream>
+
 using namespace std;
 
 namespace ibex {
@@ -296,4 +300,122 @@ void TestCellHeap::test_D05() {
 
 
 
+void TestCellHeap::test_D06() {
+
+	srand(1);
+	CellCostVarLB cost_lb(0);
+	CellCostC5 cost_c5;
+	CellDoubleHeap h1(cost_lb,cost_c5,50);
+	h1.mem_capacity=8;
+	h1.contract(1000);
+
+	multiset<int> ref;
+	bool spilled=false;
+	for (int k=0; k<2000; k++) {
+		if (ref.empty() || rand()%3!=0) {
+			int x=rand()%1000;
+			Cell* cell = new Cell(IntervalVector(2,Interval(x,x+1)));
+			cell->add<OptimData>();
+			cell->get<OptimData>().pu=0.2;
+			cell->get<OptimData>().pf=Interval(x,x+rand()%100);
+			h1.push(cell);
+			ref.insert(x);
+		} else {
+			CPPUNIT_ASSERT(h1.minimum()==*ref.begin());
+			Cell* c;
+			if (rand()%2==0) {
+				// the first heap gives the minimum
+				c=h1.pop1();
+				CPPUNIT_ASSERT(c->box[0].lb()==*ref.begin());
+			} else {
+				// as in the optimizer
+				c=h1.top();
+				CPPUNIT_ASSERT(h1.pop()==c);
+			}
+			CPPUNIT_ASSERT(c->get<OptimData>().pu==0.2);
+			multiset<int>::iterator it=ref.find((int) c->box[0].lb());
+			CPPUNIT_ASSERT(it!=ref.end());
+			ref.erase(it);
+			delete c;
+		}
+		spilled |= h1.nb_cells_on_disk()>0;
+		CPPUNIT_ASSERT(h1.size()==ref.size());
+	}
+	CPPUNIT_ASSERT(spilled);
+	h1.flush();
+	CPPUNIT_ASSERT(h1.empty());
+}
+
+void TestCellHeap::test_D07() {
+
+	CellCostVarLB cost_lb(0);
+	CellCostC5 cost_c5;
+	CellDoubleHeap h1(cost_lb,cost_c5,50);
+	h1.mem_capacity=8;
+	h1.contract(1000);
+
+	for (int i=0; i<100; i++) {
+		int x=(i*37)%100;
+		Cell* cell = new Cell(IntervalVector(2,Interval(x,x+1)));
+		cell->add<OptimData>();
+		cell->get<OptimData>().pu=0.2;
+		cell->get<OptimData>().pf=Interval(x,x+1);
+		h1.push(cell);
+	}
+	CPPUNIT_ASSERT(h1.nb_cells_on_disk()>0);
+
+	h1.contract(49.5);
+	CPPUNIT_ASSERT(h1.size()==50);
+	CPPUNIT_ASSERT(h1.minimum()==0);
+
+	for (int i=0; i<50; i++) {
+		Cell* c=h1.pop2();
+		CPPUNIT_ASSERT(c->box[0].lb()<50);
+		delete c;
+	}
+	CPPUNIT_ASSERT(h1.empty());
+}
+
+void TestCellHeap::test_D08() {
+
+	CellCostVarLB cost_lb(0);
+	CellCostC5 cost_c5;
+	CellDoubleHeap h1(cost_lb,cost_c5,50);
+	h1.mem_capacity=8;
+	h1.contract(1000);
+
+	for (int i=0; i<100; i++) {
+		int x=(i*37)%100;
+		Cell* cell = new Cell(IntervalVector(2,Interval(x,x+1)));
+		cell->add<OptimData>();
+		cell->get<OptimData>().pu=0.2;
+		cell->get<OptimData>().pf=Interval(x,x+1);
+		h1.push(cell);
+	}
+	unsigned int on_disk=h1.nb_cells_on_disk();
+	CPPUNIT_ASSERT(on_disk>0);
+
+	stringstream ss;
+	h1.save(ss);
+	CPPUNIT_ASSERT(h1.size()==100);
+	CPPUNIT_ASSERT(h1.nb_cells_on_disk()==on_disk);
+
+	Cell root(IntervalVector(2));
+	root.add<OptimData>();
+	CellDoubleHeap h2(cost_lb,cost_c5,50);
+	h2.contract(1000);
+	h2.load(ss,root);
+	CPPUNIT_ASSERT(h2.size()==100);
+
+	for (int x=0; x<100; x++) {
+		Cell* c=h1.pop1();
+		Cell* c2=h2.pop1();
+		CPPUNIT_ASSERT(c->box==IntervalVector(2,Interval(x,x+1)));
+		CPPUNIT_ASSERT(c2->box==c->box);
+		CPPUNIT_ASSERT(c2->get<OptimData>().pf==c->get<OptimData>().pf);
+		delete c;
+		delete c2;
+	}
+}
+
 } // end namespace
@@ -35,6 +35,9 @@ public:
 		CPPUNIT_TEST(test_D03);
 		CPPUNIT_TEST(test_D04);
 		CPPUNIT_TEST(test_D05);
+		CPPUNIT_TEST(test_D06);
+		CPPUNIT_TEST(test_D07);
+		CPPUNIT_TEST(test_D08);
 	CPPUNIT_TEST_SUITE_END();
 
 
@@ -48,6 +51,12 @@ public:
 	void test_D03();
 	void test_D04();
 	void test_D05();
+	// pop from a double heap with cells on disk
+	void test_D06();
+	// contract a double heap with cells on disk
+	void test_D07();
+	// save a double heap with cells on disk
+	void test_D08();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCellHeap);
@@ -14,6 +14,8 @@
 #include "ibex_DefaultOptimizer.h"
 #include "ibex_SystemFactory.h"
 
+#include <cstdio>
+
 using namespace std;
 
 namespace ibex {
@@ -49,5 +51,55 @@ void TestOptimizer::issue50_4() {
 	CPPUNIT_ASSERT(issue50(-1e-10, 0)==Optimizer::INFEASIBLE);
 }
 
+// minimum is 0.5, at (0.5,0.5).
+void TestOptimizer::checkpoint01() {
+	const char* filename="checkpoint_optimizer.tmp";
+
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(x+y>=1);
+	f.add_goal(sqr(x)+sqr(y));
+	System sys(f);
+
+	IntervalVector init_box(2,Interval(-10,10));
+
+	DefaultOptimizer o(sys,1e-07,1e-07);
+	o.timeout=1e-9;
+	o.checkpoint_file=filename;
+	CPPUNIT_ASSERT(o.optimize(init_box)==Optimizer::TIME_OUT);
+
+	DefaultOptimizer o2(sys,1e-07,1e-07);
+	CPPUNIT_ASSERT(o2.resume(filename)==Optimizer::SUCCESS);
+	remove(filename);
+
+	CPPUNIT_ASSERT(o2.nb_cells>o.nb_cells);
+	CPPUNIT_ASSERT(fabs(o2.loup-0.5)<1e-06);
+	CPPUNIT_ASSERT(o2.uplo<=0.5 && o2.uplo>0.5-1e-06);
+}
+
+// minimum is 0.5, at (0.5,0.5).
+void TestOptimizer::spill01() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(x+y>=1);
+	f.add_goal(sqr(x)+sqr(y));
+	System sys(f);
+
+	IntervalVector init_box(2,Interval(-10,10));
+
+	DefaultOptimizer o(sys,1e-07,1e-07);
+	o.buffer.mem_capacity=2;
+	CPPUNIT_ASSERT(o.optimize(init_box)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.buffer.empty());
+
+	CPPUNIT_ASSERT(fabs(o.loup-0.5)<1e-06);
+	CPPUNIT_ASSERT(o.uplo<=0.5 && o.uplo>0.5-1e-06);
+}
 
 } // end namespace
@@ -29,6 +29,8 @@ public:
 		CPPUNIT_TEST(issue50_2);
 		CPPUNIT_TEST(issue50_3);
 		CPPUNIT_TEST(issue50_4);
+		CPPUNIT_TEST(checkpoint01);
+		CPPUNIT_TEST(spill01);
 	CPPUNIT_TEST_SUITE_END();
 
 	// upperbounding with goal_prec=10% will remove everything (initial loup > true minimum) --> NO_FEASIBLE_FOUND
@@ -39,6 +41,10 @@ public:
 	void issue50_3();
 	// upperbounding with goal_prec=0 will make the optimizer fail (initial loup < true minimum) --> INFEASIBLE
 	void issue50_4();
+	// time out with a checkpoint, then resume --> SUCCESS
+	void checkpoint01();
+	// with at most 2 cells in memory --> SUCCESS
+	void spill01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestOptimizer);
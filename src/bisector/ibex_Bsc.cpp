@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 8, 2012
-// Last Update : May 8, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Bsc.h"
@@ -34,6 +34,15 @@ pair<IntervalVector,IntervalVector> Bsc::bisect(Cell& cell) {
 	return bisect(cell.box);
 }
 
+std::vector<Cell*> Bsc::split(Cell& cell) {
+	pair<IntervalVector,IntervalVector> boxes=bisect(cell);
+	pair<Cell*,Cell*> cells=cell.bisect(std::move(boxes.first),std::move(boxes.second));
+	std::vector<Cell*> res(2);
+	res[0]=cells.first;
+	res[1]=cells.second;
+	return res;
+}
+
 void Bsc::add_backtrackable(Cell& root) {
 	root.add<BisectedVar>();
 }
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 8, 2012
-// Last Update : May 8, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_BISECTOR_H__
@@ -85,6 +85,16 @@ public:
 	 */
 	virtual std::pair<IntervalVector,IntervalVector> bisect(Cell& cell);
 
+	/**
+	 * \brief Split the current cell into subcells.
+	 *
+	 * This is the function called by the strategies (solver, paver, optimizer).
+	 * By default, the cell is bisected with #bisect(Cell&), which gives two subcells.
+	 * A bisector can override this function to produce more subcells
+	 * (see, e.g., #ibex::KSection).
+	 */
+	virtual std::vector<Cell*> split(Cell& cell);
+
 	/**
 	 * Allows to add the backtrackable data required
 	 * by this bisector to the root cell before a
@@ -140,6 +150,17 @@ public:
 		return std::pair<Backtrackable*,Backtrackable*>(new BisectedVar(var),new BisectedVar(var));
 	}
 
+	bool serialize(std::ostream& os) const {
+		os.write((const char*) &var, sizeof(var));
+		return true;
+	}
+
+	Backtrackable* deserialize(std::istream& is) const {
+		BisectedVar* b=new BisectedVar();
+		is.read((char*) &b->var, sizeof(var));
+		return b;
+	}
+
 	int var;
 };
 
@@ -0,0 +1,123 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_KSection.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_KSection.h"
+#include "ibex_NoBisectableVariableException.h"
+#include "ibex_Exception.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// subcells of the cell for the boxes given by a bisector
+vector<Cell*> bisect_cell(Cell& cell, pair<IntervalVector,IntervalVector>& boxes) {
+	pair<Cell*,Cell*> cells=cell.bisect(std::move(boxes.first),std::move(boxes.second));
+	vector<Cell*> res(2);
+	res[0]=cells.first;
+	res[1]=cells.second;
+	return res;
+}
+
+}
+
+KSection::KSection(Bsc& bsc, int k) : Bsc(0), bsc(bsc), k(k) {
+	if (k<2) ibex_error("KSection: the number of slices must be at least 2");
+}
+
+pair<IntervalVector,IntervalVector> KSection::bisect(const IntervalVector& box) {
+	return bsc.bisect(box);
+}
+
+pair<IntervalVector,IntervalVector> KSection::bisect(Cell& cell) {
+	return bsc.bisect(cell);
+}
+
+vector<Cell*> KSection::split(Cell& cell) {
+	pair<IntervalVector,IntervalVector> boxes=bsc.bisect(cell);
+
+	// the variable chosen by the bisector
+	int n=cell.box.size();
+	int var=0;
+	while (var<n && boxes.first[var]==cell.box[var]) var++;
+
+	if (var==n) return bisect_cell(cell,boxes);
+
+	const Interval& x=cell.box[var];
+
+	if (x.is_unbounded()) return bisect_cell(cell,boxes);
+
+	// slices must not be smaller than the precision
+	int nb=k;
+	while (nb>2 && x.diam()/nb<bsc.prec(var)) nb--;
+
+	vector<double> pts(nb+1);
+	pts[0]=x.lb();
+	pts[nb]=x.ub();
+	for (int j=1; j<nb; j++) {
+		pts[j]=x.lb()+j*((x.ub()-x.lb())/nb);
+		// rounding may give slices reduced to a point
+		if (!(pts[j-1]<pts[j] && pts[j]<x.ub())) return bisect_cell(cell,boxes);
+	}
+
+	vector<IntervalVector> slices;
+	slices.reserve(nb);
+	// the storage of the two boxes of the bisector is reused
+	slices.push_back(std::move(boxes.first));
+	for (int j=1; j<nb-1; j++)
+		slices.push_back(cell.box);
+	slices.push_back(std::move(boxes.second));
+
+	for (int j=0; j<nb; j++)
+		slices[j][var]=Interval(pts[j],pts[j+1]);
+
+	return cell.split(std::move(slices));
+}
+
+void KSection::add_backtrackable(Cell& root) {
+	bsc.add_backtrackable(root);
+}
+
+MultiSection::MultiSection(Bsc& bsc, int depth) : Bsc(0), bsc(bsc), depth(depth) {
+	if (depth<1) ibex_error("MultiSection: the depth must be at least 1");
+}
+
+pair<IntervalVector,IntervalVector> MultiSection::bisect(const IntervalVector& box) {
+	return bsc.bisect(box);
+}
+
+pair<IntervalVector,IntervalVector> MultiSection::bisect(Cell& cell) {
+	return bsc.bisect(cell);
+}
+
+vector<Cell*> MultiSection::split(Cell& cell) {
+	vector<Cell*> cells=bsc.split(cell);
+
+	for (int l=1; l<depth; l++) {
+		vector<Cell*> next;
+		for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++) {
+			try {
+				vector<Cell*> sub=bsc.split(**it);
+				next.insert(next.end(),sub.begin(),sub.end());
+				delete *it;
+			} catch (NoBisectableVariableException&) {
+				next.push_back(*it);
+			}
+		}
+		cells.swap(next);
+	}
+	return cells;
+}
+
+void MultiSection::add_backtrackable(Cell& root) {
+	bsc.add_backtrackable(root);
+}
+
+} // end namespace ibex
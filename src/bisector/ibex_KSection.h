@@ -0,0 +1,130 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_KSection.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_KSECTION_H__
+#define __IBEX_KSECTION_H__
+
+#include "ibex_Bsc.h"
+
+namespace ibex {
+
+/**
+ * \ingroup bisector
+ *
+ * \brief K-section.
+ *
+ * The variable is chosen by another bisector (round-robin, smear function, etc.)
+ * but its domain is split in k slices of equal width, instead of two.
+ *
+ * Slices are never smaller than the precision of the other bisector:
+ * when the domain is too small for k slices, it is split in less slices.
+ * Unbounded domains are bisected as the other bisector does.
+ *
+ * Example: KSection ksc(smear,3) splits the variable with maximal smear in 3.
+ */
+class KSection : public Bsc {
+public:
+	/**
+	 * \brief Create a k-section.
+	 *
+	 * \param bsc - the bisector that chooses the variable (kept by reference).
+	 * \param k   - the number of slices (k>=2).
+	 */
+	KSection(Bsc& bsc, int k);
+
+	/**
+	 * \brief Bisect the box with the other bisector.
+	 */
+	virtual std::pair<IntervalVector,IntervalVector> bisect(const IntervalVector& box);
+
+	/**
+	 * \brief Bisect the cell with the other bisector.
+	 */
+	virtual std::pair<IntervalVector,IntervalVector> bisect(Cell& cell);
+
+	/**
+	 * \brief Split the cell in k subcells.
+	 */
+	virtual std::vector<Cell*> split(Cell& cell);
+
+	/**
+	 * \brief Add the backtrackable data required by the other bisector.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief The bisector that chooses the variable.
+	 */
+	Bsc& bsc;
+
+	/**
+	 * \brief Number of slices.
+	 */
+	const int k;
+};
+
+/**
+ * \ingroup bisector
+ *
+ * \brief Bisection of several variables at once.
+ *
+ * The cell is split by another bisector, then each subcell is split again,
+ * and so on, \a depth times. The intermediate subcells are not contracted:
+ * with depth=d, up to 2^d subcells are produced (more if the other bisector
+ * is a #ibex::KSection) and \a d variables are split at once. A subcell that
+ * cannot be split further is kept as is.
+ *
+ * The other bisector is applied to the intermediate subcells, so that its
+ * backtrackable data (e.g., the last bisected variable of #ibex::RoundRobin)
+ * is up to date.
+ */
+class MultiSection : public Bsc {
+public:
+	/**
+	 * \brief Create a multi-section.
+	 *
+	 * \param bsc   - the bisector applied to the cell and its subcells (kept by reference).
+	 * \param depth - the number of times the bisector is applied (depth>=1).
+	 */
+	MultiSection(Bsc& bsc, int depth);
+
+	/**
+	 * \brief Bisect the box with the other bisector.
+	 */
+	virtual std::pair<IntervalVector,IntervalVector> bisect(const IntervalVector& box);
+
+	/**
+	 * \brief Bisect the cell with the other bisector.
+	 */
+	virtual std::pair<IntervalVector,IntervalVector> bisect(Cell& cell);
+
+	/**
+	 * \brief Split the cell \a depth times.
+	 */
+	virtual std::vector<Cell*> split(Cell& cell);
+
+	/**
+	 * \brief Add the backtrackable data required by the other bisector.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief The bisector applied to the cell and its subcells.
+	 */
+	Bsc& bsc;
+
+	/**
+	 * \brief Number of times the bisector is applied.
+	 */
+	const int depth;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_KSECTION_H__
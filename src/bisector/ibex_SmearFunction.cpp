@@ -5,10 +5,11 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : July 19 2012
-// Last Update : July 19 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_SmearFunction.h"
+#include "ibex_JacobianCache.h"
 
 using std::pair;
 using namespace std;
@@ -16,10 +17,33 @@ using namespace std;
 namespace ibex {
 
 
+const double SmearFunction::default_reuse_ratio = 0.1;
+
 pair<IntervalVector,IntervalVector> SmearFunction::bisect(const IntervalVector& box, int& last_var) {
 	IntervalMatrix J(sys.nb_ctr, sys.nb_var);
 
 	sys.f.jacobian(box,J);
+
+	return bisect(box,last_var,J);
+}
+
+pair<IntervalVector,IntervalVector> SmearFunction::bisect(Cell& cell) {
+	BisectedVar& v=cell.get<BisectedVar>();
+
+	if (cell.has<JacobianCache>()) {
+		IntervalMatrix* J=cell.get<JacobianCache>().find(sys.f,cell.box,reuse_ratio,true);
+		if (J) return bisect(cell.box,v.var,*J);
+	}
+
+	return bisect(cell.box,v.var);
+}
+
+void SmearFunction::add_backtrackable(Cell& root) {
+	RoundRobin::add_backtrackable(root);
+	root.add<JacobianCache>();
+}
+
+pair<IntervalVector,IntervalVector> SmearFunction::bisect(const IntervalVector& box, int& last_var, IntervalMatrix& J) {
 	// in case of infinite derivatives  changing to roundrobin bisection
 	for (int i=0;i < sys.nb_ctr;i++)
 		for (int j=0;j < sys.nb_var;j++)
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : July 19, 2012
-// Last Update : July 19, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_SMEAR_FUNCTION_H__
@@ -59,6 +59,20 @@ public:
 	 */
 	virtual  std::pair<IntervalVector,IntervalVector> bisect(const IntervalVector& box, int& last_var);
 
+	/**
+	 * \brief Bisect the cell.
+	 *
+	 * If derivatives of the system have been stored in the cell by a contractor
+	 * (see #ibex::JacobianCache) for a box close enough to the current box
+	 * (see #reuse_ratio), they are used instead of computing the Jacobian matrix.
+	 */
+	virtual std::pair<IntervalVector,IntervalVector> bisect(Cell& cell);
+
+	/**
+	 * \brief Add the last bisected variable and the Jacobian cache to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/**
 	 * \brief Returns the variable to bisect.
 	 *
@@ -68,7 +82,28 @@ public:
 	 */
 	virtual int var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const=0;
 
+	/**
+	 * \brief Ratio for reusing derivatives stored in the cell.
+	 *
+	 * Derivatives computed on a box B are used for the current box x if
+	 * x is included in B and B.rel_distance(x)<=reuse_ratio. Hansen matrices
+	 * (stored by #ibex::CtcNewton) are accepted: they are used as an approximation
+	 * of the Jacobian matrix. A negative value means that the Jacobian matrix
+	 * is always computed.
+	 *
+	 * Default value is #default_reuse_ratio.
+	 */
+	double reuse_ratio;
+
+	/** Initialized to 0.1 */
+	static const double default_reuse_ratio;
+
 protected :
+	/**
+	 * \brief Bisect the box with the given Jacobian matrix.
+	 */
+	std::pair<IntervalVector,IntervalVector> bisect(const IntervalVector& box, int& last_var, IntervalMatrix& J);
+
 	int nbvars;
 	System& sys;
 };
@@ -227,11 +262,11 @@ public :
 
 /*============================================ inline implementation ============================================ */
 
-inline SmearFunction::SmearFunction(System& sys, double prec, double ratio) : RoundRobin(prec, ratio), sys(sys) {
+inline SmearFunction::SmearFunction(System& sys, double prec, double ratio) : RoundRobin(prec, ratio), reuse_ratio(default_reuse_ratio), sys(sys) {
 	nbvars=sys.nb_var;
 }
 
-inline SmearFunction::SmearFunction(System& sys, const Vector& prec, double ratio) : RoundRobin(prec, ratio), sys(sys) {
+inline SmearFunction::SmearFunction(System& sys, const Vector& prec, double ratio) : RoundRobin(prec, ratio), reuse_ratio(default_reuse_ratio), sys(sys) {
 	nbvars=sys.nb_var;
 }
 
@@ -5,16 +5,151 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 25, 2012
-// Last Update : Apr 25, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_QInter.h"
 #include <algorithm>
+#include <vector>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Sweeps on the bounds of p boxes of dimension n.
+ *
+ * The sweeps are nested, one for each dimension (in the order given by
+ * "dims"). The boxes involved in the sweep at level l are those j with
+ * mark[j]>=l. When the sweep at level l reaches a value c, the boxes
+ * that contain c are marked l+1 before the sweep at level l+1 starts.
+ */
+class QInterSweep {
+public:
+	QInterSweep(const Array<IntervalVector>& boxes, int q);
+
+	/* Return the lower bound of the q-intersection in dimension d,
+	 * or the upper bound if up==true (+oo/-oo if it is empty). */
+	double bound(int d, bool up);
+
+	/* Discard the boxes that do not intersect [x] in dimension d. */
+	void filter(int d, const Interval& x);
+
+private:
+	/* Sweep in dimension dims[l]. Return true if a point belongs to q
+	 * boxes with mark>=l, and set c to the value of this point in
+	 * dimension dims[l] (the first one met by the sweep). */
+	bool sweep(int l, bool up, double& c);
+
+	int n, p, q;
+	std::vector<std::vector<double> > lo, hi; // lo[i][j]: lower bound of box j in dimension i
+	std::vector<std::vector<int> > by_lo;     // by_lo[i]: boxes sorted by increasing lower bound in dimension i
+	std::vector<std::vector<int> > by_hi;     // by_hi[i]: boxes sorted by increasing upper bound in dimension i
+	std::vector<int> mark;
+	std::vector<int> dims;
+};
+
+struct BoundOrder {
+	BoundOrder(const std::vector<double>& x) : x(x) { }
+	bool operator()(int j1, int j2) const { return x[j1]<x[j2]; }
+	const std::vector<double>& x;
+};
+
+QInterSweep::QInterSweep(const Array<IntervalVector>& boxes, int q) :
+		n(boxes[0].size()), p(boxes.size()), q(q), lo(n,vector<double>(p)), hi(n,vector<double>(p)),
+		by_lo(n,vector<int>(p)), by_hi(n,vector<int>(p)), mark(p,0), dims(n) {
+
+	for (int i=0; i<n; i++) {
+		for (int j=0; j<p; j++) {
+			lo[i][j]=boxes[j][i].lb();
+			hi[i][j]=boxes[j][i].ub();
+			by_lo[i][j]=by_hi[i][j]=j;
+		}
+		sort(by_lo[i].begin(), by_lo[i].end(), BoundOrder(lo[i]));
+		sort(by_hi[i].begin(), by_hi[i].end(), BoundOrder(hi[i]));
+	}
+}
+
+double QInterSweep::bound(int d, bool up) {
+	for (int l=0; l<n; l++)
+		dims[l]=(d+l)%n;
+
+	double c;
+	if (sweep(0,up,c))
+		return c;
+	else
+		return up? NEG_INFINITY : POS_INFINITY;
+}
+
+void QInterSweep::filter(int d, const Interval& x) {
+	for (int j=0; j<p; j++)
+		if (hi[d][j]<x.lb() || lo[d][j]>x.ub()) mark[j]=-1;
+}
+
+bool QInterSweep::sweep(int l, bool up, double& c) {
+	int i=dims[l];
+	bool last=(l==n-1);
+
+	// A box "starts" at its lower bound and "ends" at its upper bound
+	// (the opposite if up==true, the sweep going downwards).
+	const vector<int>& start=up? by_hi[i] : by_lo[i];
+	const vector<int>& end=up? by_lo[i] : by_hi[i];
+	const vector<double>& start_val=up? hi[i] : lo[i];
+	const vector<double>& end_val=up? lo[i] : hi[i];
+
+	int k=0;      // next box to start
+	int e=0;      // next box to end
+	int count=0;  // number of boxes that contain c
+	bool found=false;
+
+	while (k<p) {
+		int j=start[up? p-1-k : k];
+		if (mark[j]<l) { k++; continue; }
+
+		c=start_val[j];
+
+		// remove the boxes that end before c
+		while (e<p) {
+			int j2=end[up? p-1-e : e];
+			if (mark[j2]>=l) {
+				if (up? end_val[j2]<=c : end_val[j2]>=c) break;
+				count--;
+				if (!last) mark[j2]=l;
+			}
+			e++;
+		}
+
+		// add the boxes that start at c
+		while (k<p) {
+			j=start[up? p-1-k : k];
+			if (mark[j]>=l) {
+				if (start_val[j]!=c) break;
+				count++;
+				if (!last) mark[j]=l+1;
+			}
+			k++;
+		}
+
+		if (count>=q) {
+			double c2;
+			if (last || sweep(l+1,false,c2)) {
+				found=true;
+				break;
+			}
+		}
+	}
+
+	if (!last)
+		for (int j=0; j<p; j++)
+			if (mark[j]==l+1) mark[j]=l;
+
+	return found;
+}
+
+} // end anonymous namespace
+
 IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 	assert(_boxes.size()>0);
 	int n=_boxes[0].size();
@@ -25,6 +160,45 @@ IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 		if (!_boxes[i].is_empty()) p++;
 	}
 
+	if (p==0 || p<q) return IntervalVector::empty(n);
+
+	Array<IntervalVector> boxes(p);
+	int j=0;
+	for (int i=0; i<_boxes.size(); i++) {
+		if (!_boxes[i].is_empty()) boxes.set_ref(j++,_boxes[i]);
+	}
+
+	// ================================================
+
+	QInterSweep s(boxes,q);
+
+	IntervalVector res(n);
+
+	for (int d=0; d<n; d++) {
+		double lb=s.bound(d,false);
+
+		if (lb==POS_INFINITY) return IntervalVector::empty(n);
+
+		res[d]=Interval(lb,s.bound(d,true));
+
+		// the boxes outside the hull cannot contain
+		// a point of the q-intersection
+		s.filter(d,res[d]);
+	}
+
+	return res;
+}
+
+IntervalVector qinter_grid(const Array<IntervalVector>& _boxes, int q) {
+	assert(_boxes.size()>0);
+	int n=_boxes[0].size();
+
+	// ====== remove the empty boxes from the list ====
+	int p=0; // count the number of non-empty boxes
+	for (int i=0; i<_boxes.size(); i++) {
+		if (!_boxes[i].is_empty()) p++;
+	}
+
 	if (p==0) return IntervalVector::empty(n);
 
 	Array<IntervalVector> boxes(p);
@@ -119,7 +293,8 @@ IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 			if (dim>=0) {
 				int i=(d+dim)%n;
 				ind[dim]++;
-				cell[i]=Interval(x[i][ind[dim]],x[i][ind[dim]+1]); // update cell
+				if (ind[dim]<size[i])                      // (otherwise, the sweep is over)
+					cell[i]=Interval(x[i][ind[dim]],x[i][ind[dim]+1]); // update cell
 			}
 		}
 
@@ -166,7 +341,8 @@ IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 			if (dim>=0) {
 				int i=(d+dim)%n;
 				ind[dim]--;
-				cell[i]=Interval(x[i][ind[dim]],x[i][ind[dim]+1]); // update cell
+				if (ind[dim]>=0)                           // (otherwise, the sweep is over)
+					cell[i]=Interval(x[i][ind[dim]],x[i][ind[dim]+1]); // update cell
 			}
 		}
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 25, 2012
-// Last Update : Apr 25, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_Q_INTER_H__
@@ -28,10 +28,37 @@ namespace ibex {
 
 /**
  * \ingroup combinatorial
- * \brief Q-intersection - EXACT - Grid algorithm
+ * \brief Q-intersection - EXACT - Sweep algorithm
+ *
+ * Return the hull of the points that belong to at least q boxes.
+ *
+ * For each dimension d, the bounds of the hull are found by sweeping the
+ * bounds of the boxes along d. At a candidate value c, the boxes that
+ * contain c (maintained incrementally) are tested for a common point of
+ * q boxes in the other dimensions, by a recursive sweep. The last
+ * dimension is a simple counting over the sorted bounds.
+ *
+ * The boxes are sorted once for each dimension, so that all the sweeps
+ * are linear. The complexity is O(n*p^n) for p boxes of dimension n
+ * (and O(n*p*log(p)) for n=1), instead of O(n^2*p^(n+1)) for #qinter_grid.
+ *
+ * The boxes are considered as closed sets: boxes that only touch each
+ * other have a (degenerated) intersection.
  */
 IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
 
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - EXACT - Grid algorithm
+ *
+ * Former implementation of #qinter: tests the center of each cell of
+ * the grid made by the bounds of the boxes.
+ *
+ * \note Boxes that only touch each other are considered as disjoint
+ * (unless all the bounds in a dimension coincide).
+ */
+IntervalVector qinter_grid(const Array<IntervalVector>& boxes, int q);
+
 } // end namespace ibex
 
 
@@ -12,6 +12,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_SepCtcPair.h"
 #include "ibex_CtcIdentity.h"
+#include "ibex_Cell.h"
 
 namespace ibex {
 
@@ -64,6 +65,56 @@ void Ctc::contract(IntervalVector& box, const BitSet& impact, BitSet& flags) {
 	_output_flags = NULL;
 }
 
+void Ctc::contract(Cell& cell) {
+	Cell* old_cell=_cell;
+	_cell=&cell;
+
+	try {
+		contract(cell.box);
+	}
+	catch (...) {
+		_cell=old_cell;
+		throw;
+	}
+
+	_cell=old_cell;
+}
+
+void Ctc::contract(Cell& cell, const BitSet& impact) {
+	Cell* old_cell=_cell;
+	_cell=&cell;
+
+	try {
+		contract(cell.box, impact);
+	}
+	catch (...) {
+		_cell=old_cell;
+		throw;
+	}
+
+	_cell=old_cell;
+}
+
+void Ctc::contract(Cell& cell, const BitSet& impact, BitSet& flags) {
+	Cell* old_cell=_cell;
+	_cell=&cell;
+
+	try {
+		contract(cell.box, impact, flags);
+	}
+	catch (...) {
+		_cell=old_cell;
+		throw;
+	}
+
+	_cell=old_cell;
+}
+
+void Ctc::contract_batch(IntervalVector* boxes, int n) {
+	for (int k=0; k<n; k++)
+		contract(boxes[k]);
+}
+
 bool Ctc::check_nb_var_ctc_list (const Array<Ctc>& l)  {
 	int i=1, n=l[0].nb_var;
 	while (i<l.size() && l[i].nb_var==n) {
@@ -19,6 +19,8 @@
 
 namespace ibex {
 
+class Cell;
+
 /**
  * \defgroup contractor Contractors
  */
@@ -80,6 +82,48 @@ public:
 	 */
 	void contract(IntervalVector& box, const BitSet& impact, BitSet& flags);
 
+	/**
+	 * \brief Contract the box of a cell.
+	 *
+	 * Same as #contract(IntervalVector&) on the box of the cell, except that
+	 * the contractor can read and update its backtrackable data in the cell
+	 * (see #add_backtrackable(Cell&) and #cell()).
+	 */
+	void contract(Cell& cell);
+
+	/**
+	 * \brief Contract the box of a cell with specified impact.
+	 *
+	 * \see #contract(Cell&) and #contract(IntervalVector&, const BitSet&).
+	 */
+	void contract(Cell& cell, const BitSet& impact);
+
+	/**
+	 * \brief Contract the box of a cell with specified impact and output flags.
+	 *
+	 * \see #contract(Cell&) and #contract(IntervalVector&, const BitSet&, BitSet&).
+	 */
+	void contract(Cell& cell, const BitSet& impact, BitSet& flags);
+
+	/**
+	 * \brief Add the backtrackable data required by this contractor to the root cell.
+	 *
+	 * Called by the strategy (solver, optimizer, etc.) before the search.
+	 * Does nothing by default. A contractor made of sub-contractors
+	 * must call this function for each of them.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Contract several boxes.
+	 *
+	 * Contract boxes[k] for k=0...n-1. By default, this function
+	 * simply calls contract(boxes[k]) for each box. Contractors
+	 * based on function evaluation can override it to process
+	 * all the boxes at once (see #ibex::Function::backward_batch).
+	 */
+	virtual void contract_batch(IntervalVector* boxes, int n);
+
 	/**
 	 * \brief The number of variables this contractor works with.
 	 */
@@ -130,6 +174,14 @@ protected:
 	 */
 	void set_flag(unsigned int);
 
+	/**
+	 * \brief Return the cell whose box is being contracted (NULL pointer if none).
+	 *
+	 * Not NULL only when the contraction is called with #contract(Cell&)
+	 * (or its variants).
+	 */
+	Cell* cell();
+
 protected:
 	/**
 	 * \brief Check if the size of all the contractor of the list is the same.
@@ -139,6 +191,7 @@ protected:
 private:
 	const BitSet* _impact;
 	BitSet* _output_flags;
+	Cell* _cell;
 
 
 };
@@ -150,9 +203,9 @@ private:
 
 
 
-inline Ctc::Ctc(int n) : nb_var(n), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL) { }
+inline Ctc::Ctc(int n) : nb_var(n), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL), _cell(NULL) { }
 
-inline Ctc::Ctc(const Array<Ctc>& l) : nb_var(l[0].nb_var), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL) { }
+inline Ctc::Ctc(const Array<Ctc>& l) : nb_var(l[0].nb_var), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL), _cell(NULL) { }
 
 inline Ctc::~Ctc() { }
 
@@ -165,6 +218,12 @@ inline void Ctc::set_flag(unsigned int f) {
 	if (_output_flags) _output_flags->add(f);
 }
 
+inline Cell* Ctc::cell() {
+	return _cell;
+}
+
+inline void Ctc::add_backtrackable(Cell& root) { }
+
 
 } // namespace ibex
 
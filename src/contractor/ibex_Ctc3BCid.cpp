@@ -11,6 +11,8 @@
 
 #include "ibex_Ctc3BCid.h"
 
+#include <typeinfo>
+
 using namespace std;
 namespace ibex {
 
@@ -19,10 +21,31 @@ const int Ctc3BCid::default_scid = 1;
 const double Ctc3BCid::default_var_min_width = 1.e-11;
 const int Ctc3BCid::LimitCIDDichotomy=16;
 
+/*
+ * Shaving of the variables of a round (one variable per thread).
+ */
+class Ctc3BCid::ShaveTask : public ThreadPool::Task {
+public:
+	ShaveTask(Ctc3BCid& c, const IntervalVector& box) : c(c), box(box) { }
+
+	void run(int i) {
+		Ctc3BCid& shaver=*c.shavers[i];
+		int var=c.round[i];
+
+		c.shaved[i]=box;
+		shaver.impact.add(var);
+		shaver.var3BCID(c.shaved[i],var);
+		shaver.impact.remove(var);
+	}
+
+	Ctc3BCid& c;
+	const IntervalVector& box;
+};
+
 Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
-							Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), s3b(s3b), scid(scid),
+							Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), nb_threads(1), s3b(s3b), scid(scid),
 							vhandled(vhandled<=0? cid_vars.size():vhandled),
-							var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)) {
+							var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)), round(nb_threads), pool(NULL) {
 	assert(ctc.nb_var>0);
 //	if (ctc.nb_var<=0)
 //		ibex_error("Ctc3BCID : the contractor is non-dimensional, Please specify the dimension with: \n Ctc3BCid(int nb_var, const BoolMask& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width);");
@@ -30,9 +53,9 @@ Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhan
 
 
 Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
-                    		Ctc(ctc.nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctc), s3b(s3b), scid(scid),
+                    		Ctc(ctc.nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctc), nb_threads(1), s3b(s3b), scid(scid),
                     		vhandled(vhandled<=0? nb_var : vhandled),
-                    		var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)) {
+                    		var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)), round(nb_threads), pool(NULL) {
 
 	assert(ctc.nb_var>0);
 //	if (ctc.nb_var<=0)
@@ -40,6 +63,54 @@ Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_wid
 }
 
 
+Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, const Array<Ctc>& ctcs, int s3b, int scid, int vhandled, double var_min_width) :
+							Ctc(ctcs[0].nb_var), cid_vars(cid_vars), ctc(ctcs[0]), nb_threads(ctcs.size()), s3b(s3b), scid(scid),
+							vhandled(vhandled<=0? cid_vars.size():vhandled),
+							var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)), round(nb_threads), pool(NULL) {
+	init_threads(ctcs);
+}
+
+Ctc3BCid::Ctc3BCid(const Array<Ctc>& ctcs, int s3b, int scid, int vhandled, double var_min_width) :
+							Ctc(ctcs[0].nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctcs[0]), nb_threads(ctcs.size()), s3b(s3b), scid(scid),
+							vhandled(vhandled<=0? nb_var : vhandled),
+							var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)), round(nb_threads), pool(NULL) {
+	init_threads(ctcs);
+}
+
+void Ctc3BCid::init_threads(const Array<Ctc>& ctcs) {
+	assert(ctc.nb_var>0);
+
+	if (nb_threads==1) return;
+
+	for (int i=1; i<nb_threads; i++) {
+		assert(ctcs[i].nb_var==nb_var);
+		thread_ctcs.push_back(&ctcs[i]);
+	}
+
+	shaved.resize(nb_threads, IntervalVector(nb_var));
+
+	pool=new ThreadPool(nb_threads);
+}
+
+Ctc3BCid* Ctc3BCid::shaver(Ctc& ctc) {
+	// the shaving of a subclass may be different
+	if (typeid(*this)!=typeid(Ctc3BCid))
+		ibex_error("Ctc3BCid: a subclass must override shaver() to shave with several threads");
+	return new Ctc3BCid(cid_vars, ctc, s3b, scid, 1, var_min_width);
+}
+
+void Ctc3BCid::init_shavers() {
+	shavers.push_back(this);
+	for (int i=1; i<nb_threads; i++)
+		shavers.push_back(shaver(*thread_ctcs[i-1]));
+}
+
+Ctc3BCid::~Ctc3BCid() {
+	for (unsigned int i=1; i<shavers.size(); i++)
+		delete shavers[i];
+	if (pool) delete pool;
+}
+
 int Ctc3BCid::limitCIDDichotomy ()  {
 	return LimitCIDDichotomy;
 }
@@ -55,18 +126,45 @@ bool Ctc3BCid::equalBoxes (int var, IntervalVector &box1, IntervalVector &box2)
 	return true;
 }
 
-void Ctc3BCid::contract(IntervalVector& box) {
-	int var;                                           // [gch] variable to be carCIDed
+int Ctc3BCid::round_size(int n) const {
+	if (pool==NULL) return 1;
+	if (n>nb_threads) n=nb_threads;
+	if (n>nb_var) n=nb_var;                            // a variable is shaved only once in a round
+	return n;
+}
 
+void Ctc3BCid::shave(IntervalVector& box, int n) {
+	if (n==1) {
+		impact.add(round[0]);                         // [gch]
+		var3BCID(box,round[0]);
+		impact.remove(round[0]);                      // [gch]
+		return;
+	}
+
+	// created here and not by the constructor, where the
+	// virtual function shaver() is not the one of a subclass
+	if (shavers.empty()) init_shavers();
+
+	ShaveTask task(*this, box);
+	pool->run(task, n);
+
+	// each shaved box contains all the solutions in box
+	for (int i=0; i<n; i++) {
+		box &= shaved[i];
+		if (box.is_empty()) return;
+	}
+}
+
+void Ctc3BCid::contract(IntervalVector& box) {
 	start_var=nb_var-1;                                //  patch pour l'optim  A RETIRER ??
 	impact.clear();                                    // [gch]
-	for (int k=0; k<vhandled; k++) {                   // [gch] k counts the number of varCIDed variables [gch]
+	for (int k=0, n; k<vhandled; k+=n) {              // [gch] k counts the number of varCIDed variables [gch]
 
-		var=(start_var+k)%nb_var;
+		n=round_size(vhandled-k);
+		for (int i=0; i<n; i++)
+			round[i]=(start_var+k+i)%nb_var;          // [gch] variables to be carCIDed
 
-		impact.add(var);                              // [gch]
-		var3BCID(box,var);
-		impact.remove(var);                           // [gch]
+		shave(box,n);
 
 		if(box.is_empty()) {
 			set_flag(FIXPOINT);
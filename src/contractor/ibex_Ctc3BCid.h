@@ -14,6 +14,10 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_BitSet.h"
+#include "ibex_Array.h"
+#include "ibex_ThreadPool.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -100,6 +104,39 @@ class Ctc3BCid : public Ctc {
 	Ctc3BCid(Ctc& ctc, int s3b=default_s3b, int scid=default_scid,
 			int vhandled=-1, double var_min_width=default_var_min_width);
 
+	/**
+	 * \brief Parallel 3BCID.
+	 *
+	 * Same parameters as above, except that \a ctcs contains one
+	 * copy of the sub-contractor for each thread (the sub-contractors
+	 * must be independent, e.g., built on copies of the same system).
+	 *
+	 * The variables are shaved by rounds of ctcs.size() variables. In a round,
+	 * each variable is shaved by its own thread on a copy of the current box
+	 * and the round ends with the intersection of the shaved boxes. This
+	 * intersection does not depend on the order in which the threads finish:
+	 * the result only depends on the number of threads (provided that the
+	 * sub-contractors behave identically). It can be different from the
+	 * sequential 3BCID, where each variable is shaved with the box obtained
+	 * by the previous one.
+	 *
+	 * The threads other than the calling one shave with the objects created by
+	 * #shaver() (when the first round is run). A subclass that changes the
+	 * shaving must override this function.
+	 */
+	Ctc3BCid(const BitSet& cid_vars, const Array<Ctc>& ctcs, int s3b=default_s3b, int scid=default_scid,
+			int vhandled=-1, double var_min_width=default_var_min_width);
+
+	/**
+	 * \brief Parallel 3BCID on all variables.
+	 */
+	Ctc3BCid(const Array<Ctc>& ctcs, int s3b=default_s3b, int scid=default_scid,
+			int vhandled=-1, double var_min_width=default_var_min_width);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~Ctc3BCid();
 
 	/**
 	 * \brief Apply contraction.
@@ -116,9 +153,12 @@ class Ctc3BCid : public Ctc {
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
 
-	/** The sub-contractor */
+	/** The sub-contractor (the one of the first thread in parallel mode) */
 	Ctc& ctc;
 
+	/** Number of threads (1 if the shaving is sequential) */
+	const int nb_threads;
+
 	/** Default s3b value, set to 10 **/
 	static const int default_s3b;
 
@@ -229,7 +269,60 @@ class Ctc3BCid : public Ctc {
 	BitSet impact;
 
 	virtual int limitCIDDichotomy () ;
-	
+
+	/**
+	 * Number of variables shaved in the next round, among \a n
+	 * variables remaining (always 1 if the shaving is sequential).
+	 */
+	int round_size(int n) const;
+
+	/**
+	 * Applies var3BCID on the variables round[0],...,round[n-1].
+	 *
+	 * If n=1, the variable is shaved in \a box. Otherwise, the variables
+	 * are shaved by different threads in copies of \a box (stored in
+	 * #shaved) and \a box is set to the intersection of the shaved boxes.
+	 */
+	void shave(IntervalVector& box, int n);
+
+	/** Variables of the current round (#nb_threads at most). */
+	std::vector<int> round;
+
+	/** Boxes shaved by each thread in the last round (parallel mode). */
+	std::vector<IntervalVector> shaved;
+
+	/**
+	 * \brief Create the shaver of another thread (parallel mode).
+	 *
+	 * The shaver applies #var3BCID with \a ctc, the sub-contractor of its thread,
+	 * and must shave exactly as this object does: a subclass that overrides
+	 * #var3BCID_dicho, #var3BCID_slices or #limitCIDDichotomy must override
+	 * this function and return an instance of its own class. By default, a
+	 * Ctc3BCid is returned; for a subclass that does not override this
+	 * function, an error is raised instead.
+	 *
+	 * The returned object is deleted by this object.
+	 */
+	virtual Ctc3BCid* shaver(Ctc& ctc);
+
+ private:
+	Ctc3BCid(const Ctc3BCid&); // forbidden
+
+	void init_threads(const Array<Ctc>& ctcs);
+
+	void init_shavers();
+
+	/* The sub-contractors of the threads n°1,...,nb_threads-1 */
+	std::vector<Ctc*> thread_ctcs;
+
+	/* shavers[i] applies var3BCID with the sub-contractor of the thread n°i.
+	 * shavers[0] is this object (the other shavers are created by #shaver()
+	 * at the first round). */
+	std::vector<Ctc3BCid*> shavers;
+
+	ThreadPool* pool;
+
+	class ShaveTask;
 };
 
 } // end namespace ibex
@@ -30,6 +30,20 @@ CtcAcid::CtcAcid(const System& sys, Ctc& ctc, bool optim, int s3b, int scid,
 		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio), nbcidvar(0) ,  nbtuning(0), optim(optim) {
 }
 
+CtcAcid::CtcAcid(const System& sys, const BitSet& cid_vars, const Array<Ctc>& ctcs, bool optim, int s3b, int scid,
+		double var_min_width, double ct_ratio): Ctc3BCid (cid_vars,ctcs,s3b,scid,cid_vars.size(),var_min_width),
+		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio),  nbcidvar(0), nbtuning(0), optim(optim)  {
+}
+
+CtcAcid::CtcAcid(const System& sys, const Array<Ctc>& ctcs, bool optim, int s3b, int scid,
+		double var_min_width, double ct_ratio): Ctc3BCid (BitSet::all(sys.nb_var),ctcs,s3b,scid,sys.nb_var,var_min_width),
+		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio), nbcidvar(0) ,  nbtuning(0), optim(optim) {
+}
+
+Ctc3BCid* CtcAcid::shaver(Ctc& ctc) {
+	return new Ctc3BCid(cid_vars,ctc,s3b,scid,1,var_min_width);
+}
+
 void CtcAcid::contract(IntervalVector& box) {
 
 	int nb_CID_var=cid_vars.size();                    // [gch]
@@ -61,22 +75,28 @@ void CtcAcid::contract(IntervalVector& box) {
 
 	if (vhandled > 0) compute_smearorder(box);         // l'ordre sur les variables est calculé avec la smearsumrel
 	if (optim) putobjfirst();                         // pour l'optim (si optim mis à true dans le constructeur, la dernière variable (objectf) est mise en premier
-	for (int v=0; v<vhandled; v++) {
-		int v1=v%nb_CID_var;                               // [gch] how can v be < nb_var?? [bne]  vhandled can be between 0 and nbvarmax
-		int v2=smearorder[v1];
-		impact.add(v2);
-		var3BCID(box, v2);                             // appel 3BCID sur la variable v2
-		impact.remove(v2);
+	for (int v=0, n; v<vhandled; v+=n) {
+		n=round_size(vhandled-v);                      // nombre de variables traitées en parallèle (1 en séquentiel)
+		if (n>nb_CID_var) n=nb_CID_var;                // une variable au plus une fois par tour
+		for (int j=0; j<n; j++) {
+			int v1=(v+j)%nb_CID_var;                       // [gch] how can v be < nb_var?? [bne]  vhandled can be between 0 and nbvarmax
+			round[j]=smearorder[v1];
+		}
+		shave(box, n);                                 // appel 3BCID sur les variables round[0..n-1]
 
 		if(box.is_empty()) return;
 
 		if (nbcall1 < nbinitcalls) {                   // on fait des stats pour le réglage courant
-			for (int i=0; i<initbox.size(); i++)
-			{//cout << i << " initbox " << initbox[i].diam() << " box " << box[i].diam() << endl;
-				if  (initbox[i].diam() !=0 && box[i].diam()!= POS_INFINITY)
-					// gain sur la ième dimension de la boîte courante après var3BCID sur la v-ième variable
-					ctstat[v] += 1  - box[i].diam() / initbox[i].diam();}
-			ctstat[v]=ctstat[v]/ initbox.size();   // gain moyen
+			for (int j=0; j<n; j++) {
+				// en parallèle, le gain d'une variable est mesuré sur la boîte réduite par son propre thread
+				const IntervalVector& vbox = n==1 ? box : shaved[j];
+				for (int i=0; i<initbox.size(); i++)
+				{//cout << i << " initbox " << initbox[i].diam() << " box " << vbox[i].diam() << endl;
+					if  (initbox[i].diam() !=0 && vbox[i].diam()!= POS_INFINITY)
+						// gain sur la ième dimension de la boîte courante après var3BCID sur la v-ième variable
+						ctstat[v+j] += 1  - vbox[i].diam() / initbox[i].diam();}
+				ctstat[v+j]=ctstat[v+j]/ initbox.size();   // gain moyen
+			}
 		}
 
 		initbox=box;
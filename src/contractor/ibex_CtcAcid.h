@@ -62,6 +62,24 @@ public :
     CtcAcid(const System& sys, Ctc& ctc, bool optim=false, int s3b=default_s3b, int scid=default_scid,
 	    double var_min_width=default_var_min_width, double ct_ratio=default_ctratio);
 
+	/**
+	 * \brief Parallel ACID
+	 *
+	 * Same parameters as above, except that \a ctcs contains one copy of the
+	 * sub-contractor for each thread. The variables are shaved by rounds
+	 * of ctcs.size() variables (see #ibex::Ctc3BCid::Ctc3BCid(const BitSet&, const Array<Ctc>&, int, int, int, double)).
+	 * During the tuning phases, the gain of a variable is measured on the box
+	 * shaved by its own thread.
+	 */
+    CtcAcid(const System& sys, const BitSet& cid_vars, const Array<Ctc>& ctcs, bool optim=false, int s3b=default_s3b, int scid=default_scid,
+	    double var_min_width=default_var_min_width, double ct_ratio=default_ctratio);
+
+    /**
+     * \brief Parallel ACID on all variables
+     */
+    CtcAcid(const System& sys, const Array<Ctc>& ctcs, bool optim=false, int s3b=default_s3b, int scid=default_scid,
+	    double var_min_width=default_var_min_width, double ct_ratio=default_ctratio);
+
 	/**
 	 * \brief the contraction function
 	 *
@@ -99,6 +117,11 @@ protected :
 	void compute_smearorder(IntervalVector& box);
 	/** in case of optimization (optim = true) , the variable corresponding to the objective is put as first variable */
 	void putobjfirst();
+	/**
+	 * ACID only changes the variables to be shaved, not the shaving
+	 * of a variable: the other threads use the shaving of #ibex::Ctc3BCid.
+	 */
+	virtual Ctc3BCid* shaver(Ctc& ctc);
 	std::vector<int> smearorder;
 	int nbcalls;
 	double nbctvar;
@@ -10,11 +10,29 @@
 
 #include "ibex_CtcCompo.h"
 
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
 namespace ibex {
 
 /*! Default composition ratio. */
 const double CtcCompo::default_ratio = 0.1;
 
+const double CtcCompo::default_adaptive_ratio = 0.1;
+
+const int CtcCompo::default_max_period = 64;
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+/* Weight of the last call in the moving averages of the adaptive mode. */
+const double EFFICIENCY_DECAY = 0.3;
+
+}
+
 void CtcCompo::init_impacts() {
 
 //	impacts = new BoolMask[list.size()];
@@ -31,21 +49,24 @@ void CtcCompo::init_impacts() {
 
 
 CtcCompo::CtcCompo(const Array<Ctc>& list, bool incremental, double ratio) :
-		Ctc(list), list(list), incremental(incremental), ratio(ratio) {
+		Ctc(list), list(list), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, bool incremental, double ratio) :
-		Ctc(c1.nb_var),list(Array<Ctc>(c1,c2)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),list(Array<Ctc>(c1,c2)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, bool incremental, double ratio) :
-		Ctc(c1.nb_var),list(Array<Ctc>(c1,c2,c3)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),list(Array<Ctc>(c1,c2,c3)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
@@ -53,119 +74,136 @@ CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, bool incremental, double ratio) :
 
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18, Ctc& c19, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18, Ctc& c19, Ctc& c20, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19,c20)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19,c20)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), max_period(default_max_period) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
@@ -177,6 +215,11 @@ CtcCompo::~CtcCompo() {
 }
 
 
+void CtcCompo::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
+
 void CtcCompo::contract(IntervalVector& box) {
 
 	// TODO: wrong algorithm here
@@ -200,15 +243,40 @@ void CtcCompo::contract(IntervalVector& box) {
 
 	BitSet impact(BitSet::all(nb_var)); // always set to "all" for the moment (to be improved later)
 
+	if (adaptive && (int) period.size()!=list.size()) {
+		ema_gain.assign(list.size(),0);
+		ema_time.assign(list.size(),0);
+		period.assign(list.size(),1);
+		skip.assign(list.size(),0);
+		diam.resize(nb_var);
+	}
+
+	double t0=0;
+
 	for (int i=0; i<list.size(); i++) {
+		if (adaptive) {
+			if (skip[i]>0) {
+				skip[i]--;
+				inactive=false; // unknown
+				continue;
+			}
+			for (int j=0; j<nb_var; j++) diam[j]=box[j].diam();
+			t0=time();
+		}
+
 		if (inactive) {
 			flags.clear();
-			list[i].contract(box,impact,flags);
+			if (cell()) list[i].contract(*cell(),impact,flags); // cell() is NULL or box is its box
+			else list[i].contract(box,impact,flags);
 			if (!flags[INACTIVE]) inactive=false;
 		} else {
-			list[i].contract(box);
+			if (cell()) list[i].contract(*cell());
+			else list[i].contract(box);
 		}
 
+		if (adaptive)
+			update_efficiency(i, box, time()-t0);
+
 		if (box.is_empty()) {
 			set_flag(FIXPOINT);
 			return;
@@ -218,4 +286,42 @@ void CtcCompo::contract(IntervalVector& box) {
 	if (inactive) set_flag(INACTIVE);
 }
 
+double CtcCompo::time() {
+	return chrono::duration<double>(Clock::now().time_since_epoch()).count();
+}
+
+void CtcCompo::update_efficiency(int i, const IntervalVector& box, double t) {
+
+	// efficiency of the whole composition (before this call)
+	double sum_gain=0, sum_time=0;
+	for (int j=0; j<list.size(); j++) {
+		sum_gain += ema_gain[j];
+		sum_time += ema_time[j];
+	}
+
+	// relative reduction of the volume (on the components with a bounded
+	// and nonzero diameter before the call)
+	double gain;
+	if (box.is_empty())
+		gain=1;
+	else {
+		double log_ratio=0;
+		for (int j=0; j<nb_var && log_ratio>NEG_INFINITY; j++) {
+			if (diam[j]>0 && diam[j]<POS_INFINITY)
+				log_ratio += box[j].diam()>0 ? ::log(box[j].diam()/diam[j]) : NEG_INFINITY;
+		}
+		gain=1-::exp(log_ratio);
+	}
+
+	ema_gain[i] = (1-EFFICIENCY_DECAY)*ema_gain[i] + EFFICIENCY_DECAY*gain;
+	ema_time[i] = (1-EFFICIENCY_DECAY)*ema_time[i] + EFFICIENCY_DECAY*t;
+
+	// ema_gain[i]/ema_time[i] < adaptive_ratio * sum_gain/sum_time
+	if (ema_gain[i]*sum_time < adaptive_ratio*sum_gain*ema_time[i]) {
+		skip[i]=period[i];
+		period[i]=2*period[i]<=max_period ? 2*period[i] : max_period;
+	} else
+		period[i]=1;
+}
+
 } // end namespace ibex
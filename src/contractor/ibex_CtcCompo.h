@@ -14,6 +14,8 @@
 #include "ibex_Ctc.h"
 #include "ibex_Array.h"
 
+#include <vector>
+
 namespace ibex {
 
 /** \ingroup contractor
@@ -82,6 +84,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add the backtrackable data required by the sub-contractors.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/** The list of sub-contractors */
 	Array<Ctc> list;
 
@@ -94,10 +101,59 @@ public:
 	/** Default ratio used in incremental mode, set to 0.1. */
 	static const double default_ratio;
 
+	/**
+	 * \brief Adaptive mode?
+	 *
+	 * In adaptive mode, the composition learns the efficiency of each
+	 * sub-contractor, that is, its recent gain (relative reduction of the
+	 * volume of the box, 1 if the box becomes empty) per second, as an
+	 * exponential moving average. A sub-contractor whose efficiency is less
+	 * than #adaptive_ratio times the efficiency of the whole composition
+	 * is skipped for a number of calls which is doubled each time it is
+	 * called again without paying off (up to #max_period). It is not skipped
+	 * anymore as soon as it pays off. So a sub-contractor is never skipped forever
+	 * and comes back when the search reaches a region where it is useful.
+	 *
+	 * Skipping a sub-contractor only weakens the contraction (no solution
+	 * can be lost). False by default.
+	 */
+	bool adaptive;
+
+	/** Efficiency ratio used in adaptive mode. */
+	double adaptive_ratio;
+
+	/** Maximal period (number of calls) of a sub-contractor in adaptive mode. */
+	int max_period;
+
+	/** Default efficiency ratio used in adaptive mode, set to 0.1. */
+	static const double default_adaptive_ratio;
+
+	/** Default maximal period used in adaptive mode, set to 64. */
+	static const int default_max_period;
+
 protected:
 	void init_impacts();
 
 	BitSet *impacts;
+
+	/**
+	 * \brief Current time, in seconds (adaptive mode).
+	 *
+	 * Used to measure the time of each call to a sub-contractor. By default,
+	 * a steady clock. Can be overridden to measure the cost of the sub-contractors
+	 * differently (e.g., to make the adaptive mode deterministic).
+	 */
+	virtual double time();
+
+	/* Adaptive mode: update the statistics of the ith sub-contractor
+	 * after a call that took time t. */
+	void update_efficiency(int i, const IntervalVector& box, double t);
+
+	std::vector<double> ema_gain; // gain of each sub-contractor (moving average)
+	std::vector<double> ema_time; // time of each sub-contractor (moving average)
+	std::vector<int> period;      // current period of each sub-contractor
+	std::vector<int> skip;        // number of calls to skip for each sub-contractor
+	std::vector<double> diam;     // diameters of the box before a call
 };
 
 } // end namespace ibex
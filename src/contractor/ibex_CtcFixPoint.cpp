@@ -21,6 +21,10 @@ CtcFixPoint::CtcFixPoint(Ctc& ctc, double ratio) : Ctc(ctc.nb_var), ctc(ctc), ra
 CtcFixPoint::~CtcFixPoint(){
 }
 
+void CtcFixPoint::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
+}
+
 void CtcFixPoint::contract(IntervalVector& box) {
 	IntervalVector init_box(box);
 	IntervalVector old_box(box);
@@ -30,7 +34,8 @@ void CtcFixPoint::contract(IntervalVector& box) {
 	do {
 		old_box=box;
 
-		ctc.contract(box,impact,flags);
+		if (cell()) ctc.contract(*cell(),impact,flags); // cell() is NULL or box is its box
+		else ctc.contract(box,impact,flags);
 
 		if (box.is_empty()) {
 			set_flag(FIXPOINT);
@@ -87,6 +87,8 @@ CtcFwdBwd::~CtcFwdBwd() {
 
 void CtcFwdBwd::init() {
 
+	incremental = false;
+
 	input = new BitSet(0,nb_var-1,BitSet::empt);
 	output = new BitSet(0,nb_var-1,BitSet::empt);
 
@@ -103,7 +105,7 @@ void CtcFwdBwd::contract(IntervalVector& box) {
 	assert(box.size()>=f.nb_var());
 
 	//std::cout << " hc4 of " << f << "=" << d << " with box=" << box << std::endl;
-	if (f.backward(d,box)) {
+	if (incremental ? f.hc4revise().proj_incremental(d,box) : f.backward(d,box)) {
 		set_flag(INACTIVE);
 		set_flag(FIXPOINT);
 	}
@@ -118,4 +120,8 @@ void CtcFwdBwd::contract(IntervalVector& box) {
 	// may be non-optimal in backward mode.
 }
 
+void CtcFwdBwd::contract_batch(IntervalVector* boxes, int n) {
+	f.backward_batch(d,boxes,n);
+}
+
 } // namespace ibex
@@ -68,6 +68,13 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Contract several boxes at once.
+	 *
+	 * \see #ibex::Function::backward_batch(const Domain&, IntervalVector*, int) const.
+	 */
+	virtual void contract_batch(IntervalVector* boxes, int n);
+
 	/*
 	 * \brief Whether this contractor is idempotent (optional)
 	 */
@@ -81,6 +88,16 @@ public:
 	/** The domain "y". */
 	Domain d;
 
+	/**
+	 * \brief Incremental mode (false by default).
+	 *
+	 * If true, the forward phase only re-evaluates the nodes depending
+	 * on the variables modified since the last call, see
+	 * #ibex::HC4Revise::proj_incremental(const Domain&, IntervalVector&).
+	 * The code generated for f (if any) is not used in this mode.
+	 */
+	bool incremental;
+
 protected:
 	void init();
 };
@@ -23,12 +23,12 @@ Array<Ctc> convert(const Array<NumConstraint>& csp) {
 }
 }
 
-CtcHC4::CtcHC4(const Array<NumConstraint>& csp, double ratio, bool incremental) :
-		CtcPropag(convert(csp), ratio, incremental) {
+CtcHC4::CtcHC4(const Array<NumConstraint>& csp, double ratio, bool incremental, bool weighted) :
+		CtcPropag(convert(csp), ratio, incremental, weighted) {
 }
 
-CtcHC4::CtcHC4(const System& sys, double ratio, bool incremental) :
-				CtcPropag(convert(sys.ctrs), ratio, incremental) {
+CtcHC4::CtcHC4(const System& sys, double ratio, bool incremental, bool weighted) :
+				CtcPropag(convert(sys.ctrs), ratio, incremental, weighted) {
 
 }
 
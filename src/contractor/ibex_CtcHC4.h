@@ -29,16 +29,18 @@ class CtcHC4 : public CtcPropag {
    * \param csp - The CSP
    * \param ratio (optional) - \see #ibex::Propagation
    * \param incremental (optional) - \see #ibex::Propagation
+   * \param weighted (optional) - \see #ibex::CtcPropag
    */
-  CtcHC4(const Array<NumConstraint>& csp, double ratio=default_ratio, bool incremental=false);
+  CtcHC4(const Array<NumConstraint>& csp, double ratio=default_ratio, bool incremental=false, bool weighted=false);
 
   /**
     * \brief Create a HC4 propagation with a system
     * \param sys - The system
     * \param ratio (optional) - \see #ibex::Propagation
     * \param incremental (optional) - \see #ibex::Propagation
+    * \param weighted (optional) - \see #ibex::CtcPropag
     */
-  CtcHC4(const System& sys, double ratio=default_ratio, bool incremental=false);
+  CtcHC4(const System& sys, double ratio=default_ratio, bool incremental=false, bool weighted=false);
 
   /**
    * \brief Delete *this.
@@ -0,0 +1,37 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcMohc.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_CtcMohc.h"
+
+namespace ibex {
+
+namespace {
+Array<Ctc> convert(const Array<NumConstraint>& csp, double tau_mohc, double eps) {
+	std::vector<Ctc*> vec;
+	for (int i=0; i<csp.size(); i++) {
+		vec.push_back(new CtcMohcRevise(csp[i],tau_mohc,eps));
+	}
+	return vec;
+}
+}
+
+CtcMohc::CtcMohc(const Array<NumConstraint>& csp, double ratio, double tau_mohc, double eps, bool weighted) :
+		CtcPropag(convert(csp,tau_mohc,eps), ratio, false, weighted) {
+}
+
+CtcMohc::CtcMohc(const System& sys, double ratio, double tau_mohc, double eps, bool weighted) :
+		CtcPropag(convert(sys.ctrs,tau_mohc,eps), ratio, false, weighted) {
+}
+
+CtcMohc::~CtcMohc() {
+	for (int i=0; i<list.size(); i++)
+		delete &list[i];
+}
+
+} // end namespace ibex
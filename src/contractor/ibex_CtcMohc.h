@@ -0,0 +1,60 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcMohc.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_MOHC_H__
+#define __IBEX_CTC_MOHC_H__
+
+#include "ibex_CtcPropag.h"
+#include "ibex_CtcMohcRevise.h"
+#include "ibex_System.h"
+#include "ibex_Array.h"
+
+namespace ibex {
+
+/** \ingroup contractor
+ *
+ * \brief Mohc propagation.
+ *
+ * Same as #ibex::CtcHC4 with #ibex::CtcMohcRevise instead of HC4Revise:
+ * exploits the monotonicity of the constraints w.r.t. the variables
+ * with multiple occurrences.
+ */
+class CtcMohc : public CtcPropag {
+  public:
+  /**
+   * \brief Create a Mohc propagation with a CSP (array of constraints).
+   * \param csp - The CSP
+   * \param ratio (optional) - \see #ibex::Propagation
+   * \param tau_mohc (optional) - \see #ibex::CtcMohcRevise
+   * \param eps (optional) - \see #ibex::CtcMohcRevise
+   * \param weighted (optional) - \see #ibex::CtcPropag
+   */
+  CtcMohc(const Array<NumConstraint>& csp, double ratio=default_ratio, double tau_mohc=CtcMohcRevise::default_tau_mohc,
+		  double eps=CtcMohcRevise::default_eps, bool weighted=false);
+
+  /**
+   * \brief Create a Mohc propagation with a system
+   * \param sys - The system
+   * \param ratio (optional) - \see #ibex::Propagation
+   * \param tau_mohc (optional) - \see #ibex::CtcMohcRevise
+   * \param eps (optional) - \see #ibex::CtcMohcRevise
+   * \param weighted (optional) - \see #ibex::CtcPropag
+   */
+  CtcMohc(const System& sys, double ratio=default_ratio, double tau_mohc=CtcMohcRevise::default_tau_mohc,
+		  double eps=CtcMohcRevise::default_eps, bool weighted=false);
+
+  /**
+   * \brief Delete *this.
+   */
+  ~CtcMohc();
+};
+
+
+} // end namespace ibex
+#endif // __IBEX_CTC_MOHC_H__
@@ -0,0 +1,212 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcMohcRevise.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_CtcMohcRevise.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+const double CtcMohcRevise::default_tau_mohc = 0.9;
+
+const double CtcMohcRevise::default_eps = 0.1;
+
+CtcMohcRevise::CtcMohcRevise(Function& f, CmpOp op, double tau_mohc, double eps) :
+		CtcFwdBwd(f,op), tau_mohc(tau_mohc), eps(eps), g(f.nb_var()), x(f.nb_var()) {
+	init_mohc();
+}
+
+CtcMohcRevise::CtcMohcRevise(Function& f, const Interval& y, double tau_mohc, double eps) :
+		CtcFwdBwd(f,y), tau_mohc(tau_mohc), eps(eps), g(f.nb_var()), x(f.nb_var()) {
+	init_mohc();
+}
+
+CtcMohcRevise::CtcMohcRevise(const NumConstraint& ctr, double tau_mohc, double eps) :
+		CtcFwdBwd(ctr), tau_mohc(tau_mohc), eps(eps), g(ctr.f.nb_var()), x(ctr.f.nb_var()) {
+	init_mohc();
+}
+
+namespace {
+
+// number of fathers of e in the expression of f
+int nb_fathers(const Function& f, const ExprNode& e) {
+	int n=0;
+	for (int l=0; l<e.fathers.size(); l++)
+		if (f.nodes.found(e.fathers[l])) n++;
+	return n;
+}
+
+}
+
+void CtcMohcRevise::init_mohc() {
+	sign.assign(nb_var,0);
+	nb_occ.assign(nb_var,0);
+
+	int offset=0; // index of the first variable of the current symbol
+	for (int k=0; k<f.nb_arg(); k++) {
+		const ExprSymbol& s=f.arg(k);
+		int size=s.dim.size();
+
+		for (int l=0; l<s.fathers.size(); l++) {
+			const ExprNode& father=s.fathers[l];
+			if (!f.nodes.found(father)) continue; // node of another expression
+
+			const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&father);
+			if (idx && idx->index.nb_rows()==1 && idx->index.nb_cols()==1) {
+				int n=nb_fathers(f,father);
+				nb_occ[offset+idx->index.first_row()*s.dim.nb_cols()+idx->index.first_col()] += (n>0 ? n : 1);
+			} else {
+				for (int i=0; i<size; i++) nb_occ[offset+i]++;
+			}
+		}
+		offset+=size;
+	}
+}
+
+void CtcMohcRevise::extremal_box(const IntervalVector& box, bool min, IntervalVector& x) const {
+	x=box;
+	for (int i=0; i<nb_var; i++) {
+		if (sign[i]==0) continue;
+		// lower bound if f is increasing and we minimize, or decreasing and we maximize
+		x[i]= (sign[i]>0)==min ? box[i].lb() : box[i].ub();
+	}
+}
+
+bool CtcMohcRevise::shave(IntervalVector& box, int i, bool inc, bool left) {
+
+	const Interval& y=d.i();
+
+	// On the left side of an increasing function (or the right side of
+	// a decreasing one), the upper bound of f is tested against y.lb();
+	// otherwise, the lower bound of f is tested against y.ub().
+	bool use_min = (inc!=left);
+
+	if (use_min ? y.ub()==POS_INFINITY : y.lb()==NEG_INFINITY) return true;
+
+	extremal_box(box, use_min, x);
+
+	double a=box[i].lb();
+	double b=box[i].ub();
+
+	// test(c)==true <=> no solution on the slice between the bound and c
+	double start=left ? a : b;
+	double end=left ? b : a;
+
+	x[i]=start;
+	Interval fx=f.eval(x);
+	if (fx.is_empty() || !(use_min ? fx.lb()>y.ub() : fx.ub()<y.lb())) return true;
+
+	x[i]=end;
+	fx=f.eval(x);
+	if (!fx.is_empty() && (use_min ? fx.lb()>y.ub() : fx.ub()<y.lb())) return false;
+
+	double lo=start; // the slice [start,lo] has no solution
+	double hi=end;
+	double prec=eps*box[i].diam();
+
+	while (fabs(hi-lo)>prec) {
+		double c=lo+(hi-lo)/2;
+		if (c==lo || c==hi) break;
+		x[i]=c;
+		fx=f.eval(x);
+		if (!fx.is_empty() && (use_min ? fx.lb()>y.ub() : fx.ub()<y.lb()))
+			lo=c;
+		else
+			hi=c;
+	}
+
+	if (left)
+		box[i]=Interval(lo,b);
+	else
+		box[i]=Interval(a,lo);
+
+	return true;
+}
+
+void CtcMohcRevise::contract(IntervalVector& box) {
+
+	assert(box.size()>=f.nb_var());
+
+	// HC4Revise
+	if (incremental ? f.hc4revise().proj_incremental(d,box) : f.backward(d,box)) {
+		set_flag(INACTIVE);
+		set_flag(FIXPOINT);
+		return;
+	}
+
+	if (box.is_empty()) {
+		set_flag(FIXPOINT);
+		return;
+	}
+
+	if (!f.expr().dim.is_scalar()) return;
+
+	// An unbounded image may come from a pole of f (e.g., a division by
+	// an interval containing 0): the sign of the derivatives does not
+	// imply monotonicity in this case.
+	Interval fx=f.eval(box);
+	if (fx.is_empty() || fx.is_unbounded()) return;
+
+	// monotonic variables
+	f.gradient(box,g);
+	if (g.is_empty()) return;
+
+	bool mono=false;
+	for (int i=0; i<nb_var; i++) {
+		if (box[i].is_degenerated() || box[i].is_unbounded() || g[i].is_unbounded() || g[i]==Interval::ZERO)
+			sign[i]=0;
+		else if (g[i].lb()>=0)
+			sign[i]=1;
+		else if (g[i].ub()<=0)
+			sign[i]=-1;
+		else
+			sign[i]=0;
+		if (sign[i]!=0) mono=true;
+	}
+
+	if (!mono) return;
+
+	// MinMax
+	extremal_box(box,true,x);
+	Interval fmin=f.eval(x);
+	extremal_box(box,false,x);
+	Interval fmax=f.eval(x);
+
+	if (fmin.is_empty() || fmax.is_empty()) return;
+
+	Interval image=fx & Interval(fmin.lb(),fmax.ub());
+
+	if ((image & d.i()).is_empty()) {
+		box.set_empty();
+		set_flag(FIXPOINT);
+		return;
+	}
+
+	if (image.diam() >= tau_mohc*fx.diam()) return;
+
+	// monotonic shaving
+	for (int i=0; i<nb_var; i++) {
+		if (sign[i]==0 || nb_occ[i]<2) continue;
+
+		if (!shave(box,i,sign[i]>0,true) || !shave(box,i,sign[i]>0,false)) {
+			box.set_empty();
+			set_flag(FIXPOINT);
+			return;
+		}
+	}
+}
+
+void CtcMohcRevise::contract_batch(IntervalVector* boxes, int n) {
+	for (int k=0; k<n; k++)
+		contract(boxes[k]);
+}
+
+} // namespace ibex
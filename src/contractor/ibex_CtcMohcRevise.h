@@ -0,0 +1,125 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcMohcRevise.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_MOHC_REVISE_H__
+#define __IBEX_CTC_MOHC_REVISE_H__
+
+#include "ibex_CtcFwdBwd.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ * \brief Monotonicity-based revise (Mohc-Revise).
+ *
+ * Contractor for a scalar constraint f(x) in [y] that handles the multiple
+ * occurrences of the variables better than HC4Revise when f is monotonic
+ * w.r.t. some of them (see Araya, Trombettoni and Neveu, "Exploiting
+ * monotonicity in interval constraint propagation", AAAI 2010).
+ *
+ * After HC4Revise, the gradient of f is computed to detect the variables
+ * w.r.t. which f is monotonic on the box (the natural evaluation of f and
+ * the partial derivative must be bounded, to exclude the poles). Then:
+ * <ul>
+ * <li> <b>MinMax</b>: the lower (upper) bound of f is evaluated with each
+ *      monotonic variable replaced by the bound of its domain that
+ *      minimizes (maximizes) f. The box is empty if the resulting image
+ *      does not intersect [y].
+ * <li> <b>Monotonic shaving</b>: if this image is sharp enough compared
+ *      to the natural evaluation (see #tau_mohc), each monotonic variable
+ *      with multiple occurrences is shaved on both sides: a slice
+ *      [a,c] of x_i is removed when the MinMax bound of f with x_i=c
+ *      shows that f cannot reach [y] on the slice. The bound c is found
+ *      by dichotomy, with precision #eps (relative to the diameter of x_i).
+ * </ul>
+ * Variables with a single occurrence are already handled optimally by
+ * HC4Revise and are not shaved.
+ *
+ * For a vector or matrix-valued function, only HC4Revise is applied.
+ */
+class CtcMohcRevise : public CtcFwdBwd {
+public:
+	/**
+	 * \brief Build the contractor for "f(x) op 0".
+	 */
+	CtcMohcRevise(Function& f, CmpOp op=EQ, double tau_mohc=default_tau_mohc, double eps=default_eps);
+
+	/**
+	 * \brief Build the contractor for "f(x) in [y]".
+	 */
+	CtcMohcRevise(Function& f, const Interval& y, double tau_mohc=default_tau_mohc, double eps=default_eps);
+
+	/**
+	 * \remark ctr is not kept by reference.
+	 */
+	CtcMohcRevise(const NumConstraint& ctr, double tau_mohc=default_tau_mohc, double eps=default_eps);
+
+	/**
+	 * \brief Contract the box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+	/**
+	 * \brief Contract several boxes.
+	 *
+	 * Calls #contract(IntervalVector&) for each box (the batched
+	 * forward-backward of #ibex::CtcFwdBwd would skip the monotonic part).
+	 */
+	virtual void contract_batch(IntervalVector* boxes, int n);
+
+	/**
+	 * \brief Threshold for monotonic shaving.
+	 *
+	 * The variables are shaved only if the diameter of the image of f
+	 * obtained by MinMax is less than tau_mohc times the diameter of the
+	 * natural evaluation. With 1, they are always shaved.
+	 */
+	double tau_mohc;
+
+	/** Precision of the shaving (ratio of the diameter of a variable). */
+	double eps;
+
+	/**
+	 * \brief Number of occurrences of each variable in f.
+	 *
+	 * An upper bound (an occurrence of a vector symbol that is not
+	 * indexed by a single component counts for all its components).
+	 */
+	std::vector<int> nb_occ;
+
+	/** Default threshold for monotonic shaving: 0.9. */
+	static const double default_tau_mohc;
+
+	/** Default precision of the shaving: 0.1. */
+	static const double default_eps;
+
+protected:
+	void init_mohc();
+
+	/* Move the left bound (if left==true) or the right bound of x_i
+	 * (f being increasing w.r.t. x_i if inc==true, decreasing otherwise).
+	 * Return false if the box is empty. */
+	bool shave(IntervalVector& box, int i, bool inc, bool left);
+
+	/* Put in x the box where each monotonic variable is set to the bound
+	 * that minimizes (if min==true) or maximizes f. */
+	void extremal_box(const IntervalVector& box, bool min, IntervalVector& x) const;
+
+	/* Sign of the partial derivatives on the last box: 1 (increasing),
+	 * -1 (decreasing) or 0 (not monotonic). */
+	std::vector<int> sign;
+
+	IntervalVector g;   // gradient
+	IntervalVector x;   // extremal box
+};
+
+} // namespace ibex
+#endif // __IBEX_CTC_MOHC_REVISE_H__
@@ -5,18 +5,23 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 17, 2026
 //====================================f========================================
 
 #include "ibex_CtcNewton.h"
 #include "ibex_Exception.h"
+#include "ibex_Cell.h"
+#include "ibex_JacobianCache.h"
+
+#include <typeinfo>
 
 namespace ibex {
 
 const double CtcNewton::default_ceil = 0.01;
 
 CtcNewton::CtcNewton(const Function& f, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		warm_start(false), reuse_ratio(default_precond_reuse_ratio) {
 
 	if (f.nb_var()!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -24,16 +29,38 @@ CtcNewton::CtcNewton(const Function& f, double ceil, double prec, double ratio)
 }
 
 CtcNewton::CtcNewton(const Function& f, const VarSet& vars, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		warm_start(false), reuse_ratio(default_precond_reuse_ratio) {
 
 	if (vars.nb_var!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
 	}
 }
 
+void CtcNewton::add_backtrackable(Cell& root) {
+	if (warm_start) root.add<NewtonPrecondData>();
+}
+
 void CtcNewton::contract(IntervalVector& box) {
 	if (!(box.max_diam()<=ceil)) return;
-	else {
+
+	std::shared_ptr<const NewtonPrecond>* pc=NULL;
+	if (warm_start && cell() && cell()->has<NewtonPrecondData>())
+		pc=&cell()->get<NewtonPrecondData>().pc;
+
+	if (!vars && cell() && cell()->has<JacobianCache>()) {
+		// the last Hansen matrix is stored in the cell
+		IntervalMatrix H(f.image_dim(),f.nb_var());
+		IntervalVector H_box(f.nb_var());
+		newton(f,box,H,H_box,pc,prec,gauss_seidel_ratio,reuse_ratio);
+		if (!H_box.is_empty())
+			cell()->get<JacobianCache>().store(f,H_box,H,JacobianCache::HANSEN);
+	} else if (pc) {
+		if (!vars)
+			newton(f,box,*pc,prec,gauss_seidel_ratio,reuse_ratio);
+		else
+			newton(f,*vars,box,*pc,prec,gauss_seidel_ratio,reuse_ratio);
+	} else {
 		if (!vars)
 			newton(f,box,prec,gauss_seidel_ratio);
 		else
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_NEWTON_H__
@@ -14,12 +14,16 @@
 #include "ibex_Ctc.h"
 #include "ibex_Newton.h"
 #include "ibex_VarSet.h"
+#include "ibex_Backtrackable.h"
 
 namespace ibex {
 
 /** \ingroup contractor
  * \brief Newton contractor.
  *
+ * When the contractor is called with a cell that contains a #ibex::JacobianCache
+ * (and Newton is applied on all the variables), the last Hansen matrix is stored
+ * in the cell, so that it can be reused by the bisector.
  **/
 class CtcNewton : public Ctc {
 public:
@@ -48,6 +52,11 @@ public:
 
 	void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add the preconditioner slot to the root cell (if #warm_start is set).
+	 */
+	void add_backtrackable(Cell& root);
+
 	/** The function. */
 	const Function& f;
 
@@ -66,10 +75,62 @@ public:
 	/** Gauss-Seidel ratio. See #ibex::newton(const Function&, IntervalVector&, double, double);*/
 	const double gauss_seidel_ratio;
 
+	/**
+	 * \brief Warm start.
+	 *
+	 * If true, the preconditioner computed by Newton in a cell is stored in
+	 * the cell (see #ibex::NewtonPrecondData) and, in the descendant cells, Newton
+	 * starts with this preconditioner as long as it is close enough to the inverse
+	 * of the midpoint Hansen matrix (see #ibex::NewtonPrecond). In a depth-first search,
+	 * consecutive nodes often differ by the bisection of a single variable and the
+	 * inversion of the midpoint matrix (O(n^3)) is skipped.
+	 *
+	 * Only works when the contractor is called with a cell
+	 * (see #ibex::Ctc::contract(Cell&)). False by default.
+	 */
+	bool warm_start;
+
+	/**
+	 * \brief Ratio for reusing a preconditioner (see #ibex::NewtonPrecond).
+	 *
+	 * Default value is #ibex::default_precond_reuse_ratio.
+	 */
+	double reuse_ratio;
+
 	/** Initialized to 0.01 */
 	static const double default_ceil;
 
 };
 
+/** \ingroup contractor
+ * \brief Preconditioner of #ibex::CtcNewton stored in a cell (warm start).
+ *
+ * The two children of a cell share the preconditioner of their father
+ * (which is never modified but replaced when it is too far).
+ */
+class NewtonPrecondData : public Backtrackable {
+public:
+	/** \brief No preconditioner (root cell). */
+	NewtonPrecondData() { }
+
+	/** \brief Create the data of the children. */
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new NewtonPrecondData(*this),new NewtonPrecondData(*this));
+	}
+
+	/** \brief Nothing is written (the preconditioner is dropped). */
+	bool serialize(std::ostream& os) const {
+		return true;
+	}
+
+	/** \brief No preconditioner. */
+	Backtrackable* deserialize(std::istream& is) const {
+		return new NewtonPrecondData();
+	}
+
+	/** The last preconditioner (NULL if none) */
+	std::shared_ptr<const NewtonPrecond> pc;
+};
+
 } // end namespace ibex
 #endif // __IBEX_CTC_NEWTON_H__
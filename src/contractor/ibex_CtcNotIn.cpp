@@ -100,4 +100,8 @@ void CtcNotIn::contract(IntervalVector& box) {
 	_union->contract(box);
 }
 
+void CtcNotIn::contract_batch(IntervalVector* boxes, int n) {
+	_union->contract_batch(boxes,n);
+}
+
 } // end namespace ibex
@@ -54,6 +54,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Contract several boxes at once.
+	 */
+	virtual void contract_batch(IntervalVector* boxes, int n);
+
 protected:
 	Function& f;
 
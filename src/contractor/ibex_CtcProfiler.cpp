@@ -0,0 +1,125 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfiler.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_CtcProfiler.h"
+
+#include <chrono>
+#include <ctime>
+#include <cmath>
+#include <iomanip>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+// log(diam(before[i]))-log(diam(after[i])) summed over the
+// components with a bounded and nonzero diameter
+double log_volume_reduction(const IntervalVector& before, const IntervalVector& after) {
+	double r=0;
+	for (int i=0; i<before.size(); i++) {
+		double d0=before[i].diam();
+		double d1=after[i].diam();
+		if (d0<POS_INFINITY && d1>0) r+=::log(d0)-::log(d1);
+	}
+	return r;
+}
+
+void print_json_string(ostream& os, const string& s) {
+	os << '"';
+	for (string::const_iterator it=s.begin(); it!=s.end(); it++) {
+		if (*it=='"' || *it=='\\') os << '\\';
+		os << *it;
+	}
+	os << '"';
+}
+
+}
+
+CtcProfiler::CtcProfiler(Ctc& ctc, const string& name) : Ctc(ctc.nb_var), ctc(ctc), name(name), all(BitSet::all(ctc.nb_var)) {
+	input=ctc.input;
+	output=ctc.output;
+	reset();
+}
+
+void CtcProfiler::reset() {
+	nb_calls=0;
+	real_time=0;
+	cpu_time=0;
+	nb_empty=0;
+	nb_fixpoint=0;
+	nb_inactive=0;
+	log_volume_reduction=0;
+}
+
+void CtcProfiler::contract(IntervalVector& box) {
+	BitSet flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS));
+	const BitSet& _impact = impact() ? *impact() : all;
+
+	IntervalVector before(box);
+
+	nb_calls++;
+	Clock::time_point real0=Clock::now();
+	clock_t cpu0=clock();
+
+	if (cell()) ctc.contract(*cell(),_impact,flags); // cell() is NULL or box is its box
+	else ctc.contract(box,_impact,flags);
+
+	real_time += chrono::duration<double>(Clock::now()-real0).count();
+	cpu_time  += double(clock()-cpu0)/CLOCKS_PER_SEC;
+
+	if (flags[FIXPOINT]) { nb_fixpoint++; set_flag(FIXPOINT); }
+	if (flags[INACTIVE]) { nb_inactive++; set_flag(INACTIVE); }
+
+	if (box.is_empty())
+		nb_empty++;
+	else
+		log_volume_reduction += ibex::log_volume_reduction(before,box);
+}
+
+void CtcProfiler::print_table(ostream& os, const vector<CtcProfiler*>& profilers) {
+	size_t w=8;
+	for (vector<CtcProfiler*>::const_iterator it=profilers.begin(); it!=profilers.end(); it++)
+		if ((*it)->name.size()>w) w=(*it)->name.size();
+
+	os << left << setw(w) << "ctc" << right
+	   << setw(12) << "calls" << setw(12) << "real(s)" << setw(12) << "cpu(s)"
+	   << setw(10) << "empty" << setw(10) << "fixpoint" << setw(10) << "inactive"
+	   << setw(14) << "logvol/call" << endl;
+
+	for (vector<CtcProfiler*>::const_iterator it=profilers.begin(); it!=profilers.end(); it++) {
+		const CtcProfiler& p=**it;
+		os << left << setw(w) << p.name << right
+		   << setw(12) << p.nb_calls << setw(12) << p.real_time << setw(12) << p.cpu_time
+		   << setw(10) << p.nb_empty << setw(10) << p.nb_fixpoint << setw(10) << p.nb_inactive
+		   << setw(14) << (p.nb_calls>0 ? p.log_volume_reduction/p.nb_calls : 0) << endl;
+	}
+}
+
+void CtcProfiler::print_json(ostream& os, const vector<CtcProfiler*>& profilers) {
+	os << "[";
+	for (vector<CtcProfiler*>::const_iterator it=profilers.begin(); it!=profilers.end(); it++) {
+		const CtcProfiler& p=**it;
+		if (it!=profilers.begin()) os << ",";
+		os << endl << "  {\"name\": "; print_json_string(os,p.name);
+		os << ", \"calls\": " << p.nb_calls
+		   << ", \"real_time\": " << p.real_time
+		   << ", \"cpu_time\": " << p.cpu_time
+		   << ", \"empty\": " << p.nb_empty
+		   << ", \"fixpoint\": " << p.nb_fixpoint
+		   << ", \"inactive\": " << p.nb_inactive
+		   << ", \"log_volume_reduction\": " << p.log_volume_reduction << "}";
+	}
+	os << endl << "]" << endl;
+}
+
+} // end namespace ibex
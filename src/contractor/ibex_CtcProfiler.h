@@ -0,0 +1,124 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfiler.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_PROFILER_H__
+#define __IBEX_CTC_PROFILER_H__
+
+#include "ibex_Ctc.h"
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace ibex {
+
+/** \ingroup contractor
+ * \brief Profiling wrapper.
+ *
+ * Contracts like the wrapped contractor and records statistics on
+ * the calls: number of calls, real and cpu time, number of empty
+ * results, number of calls that have set the FIXPOINT and INACTIVE
+ * flags and log-volume reduction.
+ *
+ * Only the wrapped contractors are profiled, so profiling costs nothing
+ * when it is not used. To profile the stages of a pipeline, wrap each stage:
+ * <pre>
+ *   CtcProfiler p1(hc4,"hc4"), p2(acid,"acid"), p3(newton,"newton");
+ *   CtcCompo compo(p1,p2,p3);
+ * </pre>
+ * and give the profilers to the strategy (see #ibex::Solver::profilers).
+ *
+ * The wrapped contractor is always called with an impact and output
+ * flags (all the variables are impacted if no impact is given).
+ *
+ * \note The time of a profiler includes the time of the profilers
+ * nested inside. The cpu time is the one of the process (all threads),
+ * so a profiler should not be shared by several threads.
+ */
+class CtcProfiler : public Ctc {
+public:
+	/**
+	 * \brief Wrap \a ctc.
+	 *
+	 * \param name - the name of the contractor in the reports.
+	 */
+	CtcProfiler(Ctc& ctc, const std::string& name);
+
+	/**
+	 * \brief Contract a box (with the wrapped contractor).
+	 */
+	virtual void contract(IntervalVector& box);
+
+	/**
+	 * \brief Add the backtrackable data required by the wrapped contractor.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Reset the statistics.
+	 */
+	void reset();
+
+	/**
+	 * \brief Print the statistics of several profilers as a table.
+	 */
+	static void print_table(std::ostream& os, const std::vector<CtcProfiler*>& profilers);
+
+	/**
+	 * \brief Print the statistics of several profilers in JSON.
+	 *
+	 * The output is an array with one object per profiler.
+	 */
+	static void print_json(std::ostream& os, const std::vector<CtcProfiler*>& profilers);
+
+	/** The wrapped contractor. */
+	Ctc& ctc;
+
+	/** The name of the contractor. */
+	const std::string name;
+
+	/** Number of calls. */
+	long nb_calls;
+
+	/** Real time spent in the contractor (in seconds). */
+	double real_time;
+
+	/** Cpu time spent in the contractor (in seconds). */
+	double cpu_time;
+
+	/** Number of calls that resulted in an empty box. */
+	long nb_empty;
+
+	/** Number of calls that have set the FIXPOINT flag. */
+	long nb_fixpoint;
+
+	/** Number of calls that have set the INACTIVE flag. */
+	long nb_inactive;
+
+	/**
+	 * \brief Total log-volume reduction.
+	 *
+	 * Sum over all the calls with a nonempty result of
+	 * log(diam(x_i))-log(diam(x'_i)) for all the components with a
+	 * bounded and nonzero diameter, before (x) and after (x') contraction.
+	 */
+	double log_volume_reduction;
+
+private:
+	BitSet all; // impact of all the variables
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void CtcProfiler::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
+}
+
+} // end namespace ibex
+#endif // __IBEX_CTC_PROFILER_H__
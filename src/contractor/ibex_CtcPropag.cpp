@@ -20,11 +20,20 @@ namespace ibex {
 /*! Default propagation ratio. */
 #define __IBEX_DEFAULT_RATIO_PROPAG           0.01
 
+namespace {
 
-CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
+/* Weight of the last call in the expected gain of a contractor (weighted agenda). */
+const double WEIGHT_DECAY=0.3;
+
+}
+
+
+CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental, bool weighted) :
 		  Ctc(cl), list(cl), ratio(ratio), incremental(incremental),
-		  accumulate(false), g(cl.size(), nb_var), agenda(cl.size()),
-		  _impact(BitSet::empty(nb_var)), flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS)), active(BitSet::empty(cl.size())) {
+		  accumulate(false), weighted(weighted), g(cl.size(), nb_var), agenda(cl.size()),
+		  _impact(BitSet::empty(nb_var)), flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS)), active(BitSet::empty(cl.size())),
+		  old_box(nb_var), wagenda(cl.size()),
+		  gain(weighted? cl.size() : 0, 1.0), diam(weighted? nb_var : 0) {
 
 	assert(check_nb_var_ctc_list(cl));
 
@@ -34,10 +43,40 @@ CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 			if (list[i].input && (*list[i].output)[j]) g.add_arc(i,j,false);
 		}
 
+	// build the adjacency lists now (not in the first call to contract)
+	g.build();
+
 	//cout << g << endl;
 }
 
 
+void CtcPropag::push(int c) {
+	if (weighted)
+		wagenda.push(c, gain[c]);
+	else
+		agenda.push(c);
+}
+
+void CtcPropag::update_weight(int c, const IntervalVector& box) {
+	double r=0; // relative reduction of the output domains
+
+	IndexSpan vars=g.output_vars(c);
+
+	if (box.is_empty())
+		r=1;
+	else if (!vars.empty()) {
+		for (const int* v=vars.begin(); v!=vars.end(); v++) {
+			if (diam[*v]==POS_INFINITY)
+				r+=box[*v].diam()<POS_INFINITY ? 1 : 0;
+			else if (diam[*v]>0)
+				r+=1-box[*v].diam()/diam[*v];
+		}
+		r/=vars.size();
+	}
+
+	gain[c]=(1-WEIGHT_DECAY)*gain[c]+WEIGHT_DECAY*r;
+}
+
 void CtcPropag::contract(IntervalVector& box) {
 
 	assert(box.size()==nb_var);
@@ -70,14 +109,14 @@ void CtcPropag::contract(IntervalVector& box) {
 
 		for (int i=0; i<nb_var; i++) {
 			if (!impact() || (*impact())[i]) {
-				set<int> ctrs=g.output_ctrs(i);
-				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
-					agenda.push(*c);
+				IndexSpan ctrs=g.output_ctrs(i);
+				for (const int* c=ctrs.begin(); c!=ctrs.end(); c++)
+					push(*c);
 			}
 		}
 	} else { // push all the contractors
 		for (int i=0; i<list.size(); i++)
-			agenda.push(i);
+			push(i);
 	}
 
 	int c; // current contractor
@@ -87,7 +126,7 @@ void CtcPropag::contract(IntervalVector& box) {
 	 * - variables domains before last propagation ("fine" propagation, accumulate=true)
 	 * - variables domains before last projection ("coarse" propagation, accumulate=false)
 	 */
-	IntervalVector old_box(box);
+	old_box = box;
 
 	//   VECTOR thres(_nb_var);        // threshold for propagation
 	//   for (int i=1; i<=_nb_var; i++) {
@@ -95,16 +134,17 @@ void CtcPropag::contract(IntervalVector& box) {
 	//     if (thres(i)<w) thres(i)=w;
 	//   }
 	//cout << "=========== Start propagation ==========" << endl;
-	while (!agenda.empty()) {
+	while (weighted ? !wagenda.empty() : !agenda.empty()) {
 
-		agenda.pop(c);
+		if (weighted) wagenda.pop(c);
+		else agenda.pop(c);
 
-		set<int> vars=g.output_vars(c);
+		IndexSpan vars=g.output_vars(c);
 
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
-			for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++) {
+			for (const int* v=vars.begin(); v!=vars.end(); v++) {
 				old_box[*v] = box[*v];
 			}
 		}
@@ -113,10 +153,19 @@ void CtcPropag::contract(IntervalVector& box) {
 		//cout << "Contraction with " << c << endl;
 
 
-		list[c].contract(box, _impact, flags);
+		if (weighted) {
+			for (const int* v=vars.begin(); v!=vars.end(); v++)
+				diam[*v] = box[*v].diam();
+
+			list[c].contract(box, _impact, flags);
+
+			update_weight(c, box);
+		} else
+			list[c].contract(box, _impact, flags);
 
 		if (box.is_empty()) {
-			agenda.flush();
+			if (weighted) wagenda.flush();
+			else agenda.flush();
 			//cout << "=========== End propagation ==========" << endl;
 			//cout << "   empty!" << endl;
 			return;
@@ -126,15 +175,15 @@ void CtcPropag::contract(IntervalVector& box) {
 			active.remove(c);
 		}
 
-		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
+		for (const int* it=vars.begin(); it!=vars.end(); it++) {
 			int v=*it;
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
-				set<int> ctrs=g.output_ctrs(v);
-				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+				IndexSpan ctrs=g.output_ctrs(v);
+				for (const int* c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
 					if ((c!=*c2 && active[*c2]) || (c==*c2 && !flags[FIXPOINT]))
-						agenda.push(*c2);
+						push(*c2);
 				}
 				// ===================== coarse propagation =========================
 				// reset the old box to the current domains just after propagation
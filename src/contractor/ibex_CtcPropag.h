@@ -17,6 +17,8 @@
 #include "ibex_DirectedHyperGraph.h"
 #include "ibex_Array.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -41,10 +43,12 @@ public:
 	 *                           reduction is not propagated. The default value is #default_ratio.
 	 * \param incr (optional)  - Whether the propagation works incrementally. This parameter is
 	 *                           only used when contraction is called with an "impact" bool mask.
+	 * \param weighted (optional) - Whether the agenda is ordered by the expected gain of the
+	 *                           contractors (see #weighted). By default, the agenda is a FIFO.
 	 *
 	 * \see #contract(IntervalVector&, const BitSet&).
 	 */
-	CtcPropag(const Array<Ctc>& cl, double ratio=default_ratio, bool incr=false);
+	CtcPropag(const Array<Ctc>& cl, double ratio=default_ratio, bool incr=false, bool weighted=false);
 
 	/**
 	 * \brief Enforces propagation (e.g.: HC4 or BOX) fitering.
@@ -71,6 +75,17 @@ public:
 	/** Accumulate residual contractions? */
 	bool accumulate;
 
+	/**
+	 * \brief Agenda ordered by expected gain.
+	 *
+	 * For each contractor, the mean relative reduction of its output
+	 * domains is learned online (exponential moving average over its
+	 * calls, also across calls to #contract). The contractor with the
+	 * highest expected gain in the agenda is called first (contractors
+	 * with the same gain are called in FIFO order).
+	 */
+	const bool weighted;
+
 	/** Default ratio used by propagation, set to 0.1. */
 	static const double default_ratio;
 
@@ -87,6 +102,19 @@ protected:
 
 	BitSet active;      // mark active sub-contractors
 
+	IntervalVector old_box; // domains before contraction (see contract)
+
+	WeightedAgenda wagenda; // propagation agenda (if weighted)
+
+	std::vector<double> gain; // expected gain of each contractor (if weighted)
+
+	std::vector<double> diam; // diameters before contraction (if weighted)
+
+	/* Push a contractor in the agenda. */
+	void push(int c);
+
+	/* Update the expected gain of a contractor after a call. */
+	void update_weight(int c, const IntervalVector& box);
 
 };
 
@@ -11,6 +11,8 @@
 #include "ibex_CtcUnion.h"
 #include "ibex_CtcFwdBwd.h"
 
+#include <vector>
+
 namespace ibex {
 
 CtcUnion::CtcUnion(const Array<Ctc>& list) : Ctc(list), list(list), own_sys(NULL) {
@@ -144,6 +146,35 @@ void CtcUnion::contract(IntervalVector& box) {
 	}
 
 	box = result;
+}
+
+void CtcUnion::contract_batch(IntervalVector* boxes, int n) {
+	if (list.size()==1) {
+		list[0].contract_batch(boxes,n);
+		return;
+	}
+
+	std::vector<IntervalVector> savebox;
+	std::vector<IntervalVector> result;
+	savebox.reserve(n);
+	result.reserve(n);
+	for (int k=0; k<n; k++) {
+		savebox.push_back(boxes[k]);
+		result.push_back(IntervalVector::empty(boxes[k].size()));
+	}
+
+	// there is no output flag in batch mode: all the
+	// sub-contractors are applied
+	for (int i=0; i<list.size(); i++) {
+		if (i>0)
+			for (int k=0; k<n; k++) boxes[k]=savebox[k];
+
+		list[i].contract_batch(boxes,n);
+
+		for (int k=0; k<n; k++) result[k] |= boxes[k];
+	}
+
+	for (int k=0; k<n; k++) boxes[k]=result[k];
 } // end namespace ibex
 
 }
@@ -141,6 +141,13 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Contract several boxes.
+	 *
+	 * Each sub-contractor is applied to all the boxes at once.
+	 */
+	virtual void contract_batch(IntervalVector* boxes, int n);
+
 	/**
 	 * \brief The list of sub-contractors.
 	 */
@@ -0,0 +1,210 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchEval.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_BatchEval.h"
+
+using namespace std;
+
+namespace ibex {
+
+const int BatchEval::DEFAULT_SIZE=64;
+
+namespace {
+
+// true if the node can be evaluated in batch.
+bool batch_supported(const ExprNode& e) {
+
+	if (dynamic_cast<const ExprSymbol*>(&e) || dynamic_cast<const ExprConstant*>(&e))
+		return true;
+
+	if (const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e))
+		// the components must be contiguous in the domain of the argument
+		return idx->index.one_row() || idx->index.all_cols();
+
+	if (const ExprVector* v=dynamic_cast<const ExprVector*>(&e))
+		return v->dim.is_vector();
+
+	if (dynamic_cast<const ExprTrans*>(&e))
+		return false;
+
+	if (const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e))
+		return u->dim.is_scalar() && u->expr.dim.is_scalar();
+
+	if (const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e))
+		return b->dim.is_scalar() && b->left.dim.is_scalar() && b->right.dim.is_scalar();
+
+	return false; // apply, chi
+}
+
+}
+
+BatchEval::BatchEval(EvalContext& ctx, int size) : ctx(ctx), f(ctx.f), size(size), is_supported(true),
+		nb(0), off(f.nb_nodes()), _lb(NULL), _ub(NULL) {
+
+	int nb_comp=0;
+
+	// subnodes have higher indices so the argument
+	// of an index node is always allocated first.
+	for (int i=f.nb_nodes()-1; i>=0; i--) {
+		const ExprNode& e=f.node(i);
+
+		if (!batch_supported(e)) {
+			is_supported=false;
+			return;
+		}
+
+		if (const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e)) {
+			int x=f.nodes.rank(idx->expr);
+			off[i]=off[x]+idx->index.first_row()*idx->expr.dim.nb_cols()+idx->index.first_col();
+		} else {
+			off[i]=nb_comp;
+			nb_comp+=e.dim.size();
+		}
+	}
+
+	_lb=new double[nb_comp*size];
+	_ub=new double[nb_comp*size];
+	empty.resize(size);
+}
+
+BatchEval::~BatchEval() {
+	if (_lb) {
+		delete[] _lb;
+		delete[] _ub;
+	}
+}
+
+void BatchEval::eval(const IntervalVector* boxes, IntervalVector* images, int n) {
+
+	if (!is_supported) {
+		for (int k=0; k<n; k++)
+			images[k]=f.eval_vector(boxes[k],ctx);
+		return;
+	}
+
+	int m=f.expr().dim.size();
+
+	for (int k0=0; k0<n; k0+=size) {
+		forward(boxes+k0, n-k0<size? n-k0 : size);
+
+		for (int k=0; k<nb; k++) {
+			IntervalVector& img=images[k0+k];
+			if (empty[k])
+				img.set_empty();
+			else
+				for (int c=0; c<m; c++)
+					img[c]=Interval(lb(0,c)[k],ub(0,c)[k]);
+		}
+	}
+}
+
+void BatchEval::forward(const IntervalVector* boxes, int n) {
+	assert(is_supported);
+	assert(n<=size);
+
+	nb=n;
+
+	for (int k=0; k<nb; k++)
+		empty[k]=boxes[k].is_empty();
+
+	for (int s=0, v=0; s<f.nb_arg(); s++) {
+		int y=f.nodes.rank(f.arg(s));
+		for (int c=0; c<f.arg(s).dim.size(); c++, v++) {
+			double *l=lb(y,c), *u=ub(y,c);
+			for (int k=0; k<nb; k++) {
+				if (empty[k]) {
+					l[k]=POS_INFINITY;
+					u[k]=NEG_INFINITY;
+				} else {
+					l[k]=boxes[k][v].lb();
+					u[k]=boxes[k][v].ub();
+				}
+			}
+		}
+	}
+
+	f.forward<BatchEval>(*this);
+}
+
+void BatchEval::read_boxes(IntervalVector* boxes) {
+
+	for (int s=0, v=0; s<f.nb_arg(); s++) {
+		int y=f.nodes.rank(f.arg(s));
+		for (int c=0; c<f.arg(s).dim.size(); c++, v++) {
+			if (!f.used(v)) continue;
+			const double *l=lb(y,c), *u=ub(y,c);
+			for (int k=0; k<nb; k++)
+				if (!empty[k]) boxes[k][v]=Interval(l[k],u[k]);
+		}
+	}
+
+	for (int k=0; k<nb; k++)
+		if (empty[k]) boxes[k].set_empty();
+}
+
+void BatchEval::vector_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	int j=0;
+
+	for (int i=0; i<v.length(); i++) {
+		for (int c=0; c<v.arg(i).dim.size(); c++, j++) {
+			const double *xl=lb(x[i],c), *xu=ub(x[i],c);
+			double *yl=lb(y,j), *yu=ub(y,j);
+			for (int k=0; k<nb; k++) {
+				yl[k]=xl[k];
+				yu[k]=xu[k];
+			}
+		}
+	}
+
+	assert(j==v.dim.size());
+}
+
+void BatchEval::cst_fwd(int y) {
+	// the domain of a constant may have been contracted by
+	// a backward phase: it is reset each time.
+	const ExprConstant& c = (const ExprConstant&) f.node(y);
+
+	for (int j=0; j<c.dim.size(); j++) {
+		Interval x;
+		switch (c.type()) {
+		case Dim::SCALAR:       x=c.get_value();                                      break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:   x=c.get_vector_value()[j];                            break;
+		case Dim::MATRIX:       x=c.get_matrix_value()[j/c.dim.nb_cols()][j%c.dim.nb_cols()]; break;
+		}
+		double *l=lb(y,j), *u=ub(y,j);
+		for (int k=0; k<nb; k++) {
+			l[k]=x.lb();
+			u[k]=x.ub();
+		}
+	}
+}
+
+void BatchEval::minus_fwd(int x, int y) {
+	const double *xl=lb(x), *xu=ub(x);
+	double *yl=lb(y), *yu=ub(y);
+	for (int k=0; k<nb; k++) {
+		yl[k]=-xu[k];
+		yu[k]=-xl[k];
+	}
+}
+
+void BatchEval::power_fwd(int x, int y, int p) {
+	const double *xl=lb(x), *xu=ub(x);
+	double *yl=lb(y), *yu=ub(y);
+	for (int k=0; k<nb; k++)
+		set(yl,yu,k,pow(Interval(xl[k],xu[k]),p));
+}
+
+} // namespace ibex
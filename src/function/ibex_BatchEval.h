@@ -0,0 +1,223 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchEval.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_BATCH_EVAL_H__
+#define __IBEX_BATCH_EVAL_H__
+
+#include "ibex_FwdAlgorithm.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_Exception.h"
+
+#include <vector>
+
+namespace ibex {
+
+class Function;
+class EvalContext;
+class BatchHC4Revise;
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Evaluation of a function on several boxes at once.
+ *
+ * The boxes are processed by blocks of #size boxes. For each block, the
+ * operations of the function are executed once, each operation being
+ * applied to all the boxes of the block in an inner loop.
+ *
+ * The domains of the nodes are stored as "structure of arrays": for each
+ * component of a node, the lower bounds of all the boxes of the block
+ * are contiguous, and so are the upper bounds. Index nodes (like x[i])
+ * are not stored: they are views on the domain of their argument.
+ *
+ * Only the operators on scalars, vectors of expressions, indices, symbols
+ * and constants are handled this way. If the function contains another
+ * operator (e.g., matrix operators or applied functions), see
+ * #is_supported, the boxes are simply evaluated one by one with the
+ * evaluator of the context.
+ */
+class BatchEval : public FwdAlgorithm {
+public:
+	/**
+	 * \brief Build the batch evaluator of a context.
+	 *
+	 * \param size - the number of boxes processed in one block.
+	 */
+	BatchEval(EvalContext& ctx, int size=DEFAULT_SIZE);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~BatchEval();
+
+	/**
+	 * \brief Calculate f(boxes[k]) for k=0...n-1 and store the result in images[k].
+	 *
+	 * Each image is given in vector form, i.e., images[k] must be of
+	 * size f.image_dim() (see #ibex::Function::eval_vector).
+	 * An image is empty if the box is empty or outside the definition
+	 * domain of the function.
+	 */
+	void eval(const IntervalVector* boxes, IntervalVector* images, int n);
+
+	/**
+	 * \brief Default number of boxes processed in one block (64).
+	 */
+	static const int DEFAULT_SIZE;
+
+	/** The context. */
+	EvalContext& ctx;
+
+	/** The function. */
+	Function& f;
+
+	/** Number of boxes processed in one block. */
+	const int size;
+
+	/** True iff all the operators of the function are handled in batch. */
+	bool is_supported;
+
+public: // because called from CompiledFunction
+
+	       void vector_fwd (int* x, int y);
+	inline void apply_fwd  (int*, int)             { not_implemented("BatchEval with applied functions"); }
+	inline void idx_fwd    (int, int)              { /* nothing to do (view) */ }
+	inline void idx_cp_fwd (int, int)              { /* nothing to do (view) */ }
+	inline void symbol_fwd (int)                   { /* nothing to do */ }
+	       void cst_fwd    (int y);
+	inline void chi_fwd    (int, int, int, int)    { not_implemented("BatchEval with \"chi\""); }
+	inline void add_fwd    (int x1, int x2, int y) { binary_fwd<operator+>(x1,x2,y); }
+	inline void mul_fwd    (int x1, int x2, int y) { binary_fwd<operator*>(x1,x2,y); }
+	inline void sub_fwd    (int x1, int x2, int y) { binary_fwd<operator- >(x1,x2,y); }
+	inline void div_fwd    (int x1, int x2, int y) { binary_fwd<operator/>(x1,x2,y); }
+	inline void max_fwd    (int x1, int x2, int y) { binary_fwd<max>(x1,x2,y); }
+	inline void min_fwd    (int x1, int x2, int y) { binary_fwd<min>(x1,x2,y); }
+	inline void atan2_fwd  (int x1, int x2, int y) { binary_fwd<atan2>(x1,x2,y); }
+	       void minus_fwd  (int x, int y);
+	inline void trans_V_fwd(int, int)              { not_implemented("BatchEval with transpose"); }
+	inline void trans_M_fwd(int, int)              { not_implemented("BatchEval with transpose"); }
+	inline void sign_fwd   (int x, int y)          { unary_fwd<sign>(x,y); }
+	inline void abs_fwd    (int x, int y)          { unary_fwd<abs>(x,y); }
+	       void power_fwd  (int x, int y, int p);
+	inline void sqr_fwd    (int x, int y)          { unary_fwd<sqr>(x,y); }
+	inline void sqrt_fwd   (int x, int y)          { unary_fwd<sqrt>(x,y); }
+	inline void exp_fwd    (int x, int y)          { unary_fwd<exp>(x,y); }
+	inline void log_fwd    (int x, int y)          { unary_fwd<log>(x,y); }
+	inline void cos_fwd    (int x, int y)          { unary_fwd<cos>(x,y); }
+	inline void sin_fwd    (int x, int y)          { unary_fwd<sin>(x,y); }
+	inline void tan_fwd    (int x, int y)          { unary_fwd<tan>(x,y); }
+	inline void cosh_fwd   (int x, int y)          { unary_fwd<cosh>(x,y); }
+	inline void sinh_fwd   (int x, int y)          { unary_fwd<sinh>(x,y); }
+	inline void tanh_fwd   (int x, int y)          { unary_fwd<tanh>(x,y); }
+	inline void acos_fwd   (int x, int y)          { unary_fwd<acos>(x,y); }
+	inline void asin_fwd   (int x, int y)          { unary_fwd<asin>(x,y); }
+	inline void atan_fwd   (int x, int y)          { unary_fwd<atan>(x,y); }
+	inline void acosh_fwd  (int x, int y)          { unary_fwd<acosh>(x,y); }
+	inline void asinh_fwd  (int x, int y)          { unary_fwd<asinh>(x,y); }
+	inline void atanh_fwd  (int x, int y)          { unary_fwd<atanh>(x,y); }
+	inline void add_V_fwd  (int, int, int)         { not_implemented("BatchEval with vector operators"); }
+	inline void add_M_fwd  (int, int, int)         { not_implemented("BatchEval with matrix operators"); }
+	inline void mul_SV_fwd (int, int, int)         { not_implemented("BatchEval with vector operators"); }
+	inline void mul_SM_fwd (int, int, int)         { not_implemented("BatchEval with matrix operators"); }
+	inline void mul_VV_fwd (int, int, int)         { not_implemented("BatchEval with vector operators"); }
+	inline void mul_MV_fwd (int, int, int)         { not_implemented("BatchEval with matrix operators"); }
+	inline void mul_VM_fwd (int, int, int)         { not_implemented("BatchEval with matrix operators"); }
+	inline void mul_MM_fwd (int, int, int)         { not_implemented("BatchEval with matrix operators"); }
+	inline void sub_V_fwd  (int, int, int)         { not_implemented("BatchEval with vector operators"); }
+	inline void sub_M_fwd  (int, int, int)         { not_implemented("BatchEval with matrix operators"); }
+
+protected:
+	friend class BatchHC4Revise;
+
+	/*
+	 * Write the boxes in the domains of the symbols
+	 * (n<=size) and run the forward phase.
+	 */
+	void forward(const IntervalVector* boxes, int n);
+
+	/*
+	 * Read the domains of the symbols (after a
+	 * backward phase) and write them in the boxes.
+	 */
+	void read_boxes(IntervalVector* boxes);
+
+	/* Lower bounds of the cth component of node y (for all the boxes). */
+	double* lb(int y, int c=0);
+
+	/* Upper bounds of the cth component of node y (for all the boxes). */
+	double* ub(int y, int c=0);
+
+	/* Store the kth value of a component. */
+	void set(double* l, double* u, int k, const Interval& x);
+
+	template<Interval (*op)(const Interval&)>
+	void unary_fwd(int x, int y);
+
+	template<Interval (*op)(const Interval&, const Interval&)>
+	void binary_fwd(int x1, int x2, int y);
+
+	/* Number of boxes in the current block. */
+	int nb;
+
+	/* First component of each node in the arrays (row index). */
+	std::vector<int> off;
+
+	/* Lower and upper bounds. */
+	double* _lb;
+	double* _ub;
+
+	/* empty[k] is true if the kth box of the block is empty
+	 * (or outside of the definition domain). */
+	std::vector<char> empty;
+
+private:
+	BatchEval(const BatchEval&);            // forbidden
+	BatchEval& operator=(const BatchEval&); // forbidden
+};
+
+/*================================== inline implementations ========================================*/
+
+inline double* BatchEval::lb(int y, int c) {
+	return _lb + (off[y]+c)*size;
+}
+
+inline double* BatchEval::ub(int y, int c) {
+	return _ub + (off[y]+c)*size;
+}
+
+inline void BatchEval::set(double* l, double* u, int k, const Interval& x) {
+	if (x.is_empty()) {
+		l[k]=POS_INFINITY;
+		u[k]=NEG_INFINITY;
+		empty[k]=true;
+	} else {
+		l[k]=x.lb();
+		u[k]=x.ub();
+	}
+}
+
+template<Interval (*op)(const Interval&)>
+inline void BatchEval::unary_fwd(int x, int y) {
+	const double *xl=lb(x), *xu=ub(x);
+	double *yl=lb(y), *yu=ub(y);
+	for (int k=0; k<nb; k++)
+		set(yl,yu,k,op(Interval(xl[k],xu[k])));
+}
+
+template<Interval (*op)(const Interval&, const Interval&)>
+inline void BatchEval::binary_fwd(int x1, int x2, int y) {
+	const double *xl1=lb(x1), *xu1=ub(x1), *xl2=lb(x2), *xu2=ub(x2);
+	double *yl=lb(y), *yu=ub(y);
+	for (int k=0; k<nb; k++)
+		set(yl,yu,k,op(Interval(xl1[k],xu1[k]),Interval(xl2[k],xu2[k])));
+}
+
+} // namespace ibex
+
+#endif // __IBEX_BATCH_EVAL_H__
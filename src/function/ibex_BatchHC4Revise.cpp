@@ -0,0 +1,112 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchHC4Revise.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_BatchHC4Revise.h"
+
+using namespace std;
+
+namespace ibex {
+
+BatchHC4Revise::BatchHC4Revise(BatchEval& e) : f(e.f), eval(e), done(e.size) {
+
+}
+
+void BatchHC4Revise::proj(const Domain& y, IntervalVector* boxes, int n) {
+
+	if (!eval.is_supported) {
+		for (int k=0; k<n; k++)
+			f.backward(y,boxes[k],eval.ctx);
+		return;
+	}
+
+	// components of y (in the same order as in the domain of the root node)
+	int m=y.dim.size();
+	vector<Interval> yc(m);
+	for (int c=0; c<m; c++) {
+		switch (y.dim.type()) {
+		case Dim::SCALAR:       yc[c]=y.i();                                        break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:   yc[c]=y.v()[c];                                     break;
+		case Dim::MATRIX:       yc[c]=y.m()[c/y.dim.nb_cols()][c%y.dim.nb_cols()]; break;
+		}
+	}
+
+	for (int k0=0; k0<n; k0+=eval.size) {
+		eval.forward(boxes+k0, n-k0<eval.size? n-k0 : eval.size);
+
+		for (int k=0; k<eval.nb; k++) {
+			done[k]=eval.empty[k];
+			if (done[k]) continue;
+
+			bool inner=true;
+			for (int c=0; inner && c<m; c++)
+				inner=Interval(eval.lb(0,c)[k],eval.ub(0,c)[k]).is_subset(yc[c]);
+
+			if (inner) {
+				done[k]=true; // inactive: the box is not contracted
+				continue;
+			}
+
+			for (int c=0; c<m && !done[k]; c++) {
+				double *l=eval.lb(0,c), *u=eval.ub(0,c);
+				set(l,u,k,Interval(l[k],u[k]) & yc[c]);
+			}
+		}
+
+		f.backward<BatchHC4Revise>(*this);
+
+		eval.read_boxes(boxes+k0);
+	}
+}
+
+void BatchHC4Revise::vector_bwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	int j=0;
+
+	for (int i=0; i<v.length(); i++) {
+		for (int c=0; c<v.arg(i).dim.size(); c++, j++) {
+			const double *yl=eval.lb(y,j), *yu=eval.ub(y,j);
+			double *xl=eval.lb(x[i],c), *xu=eval.ub(x[i],c);
+			for (int k=0; k<eval.nb; k++) {
+				if (done[k]) continue;
+				set(xl,xu,k,Interval(xl[k],xu[k]) & Interval(yl[k],yu[k]));
+			}
+		}
+	}
+
+	assert(j==v.dim.size());
+}
+
+void BatchHC4Revise::minus_bwd(int x, int y) {
+	const double *yl=eval.lb(y), *yu=eval.ub(y);
+	double *xl=eval.lb(x), *xu=eval.ub(x);
+	for (int k=0; k<eval.nb; k++) {
+		if (done[k]) continue;
+		set(xl,xu,k,Interval(xl[k],xu[k]) & -Interval(yl[k],yu[k]));
+	}
+}
+
+void BatchHC4Revise::power_bwd(int x, int y, int p) {
+	const double *yl=eval.lb(y), *yu=eval.ub(y);
+	double *xl=eval.lb(x), *xu=eval.ub(x);
+	for (int k=0; k<eval.nb; k++) {
+		if (done[k]) continue;
+		Interval _x(xl[k],xu[k]);
+		if (bwd_pow(Interval(yl[k],yu[k]),p,_x))
+			set(xl,xu,k,_x);
+		else
+			set(xl,xu,k,Interval::EMPTY_SET);
+	}
+}
+
+} // namespace ibex
@@ -0,0 +1,176 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchHC4Revise.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_BATCH_HC4REVISE_H__
+#define __IBEX_BATCH_HC4REVISE_H__
+
+#include "ibex_BwdAlgorithm.h"
+#include "ibex_BatchEval.h"
+#include "ibex_Domain.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Forward-backward algorithm on several boxes at once.
+ *
+ * Works on the domains of a #ibex::BatchEval: the backward phase is run
+ * once per block of boxes, each operation contracting its arguments
+ * for all the boxes of the block.
+ *
+ * The result is the same as calling #ibex::HC4Revise::proj on each box.
+ */
+class BatchHC4Revise : public BwdAlgorithm {
+public:
+	/**
+	 * \brief Build the algorithm on the domains of a batch evaluator.
+	 */
+	BatchHC4Revise(BatchEval& e);
+
+	/**
+	 * \brief Project f(x)=y onto boxes[k], for k=0...n-1.
+	 *
+	 * A box outside of the definition domain of f is set to the empty set.
+	 */
+	void proj(const Domain& y, IntervalVector* boxes, int n);
+
+	/** The function. */
+	Function& f;
+
+	/** The batch evaluator. */
+	BatchEval& eval;
+
+public: // because called from CompiledFunction
+	inline void idx_bwd    (int, int)              { /* nothing to do (view) */ }
+	inline void idx_cp_bwd (int, int)              { /* nothing to do (view) */ }
+	       void vector_bwd (int* x, int y);
+	inline void symbol_bwd (int)                   { /* nothing to do */ }
+	inline void cst_bwd    (int)                   { /* nothing to do */ }
+	inline void apply_bwd  (int*, int)             { not_implemented("BatchHC4Revise with applied functions"); }
+	inline void chi_bwd    (int, int, int, int)    { not_implemented("BatchHC4Revise with \"chi\""); }
+	inline void add_bwd    (int x1, int x2, int y) { binary_bwd<bwd_add>(x1,x2,y); }
+	inline void mul_bwd    (int x1, int x2, int y) { binary_bwd<bwd_mul>(x1,x2,y); }
+	inline void sub_bwd    (int x1, int x2, int y) { binary_bwd<bwd_sub>(x1,x2,y); }
+	inline void div_bwd    (int x1, int x2, int y) { binary_bwd<bwd_div>(x1,x2,y); }
+	inline void max_bwd    (int x1, int x2, int y) { binary_bwd<bwd_max>(x1,x2,y); }
+	inline void min_bwd    (int x1, int x2, int y) { binary_bwd<bwd_min>(x1,x2,y); }
+	inline void atan2_bwd  (int x1, int x2, int y) { binary_bwd<bwd_atan2>(x1,x2,y); }
+	       void minus_bwd  (int x, int y);
+	inline void trans_V_bwd(int, int)              { not_implemented("BatchHC4Revise with transpose"); }
+	inline void trans_M_bwd(int, int)              { not_implemented("BatchHC4Revise with transpose"); }
+	inline void sign_bwd   (int x, int y)          { unary_bwd<bwd_sign>(x,y); }
+	inline void abs_bwd    (int x, int y)          { unary_bwd<bwd_abs>(x,y); }
+	       void power_bwd  (int x, int y, int p);
+	inline void sqr_bwd    (int x, int y)          { unary_bwd<bwd_sqr>(x,y); }
+	inline void sqrt_bwd   (int x, int y)          { unary_bwd<bwd_sqrt>(x,y); }
+	inline void exp_bwd    (int x, int y)          { unary_bwd<bwd_exp>(x,y); }
+	inline void log_bwd    (int x, int y)          { unary_bwd<bwd_log>(x,y); }
+	inline void cos_bwd    (int x, int y)          { unary_bwd<bwd_cos>(x,y); }
+	inline void sin_bwd    (int x, int y)          { unary_bwd<bwd_sin>(x,y); }
+	inline void tan_bwd    (int x, int y)          { unary_bwd<bwd_tan>(x,y); }
+	inline void cosh_bwd   (int x, int y)          { unary_bwd<bwd_cosh>(x,y); }
+	inline void sinh_bwd   (int x, int y)          { unary_bwd<bwd_sinh>(x,y); }
+	inline void tanh_bwd   (int x, int y)          { unary_bwd<bwd_tanh>(x,y); }
+	inline void acos_bwd   (int x, int y)          { unary_bwd<bwd_acos>(x,y); }
+	inline void asin_bwd   (int x, int y)          { unary_bwd<bwd_asin>(x,y); }
+	inline void atan_bwd   (int x, int y)          { unary_bwd<bwd_atan>(x,y); }
+	inline void acosh_bwd  (int x, int y)          { unary_bwd<bwd_acosh>(x,y); }
+	inline void asinh_bwd  (int x, int y)          { unary_bwd<bwd_asinh>(x,y); }
+	inline void atanh_bwd  (int x, int y)          { unary_bwd<bwd_atanh>(x,y); }
+	inline void add_V_bwd  (int, int, int)         { not_implemented("BatchHC4Revise with vector operators"); }
+	inline void add_M_bwd  (int, int, int)         { not_implemented("BatchHC4Revise with matrix operators"); }
+	inline void mul_SV_bwd (int, int, int)         { not_implemented("BatchHC4Revise with vector operators"); }
+	inline void mul_SM_bwd (int, int, int)         { not_implemented("BatchHC4Revise with matrix operators"); }
+	inline void mul_VV_bwd (int, int, int)         { not_implemented("BatchHC4Revise with vector operators"); }
+	inline void mul_MV_bwd (int, int, int)         { not_implemented("BatchHC4Revise with matrix operators"); }
+	inline void mul_VM_bwd (int, int, int)         { not_implemented("BatchHC4Revise with matrix operators"); }
+	inline void mul_MM_bwd (int, int, int)         { not_implemented("BatchHC4Revise with matrix operators"); }
+	inline void sub_V_bwd  (int, int, int)         { not_implemented("BatchHC4Revise with vector operators"); }
+	inline void sub_M_bwd  (int, int, int)         { not_implemented("BatchHC4Revise with matrix operators"); }
+
+protected:
+	/* Store the kth value of a component (the box
+	 * is marked as done if x is empty). */
+	void set(double* l, double* u, int k, const Interval& x);
+
+	template<bool (*bwd)(const Interval&, Interval&)>
+	void unary_bwd(int x, int y);
+
+	template<bool (*bwd)(const Interval&, Interval&, Interval&)>
+	void binary_bwd(int x1, int x2, int y);
+
+	/* done[k] is true if the kth box of the block is either
+	 * empty or does not require contraction (inactive). */
+	std::vector<char> done;
+
+private:
+	BatchHC4Revise(const BatchHC4Revise&);            // forbidden
+	BatchHC4Revise& operator=(const BatchHC4Revise&); // forbidden
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void BatchHC4Revise::set(double* l, double* u, int k, const Interval& x) {
+	if (x.is_empty()) {
+		eval.empty[k]=true;
+		done[k]=true;
+	} else {
+		l[k]=x.lb();
+		u[k]=x.ub();
+	}
+}
+
+template<bool (*bwd)(const Interval&, Interval&)>
+inline void BatchHC4Revise::unary_bwd(int x, int y) {
+	const double *yl=eval.lb(y), *yu=eval.ub(y);
+	double *xl=eval.lb(x), *xu=eval.ub(x);
+	for (int k=0; k<eval.nb; k++) {
+		if (done[k]) continue;
+		Interval _x(xl[k],xu[k]);
+		if (bwd(Interval(yl[k],yu[k]),_x))
+			set(xl,xu,k,_x);
+		else
+			set(xl,xu,k,Interval::EMPTY_SET);
+	}
+}
+
+template<bool (*bwd)(const Interval&, Interval&, Interval&)>
+inline void BatchHC4Revise::binary_bwd(int x1, int x2, int y) {
+	const double *yl=eval.lb(y), *yu=eval.ub(y);
+	double *xl1=eval.lb(x1), *xu1=eval.ub(x1), *xl2=eval.lb(x2), *xu2=eval.ub(x2);
+
+	if (xl1==xl2) {
+		// same domain (e.g., x*x): the same object
+		// must be contracted twice, as in HC4Revise.
+		for (int k=0; k<eval.nb; k++) {
+			if (done[k]) continue;
+			Interval _x(xl1[k],xu1[k]);
+			if (bwd(Interval(yl[k],yu[k]),_x,_x))
+				set(xl1,xu1,k,_x);
+			else
+				set(xl1,xu1,k,Interval::EMPTY_SET);
+		}
+	} else {
+		for (int k=0; k<eval.nb; k++) {
+			if (done[k]) continue;
+			Interval _x1(xl1[k],xu1[k]);
+			Interval _x2(xl2[k],xu2[k]);
+			if (bwd(Interval(yl[k],yu[k]),_x1,_x2)) {
+				set(xl1,xu1,k,_x1);
+				set(xl2,xu2,k,_x2);
+			} else
+				set(xl1,xu1,k,Interval::EMPTY_SET);
+		}
+	}
+}
+
+} // namespace ibex
+
+#endif // __IBEX_BATCH_HC4REVISE_H__
@@ -21,6 +21,16 @@ namespace ibex {
  * \brief Interface for backward Algorithms.
  */
 class BwdAlgorithm {
+public:
+	/**
+	 * \brief True if an empty domain has occurred.
+	 *
+	 * Checked by #ibex::CompiledFunction after each node: the backward phase
+	 * stops as soon as it returns true. Always false by default. A subclass
+	 * redefines it to signal that the constraint is refuted without throwing
+	 * an exception.
+	 */
+	bool bwd_empty() const { return false; }
 
 protected:
 	/** TO BE DEFINED (by the subclass) */
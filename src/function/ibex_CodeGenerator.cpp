@@ -0,0 +1,499 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CodeGenerator.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_System.h"
+#include "ibex_CodeGenerator.h"
+
+#include <sstream>
+#include <cstdio>
+#include <cctype>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// true if the node can be translated (same as BatchEval).
+bool code_supported(const ExprNode& e) {
+
+	if (dynamic_cast<const ExprSymbol*>(&e) || dynamic_cast<const ExprConstant*>(&e))
+		return true;
+
+	if (const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e))
+		// the components must be contiguous in the domain of the argument
+		return idx->index.one_row() || idx->index.all_cols();
+
+	if (const ExprVector* v=dynamic_cast<const ExprVector*>(&e))
+		return v->dim.is_vector();
+
+	if (dynamic_cast<const ExprTrans*>(&e))
+		return false;
+
+	if (const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e))
+		return u->dim.is_scalar() && u->expr.dim.is_scalar();
+
+	if (const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e))
+		return b->dim.is_scalar() && b->left.dim.is_scalar() && b->right.dim.is_scalar();
+
+	return false; // apply, chi
+}
+
+// exact C++ literal of a double
+// (17 significant digits are enough to read back the same double;
+// hexadecimal literals are not valid in C++11)
+string literal(double x) {
+	if (x==POS_INFINITY) return "POS_INFINITY";
+	if (x==NEG_INFINITY) return "NEG_INFINITY";
+	char buf[64];
+	sprintf(buf,"%.17g",x);
+	string s(buf);
+	// make it a floating-point literal
+	if (s.find_first_of(".e")==string::npos) s+=".0";
+	return s;
+}
+
+// C++ string literal
+string quote(const string& s) {
+	stringstream ss;
+	ss << '"';
+	for (size_t i=0; i<s.size(); i++) {
+		switch(s[i]) {
+		case '"' : ss << "\\\""; break;
+		case '\\': ss << "\\\\"; break;
+		case '\n': ss << "\\n";  break;
+		default  : ss << s[i];
+		}
+	}
+	ss << '"';
+	return ss.str();
+}
+
+}
+
+CodeGenerator::CodeGenerator(const Function& f, const string& prefix) : f(f), prefix(prefix), is_supported(true),
+		os(NULL), grad(false), off(f.nb_nodes()), nb_comp(0) {
+
+	// subnodes have higher indices so the argument
+	// of an index node is always allocated first.
+	for (int i=f.nb_nodes()-1; i>=0; i--) {
+		const ExprNode& e=f.node(i);
+
+		if (!code_supported(e)) {
+			is_supported=false;
+			return;
+		}
+
+		if (const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e)) {
+			int x=f.nodes.rank(idx->expr);
+			off[i]=off[x]+idx->index.first_row()*idx->expr.dim.nb_cols()+idx->index.first_col();
+		} else {
+			off[i]=nb_comp;
+			nb_comp+=e.dim.size();
+		}
+	}
+}
+
+string CodeGenerator::d(int y, int c) const {
+	stringstream s;
+	s << "d[" << off[y]+c << "]";
+	return s.str();
+}
+
+string CodeGenerator::g(int y, int c) const {
+	stringstream s;
+	s << "g[" << off[y]+c << "]";
+	return s.str();
+}
+
+void CodeGenerator::header(ostream& os) {
+	os << "// Generated by IBEX (see ibex::CodeGenerator). Do not edit.\n\n";
+	os << "#include \"ibex_Interval.h\"\n\n";
+	os << "using namespace ibex;\n\n";
+}
+
+void CodeGenerator::generate(const Function& f, ostream& os, const string& prefix) {
+	CodeGenerator gen(f,prefix);
+	if (!gen.is_supported)
+		not_implemented("code generation for this function");
+	header(os);
+	gen.kernels(os);
+}
+
+void CodeGenerator::generate(const System& sys, ostream& os) {
+	header(os);
+
+	if (sys.nb_ctr>0) {
+		CodeGenerator gen(sys.f,"f");
+		if (gen.is_supported) gen.kernels(os);
+	}
+
+	if (sys.goal) {
+		CodeGenerator gen(*sys.goal,"goal");
+		if (gen.is_supported) gen.kernels(os);
+	}
+
+	for (int i=0; i<sys.nb_ctr; i++) {
+		stringstream p;
+		p << "c" << i;
+		CodeGenerator gen(sys.ctrs[i].f,p.str());
+		if (gen.is_supported) gen.kernels(os);
+	}
+}
+
+void CodeGenerator::load(System& sys, const char* file) {
+
+	if (sys.nb_ctr>0 && CodeGenerator(sys.f).is_supported)
+		sys.f.load_code(file,"f");
+
+	if (sys.goal && CodeGenerator(*sys.goal).is_supported)
+		sys.goal->load_code(file,"goal");
+
+	for (int i=0; i<sys.nb_ctr; i++) {
+		stringstream p;
+		p << "c" << i;
+		if (CodeGenerator(sys.ctrs[i].f).is_supported)
+			sys.ctrs[i].f.load_code(file,p.str().c_str());
+	}
+}
+
+void CodeGenerator::kernels(ostream& os) {
+	assert(is_supported);
+
+	os << "extern \"C\" const char* " << prefix << "_signature() {\n";
+	os << "\treturn " << quote(GeneratedCode::signature(f)) << ";\n";
+	os << "}\n\n";
+
+	eval_kernel(os);
+	proj_kernel(os);
+	jacobian_kernel(os);
+}
+
+void CodeGenerator::read_box(ostream& os) {
+	for (int s=0, v=0; s<f.nb_arg(); s++) {
+		int y=f.nodes.rank(f.arg(s));
+		for (int c=0; c<f.arg(s).dim.size(); c++, v++)
+			if (f.used(v)) os << '\t' << d(y,c) << "=x[" << v << "];\n";
+	}
+}
+
+void CodeGenerator::eval_kernel(ostream& os) {
+	int m=f.image_dim();
+
+	os << "extern \"C\" bool " << prefix << "_eval(const Interval* x, Interval* y) {\n";
+	os << "\tInterval d[" << nb_comp << "];\n";
+	read_box(os);
+
+	this->os=&os;
+	f.forward<CodeGenerator>(*this);
+
+	for (int c=0; c<m; c++)
+		os << "\tif (" << d(0,c) << ".is_empty()) return false;\n";
+	for (int c=0; c<m; c++)
+		os << "\ty[" << c << "]=" << d(0,c) << ";\n";
+	os << "\treturn true;\n";
+	os << "}\n\n";
+}
+
+void CodeGenerator::proj_kernel(ostream& os) {
+	int m=f.image_dim();
+
+	os << "extern \"C\" bool " << prefix << "_proj(const Interval* y, Interval* x, bool* is_inner) {\n";
+	os << "\tInterval d[" << nb_comp << "];\n";
+	read_box(os);
+
+	this->os=&os;
+	grad=false;
+	f.forward<CodeGenerator>(*this);
+
+	for (int c=0; c<m; c++)
+		os << "\tif (" << d(0,c) << ".is_empty()) return false;\n";
+
+	os << "\t*is_inner=";
+	for (int c=0; c<m; c++)
+		os << (c>0? " && " : "") << d(0,c) << ".is_subset(y[" << c << "])";
+	os << ";\n";
+	os << "\tif (*is_inner) return true;\n";
+
+	for (int c=0; c<m; c++)
+		os << "\tif ((" << d(0,c) << " &= y[" << c << "]).is_empty()) return false;\n";
+
+	f.backward<CodeGenerator>(*this);
+
+	for (int s=0, v=0; s<f.nb_arg(); s++) {
+		int y=f.nodes.rank(f.arg(s));
+		for (int c=0; c<f.arg(s).dim.size(); c++, v++)
+			if (f.used(v)) os << "\tx[" << v << "]=" << d(y,c) << ";\n";
+	}
+	os << "\treturn true;\n";
+	os << "}\n\n";
+}
+
+void CodeGenerator::jacobian_kernel(ostream& os) {
+	int m=f.image_dim();
+
+	os << "extern \"C\" bool " << prefix << "_jacobian(const Interval* x, Interval* const* J) {\n";
+	os << "\tInterval d[" << nb_comp << "];\n";
+	os << "\tInterval g[" << nb_comp << "];\n";
+	read_box(os);
+
+	this->os=&os;
+	grad=false;
+	f.forward<CodeGenerator>(*this);
+
+	for (int c=0; c<m; c++)
+		os << "\tif (" << d(0,c) << ".is_empty()) return false;\n";
+
+	for (int i=0; i<m; i++)
+		row_sweep(os,i);
+
+	os << "\treturn true;\n";
+	os << "}\n\n";
+}
+
+void CodeGenerator::row_sweep(ostream& os, int i) {
+
+	// The body is written first to know which derivatives
+	// are non-zero (the other nodes are skipped, like the
+	// nodes outside of the sub-expression in Gradient).
+	stringstream body;
+
+	// same seed as Gradient: if the function is a vector of
+	// expressions, the row is seeded in the ith component
+	// (the backward of the root node is skipped).
+	int seed=off[0]+i;
+
+	const ExprVector* vec=dynamic_cast<const ExprVector*>(&f.expr());
+
+	if (vec && vec->dim.is_vector()) {
+		for (int k=0, j=0; k<vec->length(); k++) {
+			int n=vec->arg(k).dim.size();
+			if (i<j+n) {
+				seed=off[f.nodes.rank(vec->arg(k))]+i-j;
+				break;
+			}
+			j+=n;
+		}
+	}
+
+	nz.assign(nb_comp,0);
+	nz[seed]=1;
+
+	this->os=&body;
+	grad=true;
+	f.backward<CodeGenerator>(*this);
+	grad=false;
+
+	os << "\t// row " << i << "\n";
+	for (int k=0; k<nb_comp; k++)
+		if (nz[k]) os << "\tg[" << k << "]=" << (k==seed? "1.0" : "0.0") << ";\n";
+
+	os << body.str();
+
+	for (int s=0, v=0; s<f.nb_arg(); s++) {
+		int y=f.nodes.rank(f.arg(s));
+		for (int c=0; c<f.arg(s).dim.size(); c++, v++) {
+			os << "\tJ[" << i << "][" << v << "]=";
+			if (nz[off[y]+c]) os << g(y,c); else os << "0.0";
+			os << ";\n";
+		}
+	}
+}
+
+void CodeGenerator::add_grad(int x, const string& expr) {
+	*os << '\t' << g(x) << " += " << expr << ";\n";
+	nz[off[x]]=1;
+}
+
+void CodeGenerator::vector_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	int j=0;
+
+	for (int i=0; i<v.length(); i++)
+		for (int c=0; c<v.arg(i).dim.size(); c++, j++)
+			*os << '\t' << d(y,j) << "=" << d(x[i],c) << ";\n";
+
+	assert(j==v.dim.size());
+}
+
+void CodeGenerator::cst_fwd(int y) {
+	// the domain of a constant may have been contracted by
+	// a backward phase: it is reset each time.
+	const ExprConstant& c = (const ExprConstant&) f.node(y);
+
+	for (int j=0; j<c.dim.size(); j++) {
+		Interval x;
+		switch (c.type()) {
+		case Dim::SCALAR:       x=c.get_value();                                      break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:   x=c.get_vector_value()[j];                            break;
+		case Dim::MATRIX:       x=c.get_matrix_value()[j/c.dim.nb_cols()][j%c.dim.nb_cols()]; break;
+		}
+		*os << '\t' << d(y,j) << "=";
+		if (x.is_empty())
+			*os << "Interval::EMPTY_SET";
+		else
+			*os << "Interval(" << literal(x.lb()) << "," << literal(x.ub()) << ")";
+		*os << ";\n";
+	}
+}
+
+void CodeGenerator::unary_fwd(const char* op, int x, int y, bool check_empty) {
+	*os << '\t' << d(y) << "=" << op << "(" << d(x) << ");\n";
+	if (check_empty)
+		*os << "\tif (" << d(y) << ".is_empty()) return false;\n";
+}
+
+void CodeGenerator::binary_fwd(const char* op, int x1, int x2, int y) {
+	*os << '\t' << d(y) << "=";
+	if (isalpha(op[0]))
+		*os << op << "(" << d(x1) << "," << d(x2) << ")";
+	else
+		*os << d(x1) << op << d(x2);
+	*os << ";\n";
+}
+
+void CodeGenerator::minus_fwd(int x, int y) {
+	*os << '\t' << d(y) << "=-" << d(x) << ";\n";
+}
+
+void CodeGenerator::power_fwd(int x, int y, int p) {
+	*os << '\t' << d(y) << "=pow(" << d(x) << "," << p << ");\n";
+}
+
+void CodeGenerator::vector_bwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	int j=0;
+
+	for (int i=0; i<v.length(); i++)
+		for (int c=0; c<v.arg(i).dim.size(); c++, j++) {
+			if (grad) {
+				if (!nz[off[y]+j]) continue;
+				*os << '\t' << g(x[i],c) << " += " << g(y,j) << ";\n";
+				nz[off[x[i]]+c]=1;
+			} else
+				*os << "\tif ((" << d(x[i],c) << " &= " << d(y,j) << ").is_empty()) return false;\n";
+		}
+}
+
+void CodeGenerator::unary_bwd(const char* op, int x, int y, const string& df) {
+	if (grad) {
+		if (nz[off[y]]) add_grad(x, g(y)+df);
+	} else
+		*os << "\tif (!bwd_" << op << "(" << d(y) << "," << d(x) << ")) return false;\n";
+}
+
+void CodeGenerator::binary_bwd(const char* op, int x1, int x2, int y) {
+	*os << "\tif (!bwd_" << op << "(" << d(y) << "," << d(x1) << "," << d(x2) << ")) return false;\n";
+}
+
+void CodeGenerator::add_bwd(int x1, int x2, int y) {
+	if (!grad) { binary_bwd("add",x1,x2,y); return; }
+	if (!nz[off[y]]) return;
+	add_grad(x1, g(y));
+	add_grad(x2, g(y));
+}
+
+void CodeGenerator::mul_bwd(int x1, int x2, int y) {
+	if (!grad) { binary_bwd("mul",x1,x2,y); return; }
+	if (!nz[off[y]]) return;
+	add_grad(x1, g(y)+" * "+d(x2));
+	add_grad(x2, g(y)+" * "+d(x1));
+}
+
+void CodeGenerator::sub_bwd(int x1, int x2, int y) {
+	if (!grad) { binary_bwd("sub",x1,x2,y); return; }
+	if (!nz[off[y]]) return;
+	add_grad(x1, g(y));
+	add_grad(x2, "-"+g(y));
+}
+
+void CodeGenerator::div_bwd(int x1, int x2, int y) {
+	if (!grad) { binary_bwd("div",x1,x2,y); return; }
+	if (!nz[off[y]]) return;
+	add_grad(x1, g(y)+" / "+d(x2));
+	add_grad(x2, g(y)+"*(-"+d(x1)+")/sqr("+d(x2)+")");
+}
+
+void CodeGenerator::max_bwd(int x1, int x2, int y) {
+	if (!grad) { binary_bwd("max",x1,x2,y); return; }
+	if (!nz[off[y]]) return;
+	*os << "\t{\n";
+	*os << "\tInterval gx1,gx2;\n";
+	*os << "\tif (" << d(x1) << ".lb() > " << d(x2) << ".ub()) { gx1=Interval::ONE; gx2=Interval::ZERO; }\n";
+	*os << "\telse if (" << d(x2) << ".lb() > " << d(x1) << ".ub()) { gx1=Interval::ZERO; gx2=Interval::ONE; }\n";
+	*os << "\telse { gx1=Interval(0,1); gx2=Interval(0,1); }\n";
+	add_grad(x1, g(y)+" * gx1");
+	add_grad(x2, g(y)+" * gx2");
+	*os << "\t}\n";
+}
+
+void CodeGenerator::min_bwd(int x1, int x2, int y) {
+	if (!grad) { binary_bwd("min",x1,x2,y); return; }
+	if (!nz[off[y]]) return;
+	*os << "\t{\n";
+	*os << "\tInterval gx1,gx2;\n";
+	*os << "\tif (" << d(x1) << ".lb() > " << d(x2) << ".ub()) { gx1=Interval::ZERO; gx2=Interval::ONE; }\n";
+	*os << "\telse if (" << d(x2) << ".lb() > " << d(x1) << ".ub()) { gx1=Interval::ONE; gx2=Interval::ZERO; }\n";
+	*os << "\telse { gx1=Interval(0,1); gx2=Interval(0,1); }\n";
+	add_grad(x1, g(y)+" * gx1");
+	add_grad(x2, g(y)+" * gx2");
+	*os << "\t}\n";
+}
+
+void CodeGenerator::atan2_bwd(int x1, int x2, int y) {
+	if (!grad) { binary_bwd("atan2",x1,x2,y); return; }
+	if (!nz[off[y]]) return;
+	string den="(sqr("+d(x2)+") + sqr("+d(x1)+"))";
+	add_grad(x1, g(y)+" * "+d(x2)+" / "+den);
+	add_grad(x2, g(y)+" * - "+d(x1)+" / "+den);
+}
+
+void CodeGenerator::minus_bwd(int x, int y) {
+	if (grad) {
+		if (nz[off[y]]) add_grad(x, "-1.0*"+g(y));
+	} else
+		*os << "\tif ((" << d(x) << " &= -" << d(y) << ").is_empty()) return false;\n";
+}
+
+void CodeGenerator::sign_bwd(int x, int y) {
+	if (!grad) { unary_bwd("sign",x,y,""); return; }
+	if (!nz[off[y]]) return;
+	// the derivative is zero if x does not contain 0
+	*os << "\tif (" << d(x) << ".contains(0))";
+	add_grad(x, g(y)+"*Interval::POS_REALS");
+}
+
+void CodeGenerator::abs_bwd(int x, int y) {
+	if (!grad) { unary_bwd("abs",x,y,""); return; }
+	if (!nz[off[y]]) return;
+	*os << "\tif (" << d(x) << ".lb()>=0) " << g(x) << " += 1.0*" << g(y) << ";\n";
+	*os << "\telse if (" << d(x) << ".ub()<=0) " << g(x) << " += -1.0*" << g(y) << ";\n";
+	*os << "\telse";
+	add_grad(x, "Interval(-1,1)*"+g(y));
+}
+
+void CodeGenerator::power_bwd(int x, int y, int p) {
+	if (grad) {
+		if (!nz[off[y]]) return;
+		stringstream s;
+		s << g(y) << " * " << p << " * pow(" << d(x) << ", " << p-1 << ")";
+		add_grad(x, s.str());
+	} else
+		*os << "\tif (!bwd_pow(" << d(y) << "," << p << "," << d(x) << ")) return false;\n";
+}
+
+} // namespace ibex
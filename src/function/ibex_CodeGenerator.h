@@ -0,0 +1,251 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CodeGenerator.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_CODE_GENERATOR_H__
+#define __IBEX_CODE_GENERATOR_H__
+
+#include "ibex_FwdAlgorithm.h"
+#include "ibex_BwdAlgorithm.h"
+#include "ibex_Exception.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ibex {
+
+class Function;
+class System;
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief C++ code generator for functions.
+ *
+ * Writes the source code of three kernels for a function f:
+ * <ul>
+ * <li> <prefix>_eval:     evaluation of f (see #ibex::Eval)
+ * <li> <prefix>_proj:     forward-backward contraction (see #ibex::HC4Revise)
+ * <li> <prefix>_jacobian: gradient or Jacobian matrix (see #ibex::Gradient)
+ * </ul>
+ * The operations are written as straight-line code, in the order
+ * of execution of the CompiledFunction, with all the node indices
+ * resolved: no opcode is interpreted at run time.
+ *
+ * The file must then be compiled as a shared object, e.g.:
+ *
+ *    g++ -O2 -frounding-math -shared -fPIC [ibex include flags] f.cpp -o f.so
+ *
+ * (the symbols of IBEX must be visible to the shared object, e.g., by
+ * linking the application with the shared library of IBEX or with
+ * -rdynamic) and loaded with #ibex::Function::load_code.
+ *
+ * Like #ibex::BatchEval, only the operators on scalars, vectors of
+ * expressions, indices (with contiguous components), symbols and
+ * constants are handled (see #is_supported).
+ */
+class CodeGenerator : public FwdAlgorithm, public BwdAlgorithm {
+public:
+	/**
+	 * \brief Build the generator of a function.
+	 *
+	 * \param prefix - the prefix of the kernel names.
+	 */
+	CodeGenerator(const Function& f, const std::string& prefix="f");
+
+	/**
+	 * \brief Write the kernels.
+	 *
+	 * \pre #is_supported must be true.
+	 */
+	void kernels(std::ostream& os);
+
+	/**
+	 * \brief Write the beginning of a generated file
+	 *        (#include directives).
+	 */
+	static void header(std::ostream& os);
+
+	/**
+	 * \brief Write a complete file for f.
+	 */
+	static void generate(const Function& f, std::ostream& os, const std::string& prefix="f");
+
+	/**
+	 * \brief Write a complete file for a system.
+	 *
+	 * The prefixes are "f" for the main function, "goal" for the
+	 * goal and "c<i>" for the function of the ith constraint.
+	 * The unsupported functions are skipped.
+	 */
+	static void generate(const System& sys, std::ostream& os);
+
+	/**
+	 * \brief Load the code generated for a system.
+	 *
+	 * \see generate(const System&, std::ostream&).
+	 */
+	static void load(System& sys, const char* file);
+
+	/** The function. */
+	const Function& f;
+
+	/** The prefix of the kernel names. */
+	const std::string prefix;
+
+	/** True iff all the operators of the function are handled. */
+	bool is_supported;
+
+public: // because called from CompiledFunction
+	inline void idx_fwd    (int, int)              { /* nothing to do (view) */ }
+	inline void idx_cp_fwd (int, int)              { not_implemented("CodeGenerator with non-contiguous indices"); }
+	       void vector_fwd (int* x, int y);
+	inline void symbol_fwd (int)                   { /* nothing to do */ }
+	       void cst_fwd    (int y);
+	inline void apply_fwd  (int*, int)             { not_implemented("CodeGenerator with applied functions"); }
+	inline void chi_fwd    (int, int, int, int)    { not_implemented("CodeGenerator with \"chi\""); }
+	inline void add_fwd    (int x1, int x2, int y) { binary_fwd("+",x1,x2,y); }
+	inline void mul_fwd    (int x1, int x2, int y) { binary_fwd("*",x1,x2,y); }
+	inline void sub_fwd    (int x1, int x2, int y) { binary_fwd("-",x1,x2,y); }
+	inline void div_fwd    (int x1, int x2, int y) { binary_fwd("/",x1,x2,y); }
+	inline void max_fwd    (int x1, int x2, int y) { binary_fwd("max",x1,x2,y); }
+	inline void min_fwd    (int x1, int x2, int y) { binary_fwd("min",x1,x2,y); }
+	inline void atan2_fwd  (int x1, int x2, int y) { binary_fwd("atan2",x1,x2,y); }
+	       void minus_fwd  (int x, int y);
+	inline void trans_V_fwd(int, int)              { not_implemented("CodeGenerator with transpose"); }
+	inline void trans_M_fwd(int, int)              { not_implemented("CodeGenerator with transpose"); }
+	inline void sign_fwd   (int x, int y)          { unary_fwd("sign",x,y); }
+	inline void abs_fwd    (int x, int y)          { unary_fwd("abs",x,y); }
+	       void power_fwd  (int x, int y, int p);
+	inline void sqr_fwd    (int x, int y)          { unary_fwd("sqr",x,y); }
+	inline void sqrt_fwd   (int x, int y)          { unary_fwd("sqrt",x,y,true); }
+	inline void exp_fwd    (int x, int y)          { unary_fwd("exp",x,y); }
+	inline void log_fwd    (int x, int y)          { unary_fwd("log",x,y,true); }
+	inline void cos_fwd    (int x, int y)          { unary_fwd("cos",x,y); }
+	inline void sin_fwd    (int x, int y)          { unary_fwd("sin",x,y); }
+	inline void tan_fwd    (int x, int y)          { unary_fwd("tan",x,y,true); }
+	inline void cosh_fwd   (int x, int y)          { unary_fwd("cosh",x,y); }
+	inline void sinh_fwd   (int x, int y)          { unary_fwd("sinh",x,y); }
+	inline void tanh_fwd   (int x, int y)          { unary_fwd("tanh",x,y); }
+	inline void acos_fwd   (int x, int y)          { unary_fwd("acos",x,y,true); }
+	inline void asin_fwd   (int x, int y)          { unary_fwd("asin",x,y,true); }
+	inline void atan_fwd   (int x, int y)          { unary_fwd("atan",x,y); }
+	inline void acosh_fwd  (int x, int y)          { unary_fwd("acosh",x,y,true); }
+	inline void asinh_fwd  (int x, int y)          { unary_fwd("asinh",x,y); }
+	inline void atanh_fwd  (int x, int y)          { unary_fwd("atanh",x,y,true); }
+	inline void add_V_fwd  (int, int, int)         { not_implemented("CodeGenerator with vector operators"); }
+	inline void add_M_fwd  (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void mul_SV_fwd (int, int, int)         { not_implemented("CodeGenerator with vector operators"); }
+	inline void mul_SM_fwd (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void mul_VV_fwd (int, int, int)         { not_implemented("CodeGenerator with vector operators"); }
+	inline void mul_MV_fwd (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void mul_VM_fwd (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void mul_MM_fwd (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void sub_V_fwd  (int, int, int)         { not_implemented("CodeGenerator with vector operators"); }
+	inline void sub_M_fwd  (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+
+	inline void idx_bwd    (int, int)              { /* nothing to do (view) */ }
+	inline void idx_cp_bwd (int, int)              { not_implemented("CodeGenerator with non-contiguous indices"); }
+	       void vector_bwd (int* x, int y);
+	inline void symbol_bwd (int)                   { /* nothing to do */ }
+	inline void cst_bwd    (int)                   { /* nothing to do */ }
+	inline void apply_bwd  (int*, int)             { not_implemented("CodeGenerator with applied functions"); }
+	inline void chi_bwd    (int, int, int, int)    { not_implemented("CodeGenerator with \"chi\""); }
+	       void add_bwd    (int x1, int x2, int y);
+	       void mul_bwd    (int x1, int x2, int y);
+	       void sub_bwd    (int x1, int x2, int y);
+	       void div_bwd    (int x1, int x2, int y);
+	       void max_bwd    (int x1, int x2, int y);
+	       void min_bwd    (int x1, int x2, int y);
+	       void atan2_bwd  (int x1, int x2, int y);
+	       void minus_bwd  (int x, int y);
+	inline void trans_V_bwd(int, int)              { not_implemented("CodeGenerator with transpose"); }
+	inline void trans_M_bwd(int, int)              { not_implemented("CodeGenerator with transpose"); }
+	       void sign_bwd   (int x, int y);
+	       void abs_bwd    (int x, int y);
+	       void power_bwd  (int x, int y, int p);
+	inline void sqr_bwd    (int x, int y)          { unary_bwd("sqr",x,y," * 2.0 * "+d(x)); }
+	inline void sqrt_bwd   (int x, int y)          { unary_bwd("sqrt",x,y," * 0.5 / sqrt("+d(x)+")"); }
+	inline void exp_bwd    (int x, int y)          { unary_bwd("exp",x,y," * exp("+d(x)+")"); }
+	inline void log_bwd    (int x, int y)          { unary_bwd("log",x,y," / "+d(x)); }
+	inline void cos_bwd    (int x, int y)          { unary_bwd("cos",x,y," * -sin("+d(x)+")"); }
+	inline void sin_bwd    (int x, int y)          { unary_bwd("sin",x,y," * cos("+d(x)+")"); }
+	inline void tan_bwd    (int x, int y)          { unary_bwd("tan",x,y," * (1.0 + sqr(tan("+d(x)+")))"); }
+	inline void cosh_bwd   (int x, int y)          { unary_bwd("cosh",x,y," * sinh("+d(x)+")"); }
+	inline void sinh_bwd   (int x, int y)          { unary_bwd("sinh",x,y," * cosh("+d(x)+")"); }
+	inline void tanh_bwd   (int x, int y)          { unary_bwd("tanh",x,y," * (1.0 - sqr(tanh("+d(x)+")))"); }
+	inline void acos_bwd   (int x, int y)          { unary_bwd("acos",x,y," * -1.0 / sqrt(1.0-sqr("+d(x)+"))"); }
+	inline void asin_bwd   (int x, int y)          { unary_bwd("asin",x,y," * 1.0 / sqrt(1.0-sqr("+d(x)+"))"); }
+	inline void atan_bwd   (int x, int y)          { unary_bwd("atan",x,y," * 1.0 / (1.0+sqr("+d(x)+"))"); }
+	inline void acosh_bwd  (int x, int y)          { unary_bwd("acosh",x,y," * 1.0 / sqrt(sqr("+d(x)+") -1.0)"); }
+	inline void asinh_bwd  (int x, int y)          { unary_bwd("asinh",x,y," * 1.0 / sqrt(1.0+sqr("+d(x)+"))"); }
+	inline void atanh_bwd  (int x, int y)          { unary_bwd("atanh",x,y," * 1.0 / (1.0-sqr("+d(x)+"))"); }
+	inline void add_V_bwd  (int, int, int)         { not_implemented("CodeGenerator with vector operators"); }
+	inline void add_M_bwd  (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void mul_SV_bwd (int, int, int)         { not_implemented("CodeGenerator with vector operators"); }
+	inline void mul_SM_bwd (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void mul_VV_bwd (int, int, int)         { not_implemented("CodeGenerator with vector operators"); }
+	inline void mul_MV_bwd (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void mul_VM_bwd (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void mul_MM_bwd (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+	inline void sub_V_bwd  (int, int, int)         { not_implemented("CodeGenerator with vector operators"); }
+	inline void sub_M_bwd  (int, int, int)         { not_implemented("CodeGenerator with matrix operators"); }
+
+protected:
+	/* Domain (d) and derivative (g) of the cth component of node y. */
+	std::string d(int y, int c=0) const;
+	std::string g(int y, int c=0) const;
+
+	/* Write the evaluation, contraction and Jacobian kernels. */
+	void eval_kernel(std::ostream& os);
+	void proj_kernel(std::ostream& os);
+	void jacobian_kernel(std::ostream& os);
+
+	/* Write the copy of the box in the domains of the symbols. */
+	void read_box(std::ostream& os);
+
+	/* Write the backward sweep of the ith row of the Jacobian matrix. */
+	void row_sweep(std::ostream& os, int i);
+
+	void unary_fwd(const char* op, int x, int y, bool check_empty=false);
+	void binary_fwd(const char* op, int x1, int x2, int y);
+
+	/* Write the backward operation of HC4Revise (bwd_<op>) or,
+	 * when writing the Jacobian kernel, the derivative g[x]+=g[y]<df>
+	 * (the formulas are the same as in Gradient). */
+	void unary_bwd(const char* op, int x, int y, const std::string& df);
+	void binary_bwd(const char* op, int x1, int x2, int y);
+
+	/* Add a derivative to g[x] (Jacobian mode) */
+	void add_grad(int x, const std::string& expr);
+
+	/* Output stream of the current kernel. */
+	std::ostream* os;
+
+	/* true when writing the Jacobian kernel. */
+	bool grad;
+
+	/* First component of each node in the arrays. */
+	std::vector<int> off;
+
+	/* Total number of components. */
+	int nb_comp;
+
+	/* Components with a (possibly) non-zero derivative
+	 * in the current row of the Jacobian kernel. */
+	std::vector<char> nz;
+
+private:
+	CodeGenerator(const CodeGenerator&);            // forbidden
+	CodeGenerator& operator=(const CodeGenerator&); // forbidden
+};
+
+} // namespace ibex
+
+#endif // __IBEX_CODE_GENERATOR_H__
@@ -16,7 +16,7 @@
 
 namespace ibex {
 
-Eval::Eval(Function& f) : f(f), d(f) {
+Eval::Eval(EvalContext& ctx) : ctx(ctx), f(ctx.f), d(f), empty(false) {
 
 }
 
@@ -30,11 +30,9 @@ Domain& Eval::eval(const Array<const Domain>& d2) {
 	//		cout << "arg[" << i << "]=" << f.arg_domains[i] << endl;
 	//	}
 
-	try {
-		f.forward<Eval>(*this);
-	} catch(EmptyBoxException&) {
+	empty=false;
+	if (!f.forward<Eval>(*this))
 		d.top->set_empty();
-	}
 	return *d.top;
 }
 
@@ -42,11 +40,9 @@ Domain& Eval::eval(const Array<Domain>& d2) {
 
 	d.write_arg_domains(d2);
 
-	try {
-		f.forward<Eval>(*this);
-	} catch(EmptyBoxException&) {
+	empty=false;
+	if (!f.forward<Eval>(*this))
 		d.top->set_empty();
-	}
 	return *d.top;
 }
 
@@ -54,11 +50,17 @@ Domain& Eval::eval(const IntervalVector& box) {
 
 	d.write_arg_domains(box);
 
-	try {
-		f.forward<Eval>(*this);
-	} catch(EmptyBoxException&) {
+	empty=false;
+	if (!f.forward<Eval>(*this))
+		d.top->set_empty();
+	return *d.top;
+}
+
+Domain& Eval::eval(const int* sub, int size) {
+
+	empty=false;
+	if (!f.forward<Eval>(*this,sub,size))
 		d.top->set_empty();
-	}
 	return *d.top;
 }
 
@@ -84,7 +86,10 @@ void Eval::apply_fwd(int* x, int y) {
 		d2.set_ref(i,d[x[i]]);
 	}
 
-	d[y] = a.func.basic_evaluator().eval(d2);
+	d[y] = ctx.apply(y).eval.eval(d2);
+
+	if (ctx.apply(y).eval.empty)
+		empty=true;
 }
 
 void Eval::vector_fwd(int* x, int y) {
@@ -19,6 +19,7 @@
 namespace ibex {
 
 class Function;
+class EvalContext;
 
 /**
  * \ingroup symbolic
@@ -31,9 +32,13 @@ class Eval : public FwdAlgorithm {
 
 public:
 	/**
-	 * \brief Build the evaluator for the function f.
+	 * \brief Build the evaluator of a context.
+	 *
+	 * The domains of the nodes are owned by the evaluator
+	 * (functions applied inside the expression are evaluated with
+	 * their own context in \a ctx).
 	 */
-	Eval(Function &f);
+	Eval(EvalContext& ctx);
 
 	/**
 	 * \brief Run the forward algorithm with input domains.
@@ -50,13 +55,23 @@ public:
 	 */
 	Domain& eval(const IntervalVector& box);
 
-protected:
 	/**
-	 * Class used internally to interrupt the forward procedure
-	 * when an empty domain occurs (<=> the input box is outside
-	 * the definition domain of the function).
+	 * \brief Run the forward algorithm on a subset of nodes only.
+	 *
+	 * Used when the domains of the arguments have been modified
+	 * (directly in d.args) since the last evaluation: only the nodes
+	 * depending on the modified arguments are re-evaluated.
+	 * \see #ibex::Function::dependent_nodes(int, std::vector<int>&).
+	 */
+	Domain& eval(const int* sub, int size);
+
+	/**
+	 * \brief True if an empty domain has occurred during the last evaluation.
+	 *
+	 * Used by CompiledFunction to interrupt the forward procedure
+	 * (<=> the input box is outside the definition domain of the function).
 	 */
-	class EmptyBoxException { };
+	bool fwd_empty() const;
 
 public: // because called from CompiledFunction
 
@@ -107,14 +122,21 @@ public: // because called from CompiledFunction
 	inline void sub_V_fwd  (int x1, int x2, int y);
 	inline void sub_M_fwd  (int x1, int x2, int y);
 
+	EvalContext& ctx;
 	Function& f;
 	ExprDomain d;
+
+protected:
+	/* Set when an empty domain occurs. */
+	bool empty;
 };
 
 /* ============================================================================
  	 	 	 	 	 	 	 implementation
   ============================================================================*/
 
+inline bool Eval::fwd_empty() const { return empty; }
+
 inline void Eval::idx_fwd(int, int) { /* nothing to do */ }
 
 inline void Eval::symbol_fwd(int) { /* nothing to do */ }
@@ -143,21 +165,21 @@ inline void Eval::sign_fwd(int x, int y)           { d[y].i()=sign(d[x].i()); }
 inline void Eval::abs_fwd(int x, int y)            { d[y].i()=abs(d[x].i()); }
 inline void Eval::power_fwd(int x, int y, int p)   { d[y].i()=pow(d[x].i(),p); }
 inline void Eval::sqr_fwd(int x, int y)            { d[y].i()=sqr(d[x].i()); }
-inline void Eval::sqrt_fwd(int x, int y)           { if ((d[y].i()=sqrt(d[x].i())).is_empty()) throw EmptyBoxException(); }
+inline void Eval::sqrt_fwd(int x, int y)           { if ((d[y].i()=sqrt(d[x].i())).is_empty()) empty=true; }
 inline void Eval::exp_fwd(int x, int y)            { d[y].i()=exp(d[x].i()); }
-inline void Eval::log_fwd(int x, int y)            { if ((d[y].i()=log(d[x].i())).is_empty()) throw EmptyBoxException(); }
+inline void Eval::log_fwd(int x, int y)            { if ((d[y].i()=log(d[x].i())).is_empty()) empty=true; }
 inline void Eval::cos_fwd(int x, int y)            { d[y].i()=cos(d[x].i()); }
 inline void Eval::sin_fwd(int x, int y)            { d[y].i()=sin(d[x].i()); }
-inline void Eval::tan_fwd(int x, int y)            { if ((d[y].i()=tan(d[x].i())).is_empty()) throw EmptyBoxException(); }
+inline void Eval::tan_fwd(int x, int y)            { if ((d[y].i()=tan(d[x].i())).is_empty()) empty=true; }
 inline void Eval::cosh_fwd(int x, int y)           { d[y].i()=cosh(d[x].i()); }
 inline void Eval::sinh_fwd(int x, int y)           { d[y].i()=sinh(d[x].i()); }
 inline void Eval::tanh_fwd(int x, int y)           { d[y].i()=tanh(d[x].i()); }
-inline void Eval::acos_fwd(int x, int y)           { if ((d[y].i()=acos(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::asin_fwd(int x, int y)           { if ((d[y].i()=asin(d[x].i())).is_empty()) throw EmptyBoxException(); }
+inline void Eval::acos_fwd(int x, int y)           { if ((d[y].i()=acos(d[x].i())).is_empty()) empty=true; }
+inline void Eval::asin_fwd(int x, int y)           { if ((d[y].i()=asin(d[x].i())).is_empty()) empty=true; }
 inline void Eval::atan_fwd(int x, int y)           { d[y].i()=atan(d[x].i()); }
-inline void Eval::acosh_fwd(int x, int y)          { if ((d[y].i()=acosh(d[x].i())).is_empty()) throw EmptyBoxException(); }
+inline void Eval::acosh_fwd(int x, int y)          { if ((d[y].i()=acosh(d[x].i())).is_empty()) empty=true; }
 inline void Eval::asinh_fwd(int x, int y)          { d[y].i()=asinh(d[x].i()); }
-inline void Eval::atanh_fwd(int x, int y)          { if ((d[y].i()=atanh(d[x].i())).is_empty()) throw EmptyBoxException(); }
+inline void Eval::atanh_fwd(int x, int y)          { if ((d[y].i()=atanh(d[x].i())).is_empty()) empty=true; }
 
 inline void Eval::trans_V_fwd(int x, int y)        { d[y].v()=d[x].v(); }
 inline void Eval::trans_M_fwd(int x, int y)        { d[y].m()=d[x].m().transpose(); }
@@ -0,0 +1,33 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalContext.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_EvalContext.h"
+
+namespace ibex {
+
+EvalContext::EvalContext(const Function& f) : f((Function&) f), eval(*this),
+		hc4revise(eval), grad(eval), inhc4revise(eval), sub(new EvalContext*[f.nb_nodes()]),
+		_batch_eval(NULL), _batch_hc4revise(NULL) {
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		const ExprApply* a=dynamic_cast<const ExprApply*>(&f.node(i));
+		sub[i] = a ? new EvalContext(a->func) : NULL;
+	}
+}
+
+EvalContext::~EvalContext() {
+	if (_batch_hc4revise) delete _batch_hc4revise;
+	if (_batch_eval) delete _batch_eval;
+	for (int i=0; i<f.nb_nodes(); i++)
+		if (sub[i]) delete sub[i];
+	delete[] sub;
+}
+
+} // namespace ibex
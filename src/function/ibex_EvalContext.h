@@ -0,0 +1,127 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalContext.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_EVAL_CONTEXT_H__
+#define __IBEX_EVAL_CONTEXT_H__
+
+#include "ibex_Eval.h"
+#include "ibex_HC4Revise.h"
+#include "ibex_Gradient.h"
+#include "ibex_InHC4Revise.h"
+#include "ibex_BatchEval.h"
+#include "ibex_BatchHC4Revise.h"
+
+namespace ibex {
+
+/**
+ * \ingroup function
+ *
+ * \brief Workspace of the forward/backward algorithms of a function.
+ *
+ * All the algorithms on a function (evaluation, gradient, HC4Revise, etc.)
+ * store intermediate results in the domains associated to the nodes of the
+ * expression. These domains belong to an evaluation context.
+ *
+ * Every function has its own (default) context, used by Function::eval(box),
+ * Function::gradient(box,g), Function::backward(y,x), etc. This is why these
+ * functions, although "const", cannot be called by two threads at the same time.
+ *
+ * To evaluate the same function in several threads, each thread has to build
+ * its own context and pass it explicitly:
+ * <pre>
+ *    EvalContext ctx(f);       // one per thread
+ *    Interval y=f.eval(box,ctx);
+ * </pre>
+ * Building a context does not copy (nor compile) the function.
+ *
+ * \warning A context must not be shared by two threads.
+ */
+class EvalContext {
+public:
+	/**
+	 * \brief Build a new context for f.
+	 *
+	 * The context of every function applied in the expression
+	 * of f (see #ibex::ExprApply) is also built.
+	 */
+	EvalContext(const Function& f);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~EvalContext();
+
+	/**
+	 * \brief Context of the function applied at node y.
+	 *
+	 * \pre node y must be an #ibex::ExprApply.
+	 */
+	EvalContext& apply(int y);
+
+	/** The function. */
+	Function& f;
+
+	/** Evaluator (owns the domains of the nodes). */
+	Eval eval;
+
+	/** HC4Revise algorithm (works on the domains of eval). */
+	HC4Revise hc4revise;
+
+	/** Gradient algorithm (works on the domains of eval). */
+	Gradient grad;
+
+	/** Inner HC4Revise algorithm (works on the domains of eval). */
+	InHC4Revise inhc4revise;
+
+	/**
+	 * \brief Evaluator on several boxes at once.
+	 *
+	 * Built on first call (it has its own domains).
+	 */
+	BatchEval& batch_eval();
+
+	/**
+	 * \brief HC4Revise algorithm on several boxes at once.
+	 *
+	 * Built on first call (works on the domains of batch_eval()).
+	 */
+	BatchHC4Revise& batch_hc4revise();
+
+private:
+	EvalContext(const EvalContext&);            // forbidden
+	EvalContext& operator=(const EvalContext&); // forbidden
+
+	/* Context of the applied functions, indexed by node (NULL if not an ExprApply) */
+	EvalContext** sub;
+
+	/* Batch algorithms (NULL until required) */
+	BatchEval* _batch_eval;
+	BatchHC4Revise* _batch_hc4revise;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline EvalContext& EvalContext::apply(int y) {
+	assert(sub[y]!=NULL);
+	return *sub[y];
+}
+
+inline BatchEval& EvalContext::batch_eval() {
+	if (!_batch_eval) _batch_eval=new BatchEval(*this);
+	return *_batch_eval;
+}
+
+inline BatchHC4Revise& EvalContext::batch_hc4revise() {
+	if (!_batch_hc4revise) _batch_hc4revise=new BatchHC4Revise(batch_eval());
+	return *_batch_hc4revise;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_EVAL_CONTEXT_H__
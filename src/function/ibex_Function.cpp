@@ -15,6 +15,7 @@
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
 #include "ibex_Gradient.h"
+#include "ibex_EvalContext.h"
 #include "ibex_VarSet.h"
 #include "ibex_FunctionBuild.cpp_"
 
@@ -56,99 +57,113 @@ Function::~Function() {
 		delete[] symbol_index;
 	}
 
-	if (_eval!=NULL) {
-		delete _eval;
-		delete _hc4revise;
-		delete _grad;
-		delete _inhc4revise;
+	if (_ctx!=NULL) {
+		delete _ctx;
 	}
+
+	if (code!=NULL) delete code;
+}
+
+void Function::load_code(const char* file, const char* prefix) {
+	GeneratedCode* new_code=new GeneratedCode(*this,file,prefix);
+	if (code!=NULL) delete code;
+	code=new_code;
 }
 
 void Function::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
+	jacobian(x,J,*_ctx);
+}
+
+void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, EvalContext& ctx) const {
 	assert(J.nb_cols()==nb_var());
 	assert(x.size()==nb_var());
 	assert(J.nb_rows()==image_dim());
+	assert(&ctx.f==this);
 
-	// calculate the gradient of each component of f
-	// TODO: we could take advantage of the DAG structure
-	// by calling just once the forward phase on f itself
-	for (int i=0; i<image_dim(); i++) {
-		(*this)[i].gradient(x,J[i]);
-		if (J[i].is_empty()) {
-			J.set_empty();
-			return;
-		}
-	}
+	if (code) code->jacobian(x,J);
+	else ctx.grad.jacobian(x,J);
 }
 
 void Function::jacobian(const IntervalVector& box, IntervalMatrix& J, const VarSet& set) const {
+	jacobian(box,J,set,*_ctx);
+}
+
+void Function::jacobian(const IntervalVector& box, IntervalMatrix& J, const VarSet& set, EvalContext& ctx) const {
 
 	assert(J.nb_cols()==set.nb_var);
 	assert(box.size()==nb_var());
 	assert(J.nb_rows()==image_dim());
+	assert(&ctx.f==this);
 
-	IntervalVector g(nb_var());
-
-	// calculate the gradient of each component of f
-	for (int i=0; i<image_dim(); i++) {
-		(*this)[i].gradient(box,g);
-		J.set_row(i,set.var_box(g));
-	}
+	ctx.grad.jacobian(box,J,set);
 }
 
 void Function::hansen_matrix(const IntervalVector& box, IntervalMatrix& H) const {
-	int n=nb_var();
-	int m=image_dim();
-
-	assert(H.nb_cols()==n);
-	assert(box.size()==n);
-	assert(H.nb_rows()==m);
-
-	IntervalVector x=box.mid();
-	IntervalMatrix J(m,n);
-
-	// test!
-//	int tab[box.size()];
-//	box.sort_indices(false,tab);
-//	int var;
-
-	for (int var=0; var<n; var++) {
-		//var=tab[i];
-		x[var]=box[var];
-		jacobian(x,J);
-                if (J.is_empty()) {
-                    H.set_empty();
-                    return;
-                }
-		H.set_col(var,J.col(var));
-	}
+	hansen_matrix(box,H,*_ctx);
+}
+
+void Function::hansen_matrix(const IntervalVector& box, IntervalMatrix& H, EvalContext& ctx) const {
+	assert(H.nb_cols()==nb_var());
+	assert(box.size()==nb_var());
+	assert(H.nb_rows()==image_dim());
+	assert(&ctx.f==this);
 
+	ctx.grad.hansen_matrix(box,H);
 }
 
 void Function::hansen_matrix(const IntervalVector& box, IntervalMatrix& H, const VarSet& set) const {
-	int n=set.nb_var;
-	int m=image_dim();
+	hansen_matrix(box,H,set,*_ctx);
+}
 
-	assert(H.nb_cols()==n);
+void Function::hansen_matrix(const IntervalVector& box, IntervalMatrix& H, const VarSet& set, EvalContext& ctx) const {
+	assert(H.nb_cols()==set.nb_var);
 	assert(box.size()==nb_var());
-	assert(H.nb_rows()==m);
-
-	IntervalVector var_box=set.var_box(box);
-	IntervalVector param_box=set.param_box(box);
-
-	IntervalVector x=var_box.mid();
-	IntervalMatrix J(m,n);
-
-	for (int var=0; var<n; var++) {
-		//var=tab[i];
-		x[var]=var_box[var];
-		jacobian(set.full_box(x,param_box),J,set);
-                if (J.is_empty()) {
-                    H.set_empty();
-                    return;
-                }
-		H.set_col(var,J.col(var));
+	assert(H.nb_rows()==image_dim());
+	assert(&ctx.f==this);
+
+	ctx.grad.hansen_matrix(box,H,set);
+}
+
+void Function::dependent_nodes(int i, vector<int>& dep) const {
+	// a node has a smaller index than its subnodes
+	vector<bool> mark(nb_nodes(),false);
+	mark[i]=true;
+	int n=1;
+	for (int y=i-1; y>=0; y--) {
+		for (int j=0; j<cf.nb_args[y]; j++)
+			if (mark[cf.args[y][j]]) { mark[y]=true; n++; break; }
+	}
+	dep.resize(n);
+	for (int y=0, k=0; y<=i; y++)
+		if (mark[y]) dep[k++]=y;
+}
+
+void Function::var_dependent_nodes(int v, vector<int>& dep) const {
+	// symbol and component of the variable
+	int s=0;
+	while (v>=arg(s).dim.size()) v-=arg(s++).dim.size();
+
+	const ExprSymbol& x=arg(s);
+	int r=v/x.dim.nb_cols();
+	int c=v%x.dim.nb_cols();
+
+	int i=nodes.rank(x);
+	vector<bool> mark(nb_nodes(),false);
+	mark[i]=true;
+	int n=1;
+	for (int y=i-1; y>=0; y--) {
+		const ExprIndex* e=dynamic_cast<const ExprIndex*>(&node(y));
+		if (e && &e->expr==&x) {
+			const DoubleIndex& idx=e->index;
+			if (r<idx.first_row() || r>idx.last_row() || c<idx.first_col() || c>idx.last_col())
+				continue;
+		}
+		for (int j=0; j<cf.nb_args[y]; j++)
+			if (mark[cf.args[y][j]]) { mark[y]=true; n++; break; }
 	}
+	dep.resize(n);
+	for (int y=0, k=0; y<=i; y++)
+		if (mark[y]) dep[k++]=y;
 }
 
 void Function::print(std::ostream& os) const {
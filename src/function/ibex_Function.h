@@ -19,6 +19,7 @@
 #include "ibex_ExprSubNodes.h"
 
 #include <stdexcept>
+#include <vector>
 #include <stdarg.h>
 #include <stdio.h>
 
@@ -30,6 +31,8 @@ class Eval;
 class HC4Revise;
 class Gradient;
 class InHC4Revise;
+class EvalContext;
+class GeneratedCode;
 
 /**
  * \ingroup function
@@ -52,6 +55,11 @@ class InHC4Revise;
  * output vector has 1 component. If f is a m*n matrix function,
  * the output vector has m*n components.
  *
+ * <br>
+ * The evaluation functions (eval, gradient, backward, etc.) are "const"
+ * but work with a workspace associated to the function (its default
+ * #ibex::EvalContext). To call them from several threads, use the variants
+ * with an explicit EvalContext argument (one context per thread).
  *
  */
 class Function {
@@ -641,19 +649,59 @@ public:
 	 * V must be a subclass of FwdAlgorithm.
 	 *
 	 * Note that the type V is just passed in order to have static linkage.
+	 *
+	 * \return false if interrupted by an empty domain.
+	 * \see CompiledFunction::forward(const V&).
 	 */
 	template<class V>
-	void forward(const V& algo) const;
+	bool forward(const V& algo) const;
 
 	/**
 	 * \brief Run a backward algorithm.
 	 *
-	 * V must be a subclass of FwdAlgorithm.
+	 * V must be a subclass of BwdAlgorithm.
 	 *
 	 * Note that the type V is just passed in order to have static linkage.
+	 *
+	 * \return false if interrupted by an empty domain.
+	 * \see CompiledFunction::backward(const V&).
+	 */
+	template<class V>
+	bool backward(const V& algo) const;
+
+	/**
+	 * \brief Run a forward algorithm on a subset of nodes.
+	 *
+	 * \see CompiledFunction::forward(const V&, const int*, int).
 	 */
 	template<class V>
-	void backward(const V& algo) const;
+	bool forward(const V& algo, const int* sub, int size) const;
+
+	/**
+	 * \brief Run a backward algorithm on a subset of nodes.
+	 *
+	 * \see CompiledFunction::backward(const V&, const int*, int).
+	 */
+	template<class V>
+	bool backward(const V& algo, const int* sub, int size) const;
+
+	/**
+	 * \brief Nodes depending on the node n°i (including i itself).
+	 *
+	 * These are the nodes to be updated by a forward algorithm when the
+	 * label of node i changes. They are sorted by increasing index
+	 * (see #forward(const V&, const int*, int)).
+	 */
+	void dependent_nodes(int i, std::vector<int>& dep) const;
+
+	/**
+	 * \brief Nodes depending on the variable n°v.
+	 *
+	 * Same as #dependent_nodes(int, std::vector<int>&) with the symbol
+	 * containing the variable, except that an index applied to the symbol
+	 * (like x[i]) is discarded if it does not select the variable.
+	 */
+	void var_dependent_nodes(int v, std::vector<int>& dep) const;
 
 	/**
 	 * \brief Calculate f(box) using interval arithmetic.
@@ -693,6 +741,38 @@ public:
 	 */
 	Domain& eval_domain(const Array<Domain>& d) const;
 
+	/**
+	 * \brief Calculate f(box) using interval arithmetic, in a given context.
+	 *
+	 * \pre f must be real-valued
+	 * \see #ibex::EvalContext
+	 */
+	Interval eval(const IntervalVector& box, EvalContext& ctx) const;
+
+	/**
+	 * \brief Calculate f(box) using interval arithmetic, in a given context.
+	 *
+	 * \see #ibex::EvalContext
+	 */
+	IntervalVector eval_vector(const IntervalVector& box, EvalContext& ctx) const;
+
+	/**
+	 * \brief Calculate f(x) using interval arithmetic, in a given context.
+	 *
+	 * \pre f must be matrix-valued
+	 * \see #ibex::EvalContext
+	 */
+	IntervalMatrix eval_matrix(const IntervalVector& x, EvalContext& ctx) const;
+
+	/**
+	 * \brief Calculate f(box) using interval arithmetic, in a given context.
+	 *
+	 * The domain returned belongs to the context.
+	 *
+	 * \see #ibex::EvalContext
+	 */
+	Domain& eval_domain(const IntervalVector& box, EvalContext& ctx) const;
+
 	/**
 	 * \brief Calculate the gradient of f.
 	 *
@@ -709,15 +789,31 @@ public:
 	 */
 	IntervalVector gradient(const IntervalVector& x) const;
 
+	/**
+	 * \brief Calculate the gradient of f, in a given context.
+	 *
+	 * \pre f must be real-valued
+	 * \see #ibex::EvalContext
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g, EvalContext& ctx) const;
+
 	/**
 	 * \brief Calculate the Jacobian matrix of f
 	 *
 	 * \param x - the input box
 	 * \param J - where the Jacobian matrix has to be stored (output parameter).
 	 *
+	 * f is evaluated once and each row is obtained by automatic
+	 * differentiation in reverse mode (see #ibex::Gradient::jacobian).
 	 */
 	void jacobian(const IntervalVector& x, IntervalMatrix& J) const;
 
+	/**
+	 * \brief Calculate the Jacobian matrix of f, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	void jacobian(const IntervalVector& x, IntervalMatrix& J, EvalContext& ctx) const;
+
 	/**
 	 * \brief Calculate the Jacobian matrix of f
 	 * \pre f must be vector-valued
@@ -732,11 +828,28 @@ public:
 	 */
 	void jacobian(const IntervalVector& full_box, IntervalMatrix& J, const VarSet& set) const;
 
+	/**
+	 * \brief Calculate the Jacobian matrix of a restriction of f, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	void jacobian(const IntervalVector& full_box, IntervalMatrix& J, const VarSet& set, EvalContext& ctx) const;
+
 	/**
 	 * \brief Calculate the Hansen matrix of f
+	 *
+	 * The jth column of h is the jth column of the Jacobian matrix
+	 * on the box (x_1,...,x_j,mid(x_{j+1}),...,mid(x_n)).
+	 * The function is not re-evaluated from scratch for each column:
+	 * only the nodes depending on x_j are updated (see #ibex::Gradient::hansen_matrix).
 	 */
 	void hansen_matrix(const IntervalVector& x, IntervalMatrix& h) const;
 
+	/**
+	 * \brief Calculate the Hansen matrix of f, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	void hansen_matrix(const IntervalVector& x, IntervalMatrix& h, EvalContext& ctx) const;
+
 	/**
 	 * \brief Calculate the Hansen matrix of a restriction of f
 	 *
@@ -745,6 +858,12 @@ public:
 	 */
 	void hansen_matrix(const IntervalVector& full_box, IntervalMatrix& h, const VarSet& set) const;
 
+	/**
+	 * \brief Calculate the Hansen matrix of a restriction of f, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	void hansen_matrix(const IntervalVector& full_box, IntervalMatrix& h, const VarSet& set, EvalContext& ctx) const;
+
 	/**
 	 * \brief Contract x w.r.t. f(x)=y.
 	 * \throw EmptyBoxException if x is empty.
@@ -769,6 +888,75 @@ public:
 	 */
 	bool backward(const IntervalMatrix& y, IntervalVector& x) const;
 
+	/**
+	 * \brief Contract x w.r.t. f(x)=y, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	bool backward(const Domain& y, IntervalVector& x, EvalContext& ctx) const;
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	bool backward(const Interval& y, IntervalVector& x, EvalContext& ctx) const;
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	bool backward(const IntervalVector& y, IntervalVector& x, EvalContext& ctx) const;
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	bool backward(const IntervalMatrix& y, IntervalVector& x, EvalContext& ctx) const;
+
+	/**
+	 * \brief Calculate f(boxes[k]) for k=0...n-1 using interval arithmetic.
+	 *
+	 * Same result as images[k]=eval_vector(boxes[k]) but the boxes are
+	 * evaluated by blocks, all the boxes of a block going through the
+	 * same operation at a time (see #ibex::BatchEval).
+	 */
+	void eval_batch(const IntervalVector* boxes, IntervalVector* images, int n) const;
+
+	/**
+	 * \brief Contract boxes[k] w.r.t. f(x)=y for k=0...n-1.
+	 *
+	 * Same result as backward(y,boxes[k]) but the boxes are processed by
+	 * blocks (see #ibex::BatchHC4Revise). A box outside of the definition
+	 * domain of f is set to the empty set.
+	 */
+	void backward_batch(const Domain& y, IntervalVector* boxes, int n) const;
+
+	/**
+	 * \brief Calculate f(boxes[k]) for k=0...n-1, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	void eval_batch(const IntervalVector* boxes, IntervalVector* images, int n, EvalContext& ctx) const;
+
+	/**
+	 * \brief Contract boxes[k] w.r.t. f(x)=y for k=0...n-1, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	void backward_batch(const Domain& y, IntervalVector* boxes, int n, EvalContext& ctx) const;
+
+	/**
+	 * \brief Load the kernels generated for this function.
+	 *
+	 * Once loaded, #eval, #eval_vector, #gradient, #jacobian and
+	 * #backward (in all contexts) call the compiled kernels instead of
+	 * interpreting the DAG. The kernels only use local memory so they
+	 * can be called from several threads at the same time.
+	 *
+	 * \param file   - the shared object compiled from the code
+	 *                 written by #ibex::CodeGenerator.
+	 * \param prefix - the prefix of the kernel names.
+	 * \throw CodeLoadException - see #ibex::GeneratedCode.
+	 */
+	void load_code(const char* file, const char* prefix="f");
+
 	/**
 	 * \brief Inner projection f(x)=y onto x.
 	 */
@@ -789,6 +977,18 @@ public:
 	 */
 	void ibwd(const Interval& y, IntervalVector& x, const IntervalVector& xin) const;
 
+	/**
+	 * \brief Inner projection f(x)=y onto x, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	void ibwd(const Domain& y, IntervalVector& x, EvalContext& ctx) const;
+
+	/**
+	 * \brief Inner projection f(x)=y onto x, inflating xin, in a given context.
+	 * \see #ibex::EvalContext
+	 */
+	void ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin, EvalContext& ctx) const;
+
 	/*
 	 * \brief Get a reference to the evaluator.
 	 *
@@ -817,6 +1017,13 @@ public:
 	 */
 	InHC4Revise& inhc4revise() const;
 
+	/*
+	 * \brief Get a reference to the default evaluation context.
+	 *
+	 * For internal purposes.
+	 */
+	EvalContext& context() const;
+
 	// ============================================================================
 
 
@@ -899,11 +1106,11 @@ private:
 	// point to this field (instead of being a copy)
 	Function *zero;
 
-	Eval *_eval;
-	HC4Revise *_hc4revise;
-	// TODO: actually never used if f is vector/matrix valued
-	Gradient *_grad;
-	InHC4Revise *_inhc4revise;
+	// the default context (used by eval, gradient, backward, etc.)
+	EvalContext *_ctx;
+
+	// the generated kernels (NULL if not loaded)
+	GeneratedCode* code;
 
 	// number of used vars (value "-1" means "not yet generated")
 	mutable int _nb_used_vars;
@@ -918,6 +1125,8 @@ private:
 #include "ibex_Gradient.h"
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
+#include "ibex_EvalContext.h"
+#include "ibex_GeneratedCode.h"
 
 namespace ibex {
 
@@ -974,45 +1183,64 @@ inline bool Function::all_args_scalar() const {
 }
 
 template<class V>
-inline void Function::forward(const V& algo) const {
-	cf.forward<V>(algo);
+inline bool Function::forward(const V& algo) const {
+	return cf.forward<V>(algo);
 }
 
 inline Domain& Function::eval_domain(const IntervalVector& box) const {
-	return ((Function*) this)->_eval->eval(box);
+	return eval_domain(box,*_ctx);
 }
 
 inline Domain& Function::eval_domain(const Array<const Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return _ctx->eval.eval(d);
 }
 
 inline Domain& Function::eval_domain(const Array<Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return _ctx->eval.eval(d);
 }
 
 inline Interval Function::eval(const IntervalVector& box) const {
-	return eval_domain(box).i();
+	return eval(box,*_ctx);
 }
 
 inline IntervalVector Function::eval_vector(const IntervalVector& box) const {
-	return expr().dim.is_scalar() ? IntervalVector(1,eval_domain(box).i()) : eval_domain(box).v();
+	return eval_vector(box,*_ctx);
 }
 
 inline IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
+	return eval_matrix(box,*_ctx);
+}
+
+inline Domain& Function::eval_domain(const IntervalVector& box, EvalContext& ctx) const {
+	assert(&ctx.f==this);
+	return ctx.eval.eval(box);
+}
+
+inline Interval Function::eval(const IntervalVector& box, EvalContext& ctx) const {
+	if (code && expr().dim.is_scalar()) return code->eval(box);
+	return eval_domain(box,ctx).i();
+}
+
+inline IntervalVector Function::eval_vector(const IntervalVector& box, EvalContext& ctx) const {
+	if (code) return code->eval_vector(box);
+	return expr().dim.is_scalar() ? IntervalVector(1,eval_domain(box,ctx).i()) : eval_domain(box,ctx).v();
+}
+
+inline IntervalMatrix Function::eval_matrix(const IntervalVector& box, EvalContext& ctx) const {
 	switch (expr().dim.type()) {
 	case Dim::SCALAR     :
-		return IntervalMatrix(1,1,eval_domain(box).i());
+		return IntervalMatrix(1,1,eval_domain(box,ctx).i());
 	case Dim::ROW_VECTOR : {
 		IntervalMatrix M(image_dim(),1);
-		M.set_row(0,eval_domain(box).v());
+		M.set_row(0,eval_domain(box,ctx).v());
 		return M;
 	}
 	case Dim::COL_VECTOR : {
 		IntervalMatrix M(1,image_dim());
-		M.set_col(0,eval_domain(box).v());
+		M.set_col(0,eval_domain(box,ctx).v());
 		return M;
 	}
-	case Dim::MATRIX: return eval_domain(box).m();
+	case Dim::MATRIX: return eval_domain(box,ctx).m();
 	default : {
 		throw std::logic_error("should not reach");
 	}
@@ -1021,33 +1249,89 @@ inline IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
 
 
 template<class V>
-inline void Function::backward(const V& algo) const {
-	cf.backward<V>(algo);
+inline bool Function::backward(const V& algo) const {
+	return cf.backward<V>(algo);
+}
+
+template<class V>
+inline bool Function::forward(const V& algo, const int* sub, int size) const {
+	return cf.forward<V>(algo,sub,size);
+}
+
+template<class V>
+inline bool Function::backward(const V& algo, const int* sub, int size) const {
+	return cf.backward<V>(algo,sub,size);
 }
 
 inline bool Function::backward(const Domain& y, IntervalVector& x) const {
-	return ((Function*) this)->_hc4revise->proj(y,x);
+	return backward(y,x,*_ctx);
 }
 
 inline bool Function::backward(const Interval& y, IntervalVector& x) const {
-	return backward(Domain((Interval&) y),x); // y will not be modified
+	return backward(y,x,*_ctx);
 }
 
 inline bool Function::backward(const IntervalVector& y, IntervalVector& x) const {
-	assert(expr().dim.is_vector());
-	return backward(Domain((IntervalVector&) y, expr().dim.type()==Dim::ROW_VECTOR),x); // y will not be modified
+	return backward(y,x,*_ctx);
 }
 
 inline bool Function::backward(const IntervalMatrix& y, IntervalVector& x) const {
-	return backward(Domain((IntervalMatrix&) y),x); // y will not be modified
+	return backward(y,x,*_ctx);
+}
+
+inline bool Function::backward(const Domain& y, IntervalVector& x, EvalContext& ctx) const {
+	assert(&ctx.f==this);
+	if (code && !y.dim.is_matrix()) return code->proj(y,x);
+	return ctx.hc4revise.proj(y,x);
+}
+
+inline bool Function::backward(const Interval& y, IntervalVector& x, EvalContext& ctx) const {
+	return backward(Domain((Interval&) y),x,ctx); // y will not be modified
+}
+
+inline bool Function::backward(const IntervalVector& y, IntervalVector& x, EvalContext& ctx) const {
+	assert(expr().dim.is_vector());
+	return backward(Domain((IntervalVector&) y, expr().dim.type()==Dim::ROW_VECTOR),x,ctx); // y will not be modified
+}
+
+inline bool Function::backward(const IntervalMatrix& y, IntervalVector& x, EvalContext& ctx) const {
+	return backward(Domain((IntervalMatrix&) y),x,ctx); // y will not be modified
+}
+
+inline void Function::eval_batch(const IntervalVector* boxes, IntervalVector* images, int n) const {
+	eval_batch(boxes,images,n,*_ctx);
+}
+
+inline void Function::backward_batch(const Domain& y, IntervalVector* boxes, int n) const {
+	backward_batch(y,boxes,n,*_ctx);
+}
+
+inline void Function::eval_batch(const IntervalVector* boxes, IntervalVector* images, int n, EvalContext& ctx) const {
+	assert(&ctx.f==this);
+	ctx.batch_eval().eval(boxes,images,n);
+}
+
+inline void Function::backward_batch(const Domain& y, IntervalVector* boxes, int n, EvalContext& ctx) const {
+	assert(&ctx.f==this);
+	ctx.batch_hc4revise().proj(y,boxes,n);
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x) const {
-	((Function*) this)->_inhc4revise->iproj(y,x);
+	ibwd(y,x,*_ctx);
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin) const {
-	((Function*) this)->_inhc4revise->iproj(y,x,xin);
+	ibwd(y,x,xin,*_ctx);
+}
+
+inline void Function::ibwd(const Domain& y, IntervalVector& x, EvalContext& ctx) const {
+	assert(&ctx.f==this);
+	ctx.inhc4revise.iproj(y,x);
+}
+
+inline void Function::ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin, EvalContext& ctx) const {
+	assert(&ctx.f==this);
+	ctx.inhc4revise.iproj(y,x,xin);
 }
 
 inline void Function::ibwd(const Interval& y, IntervalVector& x) const {
@@ -1071,13 +1355,19 @@ inline int Function::image_dim() const {
 }
 
 inline void Function::gradient(const IntervalVector& x, IntervalVector& g) const {
-	assert(g.size()==nb_var());
-	assert(x.size()==nb_var());
-	_grad->gradient(x,g);
+	gradient(x,g,*_ctx);
 //	if (!df) ((Function*) this)->df=new Function(*this,DIFF);
 //	g=df->eval_vector(x);
 }
 
+inline void Function::gradient(const IntervalVector& x, IntervalVector& g, EvalContext& ctx) const {
+	assert(g.size()==nb_var());
+	assert(x.size()==nb_var());
+	assert(&ctx.f==this);
+	if (code && expr().dim.is_scalar()) code->gradient(x,g);
+	else ctx.grad.gradient(x,g);
+}
+
 inline IntervalVector Function::gradient(const IntervalVector& x) const {
 	IntervalVector g(x.size());
 	gradient(x,g);
@@ -1091,19 +1381,23 @@ inline IntervalMatrix Function::jacobian(const IntervalVector& x) const {
 }
 
 inline Eval& Function::basic_evaluator() const {
-	return *_eval;
+	return _ctx->eval;
 }
 
 inline Gradient& Function::deriv_calculator() const {
-	return *_grad;
+	return _ctx->grad;
 }
 
 inline HC4Revise& Function::hc4revise() const {
-	return *_hc4revise;
+	return _ctx->hc4revise;
 }
 
 inline InHC4Revise& Function::inhc4revise() const {
-	return *_inhc4revise;
+	return _ctx->inhc4revise;
+}
+
+inline EvalContext& Function::context() const {
+	return *_ctx;
 }
 
 inline int Function::nb_used_vars() const {
@@ -21,6 +21,17 @@ namespace ibex {
  * \brief Interface for forward algorithms.
  */
 class FwdAlgorithm {
+public:
+	/**
+	 * \brief True if an empty domain has occurred.
+	 *
+	 * Checked by #ibex::CompiledFunction after each node: the forward phase
+	 * stops as soon as it returns true. Always false by default. A subclass
+	 * redefines it to signal that the box is outside the definition domain
+	 * without throwing an exception.
+	 */
+	bool fwd_empty() const { return false; }
+
 protected:
 
 	/** TO BE DEFINED (by the subclass) */
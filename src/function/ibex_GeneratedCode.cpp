@@ -0,0 +1,109 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_GeneratedCode.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_GeneratedCode.h"
+
+#include <sstream>
+#include <dlfcn.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+typedef const char* (*signature_kernel)();
+
+void* kernel(void* handle, const string& name) {
+	void* sym=dlsym(handle, name.c_str());
+	if (!sym) {
+		dlclose(handle);
+		throw CodeLoadException("missing kernel \""+name+"\"");
+	}
+	return sym;
+}
+
+}
+
+std::ostream& operator<<(std::ostream& os, const CodeLoadException& e) {
+	os << "Cannot load generated code: " << e.message();
+	return os;
+}
+
+GeneratedCode::GeneratedCode(const Function& f, const char* file, const char* prefix) : f(f) {
+
+	handle=dlopen(file, RTLD_NOW | RTLD_LOCAL);
+	if (!handle) throw CodeLoadException(dlerror());
+
+	string p(prefix);
+
+	signature_kernel sign=(signature_kernel) kernel(handle, p+"_signature");
+
+	if (signature(f)!=sign()) {
+		dlclose(handle);
+		throw CodeLoadException("the code of \""+p+"\" was generated for another function");
+	}
+
+	_eval     = (eval_kernel)     kernel(handle, p+"_eval");
+	_proj     = (proj_kernel)     kernel(handle, p+"_proj");
+	_jacobian = (jacobian_kernel) kernel(handle, p+"_jacobian");
+}
+
+GeneratedCode::~GeneratedCode() {
+	dlclose(handle);
+}
+
+string GeneratedCode::signature(const Function& f) {
+	stringstream s;
+	s << f.nb_var() << ' ' << f.image_dim() << ' ' << f.nb_nodes() << ' ' << f.expr();
+	return s.str();
+}
+
+Interval GeneratedCode::eval(const IntervalVector& x) const {
+	Interval y;
+	if (x.is_empty() || !_eval(&x[0],&y)) y.set_empty();
+	return y;
+}
+
+IntervalVector GeneratedCode::eval_vector(const IntervalVector& x) const {
+	IntervalVector y(f.image_dim());
+	if (x.is_empty() || !_eval(&x[0],&y[0])) y.set_empty();
+	return y;
+}
+
+bool GeneratedCode::proj(const Domain& y, IntervalVector& x) const {
+	assert(!y.dim.is_matrix());
+
+	bool is_inner;
+
+	if (x.is_empty() || !_proj(y.dim.is_scalar()? &y.i() : &y.v()[0], &x[0], &is_inner)) {
+		x.set_empty();
+		return false;
+	}
+
+	return is_inner;
+}
+
+void GeneratedCode::gradient(const IntervalVector& x, IntervalVector& g) const {
+	Interval* row=&g[0];
+	if (x.is_empty() || !_jacobian(&x[0],&row)) g.set_empty();
+}
+
+void GeneratedCode::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
+	int m=J.nb_rows();
+	Interval** rows=new Interval*[m];
+	for (int i=0; i<m; i++) rows[i]=&J[i][0];
+
+	if (x.is_empty() || !_jacobian(&x[0],rows)) J.set_empty();
+
+	delete[] rows;
+}
+
+} // namespace ibex
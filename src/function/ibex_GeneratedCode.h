@@ -0,0 +1,161 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_GeneratedCode.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_GENERATED_CODE_H__
+#define __IBEX_GENERATED_CODE_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_IntervalMatrix.h"
+#include "ibex_Domain.h"
+#include "ibex_Exception.h"
+
+#include <string>
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Thrown when the code of a function cannot be loaded.
+ *
+ * \see #ibex::Function::load_code(const char*, const char*).
+ */
+class CodeLoadException : public Exception {
+public:
+
+	CodeLoadException(std::string message1) : msg(message1) { }
+
+	/**
+	 * \brief Get the message of this exception
+	 */
+	const std::string& message() const { return msg; }
+
+private:
+	std::string msg;
+};
+
+std::ostream& operator<<(std::ostream& os, const CodeLoadException& e);
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Kernels generated for a function, loaded from a shared object.
+ *
+ * The kernels are produced by #ibex::CodeGenerator. They work on
+ * arrays of intervals (the components of the box, of the image, etc.)
+ * and use local memory only, so that they can be called from
+ * several threads at the same time.
+ *
+ * \see #ibex::Function::load_code(const char*, const char*).
+ */
+class GeneratedCode {
+public:
+	/**
+	 * \brief Evaluation: calculate y=f(x).
+	 *
+	 * Return false if x is outside the definition domain of f.
+	 */
+	typedef bool (*eval_kernel)(const Interval* x, Interval* y);
+
+	/**
+	 * \brief Forward-backward: contract x w.r.t. f(x) in y.
+	 *
+	 * Return false if x is outside the definition domain of f or
+	 * if the constraint is refuted. Otherwise, is_inner is set to
+	 * true iff f(x) is included in y.
+	 */
+	typedef bool (*proj_kernel)(const Interval* y, Interval* x, bool* is_inner);
+
+	/**
+	 * \brief Jacobian matrix: J[i][j] is the derivative of f_i w.r.t. x_j.
+	 *
+	 * Return false if x is outside the definition domain of f.
+	 */
+	typedef bool (*jacobian_kernel)(const Interval* x, Interval* const* J);
+
+	/**
+	 * \brief Load the kernels of f from a shared object.
+	 *
+	 * \param prefix - the prefix of the kernel names
+	 *                 (see #ibex::CodeGenerator).
+	 *
+	 * \throw CodeLoadException - if the file cannot be loaded, if a kernel
+	 *        is missing or if the code was generated for another function.
+	 */
+	GeneratedCode(const Function& f, const char* file, const char* prefix);
+
+	/**
+	 * \brief Unload the shared object.
+	 */
+	~GeneratedCode();
+
+	/**
+	 * \brief A string identifying the function.
+	 *
+	 * Stored in the generated code to check that it matches the
+	 * function it is loaded for.
+	 */
+	static std::string signature(const Function& f);
+
+	/**
+	 * \brief f(x) for a real-valued function.
+	 *
+	 * Same result as #ibex::Function::eval(const IntervalVector&).
+	 */
+	Interval eval(const IntervalVector& x) const;
+
+	/**
+	 * \brief f(x) in vector form.
+	 *
+	 * Same result as #ibex::Function::eval_vector(const IntervalVector&).
+	 */
+	IntervalVector eval_vector(const IntervalVector& x) const;
+
+	/**
+	 * \brief Contract x w.r.t. f(x) in y.
+	 *
+	 * Same result as #ibex::HC4Revise::proj(const Domain&, IntervalVector&).
+	 */
+	bool proj(const Domain& y, IntervalVector& x) const;
+
+	/**
+	 * \brief Gradient of a real-valued function.
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g) const;
+
+	/**
+	 * \brief Jacobian matrix.
+	 */
+	void jacobian(const IntervalVector& x, IntervalMatrix& J) const;
+
+	/** The function. */
+	const Function& f;
+
+	/** The evaluation kernel. */
+	eval_kernel _eval;
+
+	/** The forward-backward kernel. */
+	proj_kernel _proj;
+
+	/** The Jacobian kernel. */
+	jacobian_kernel _jacobian;
+
+private:
+	GeneratedCode(const GeneratedCode&);            // forbidden
+	GeneratedCode& operator=(const GeneratedCode&); // forbidden
+
+	/* Handle of the shared object. */
+	void* handle;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_GENERATED_CODE_H__
@@ -11,11 +11,30 @@
 
 #include "ibex_Function.h"
 #include "ibex_Gradient.h"
+#include "ibex_VarSet.h"
+
+#include <algorithm>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * The cth component of a domain (row-major order for matrices).
+ */
+inline Interval& component(Domain& d, int c) {
+	switch (d.dim.type()) {
+	case Dim::SCALAR:     return d.i();
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR: return d.v()[c];
+	default:              return d.m()[c/d.dim.nb_cols()][c%d.dim.nb_cols()];
+	}
+}
+
+}
+
 Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f) {
 
 }
@@ -66,33 +85,196 @@ void Gradient::gradient(const IntervalVector& box, IntervalVector& gbox) {
 }
 
 
-void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
+void Gradient::jacobian(const Array<Domain>& d2, IntervalMatrix& J) {
 
 	if (!f.expr().dim.is_vector()) {
 		ibex_error("Cannot called \"jacobian\" on a real-valued function");
 	}
 
-	int m=f.expr().dim.vec_size();
+	_eval.eval(d2);
+
+	jacobian(J,NULL);
+}
+
+void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J) {
+	_eval.eval(box);
+
+	jacobian(J,NULL);
+}
+
+void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const VarSet& set) {
+	_eval.eval(box);
+
+	jacobian(J,&set);
+}
+
+void Gradient::hansen_matrix(const IntervalVector& box, IntervalMatrix& H) {
+	hansen_matrix(box,H,NULL);
+}
+
+void Gradient::hansen_matrix(const IntervalVector& box, IntervalMatrix& H, const VarSet& set) {
+	hansen_matrix(box,H,&set);
+}
+
+void Gradient::hansen_matrix(const IntervalVector& box, IntervalMatrix& H, const VarSet* set) {
+
+	if (row_node.empty()) init_rows();
+
+	int m=f.image_dim();
+	int n=set ? set->nb_var : f.nb_var();
+
+	assert(H.nb_rows()==m);
+	assert(H.nb_cols()==n);
+
+	// the variable of each column
+	vector<int> col(n);
+	for (int v=0, k=0; k<n; v++)
+		if (!set || set->vars[v]) col[k++]=v;
+
+	// variables are fixed to their midpoint, except the first one.
+	IntervalVector x(box);
+	for (int k=1; k<n; k++)
+		x[col[k]]=box[col[k]].mid();
+
+	_eval.eval(x);
+
+	for (int k=0; k<n; k++) {
+		int s=var_arg[col[k]];
+		int c=var_comp[col[k]];
+
+		if (k>0) {
+			// widen the kth variable and update the nodes depending on it
+			if (arg_dep[s].empty()) f.dependent_nodes(f.nodes.rank(f.arg(s)),arg_dep[s]);
+
+			component(d.args[s],c)=box[col[k]];
+
+			_eval.eval(&arg_dep[s][0],arg_dep[s].size());
+		}
+
+		// outside definition domain -> empty matrix
+		if (d.top->is_empty()) { H.set_empty(); return; }
+
+		int sym=f.nodes.rank(f.arg(s));
+
+		for (int i=0; i<m; i++) {
+			if (row_cone[i]!=-1 && !binary_search(cones[row_cone[i]].begin(), cones[row_cone[i]].end(), sym))
+				// the ith expression does not depend on the variable
+				H[i][k]=0;
+			else {
+				row_sweep(i);
+				H[i][k]=component(g.args[s],c);
+			}
+		}
+	}
+}
+
+void Gradient::init_rows() {
+	int m=f.image_dim();
+
+	var_arg.resize(f.nb_var());
+	var_comp.resize(f.nb_var());
+	for (int s=0, v=0; s<f.nb_arg(); s++)
+		for (int c=0; c<f.arg(s).dim.size(); c++, v++) {
+			var_arg[v]=s;
+			var_comp[v]=c;
+		}
+	arg_dep.resize(f.nb_arg());
+
+	row_node.resize(m);
+	row_comp.resize(m);
+	row_cone.resize(m);
+
+	const ExprVector* vec=dynamic_cast<const ExprVector*>(&f.expr());
+
+	if (vec && vec->dim.is_vector()) {
+		// each row corresponds to a component of an argument
+		// of the vector: the backward phase can be restricted
+		// to the sub-expression of this argument.
+		int i=0;
+		for (int k=0; k<vec->length(); k++) {
+			const ExprNode& e=vec->arg(k);
+			ExprSubNodes sub(e);
+			vector<int> cone(sub.size());
+			for (int j=0; j<sub.size(); j++)
+				cone[j]=f.nodes.rank(sub[j]);
+			sort(cone.begin(),cone.end());
+			cones.push_back(cone);
+
+			for (int c=0; c<e.dim.size(); c++, i++) {
+				row_node[i]=f.nodes.rank(e);
+				row_comp[i]=c;
+				row_cone[i]=k;
+			}
+		}
+		assert(i==m);
+	} else {
+		// the root node is seeded and the backward phase
+		// is run on the whole DAG
+		for (int i=0; i<m; i++) {
+			row_node[i]=0;
+			row_comp[i]=i;
+			row_cone[i]=-1;
+		}
+	}
+}
+
+void Gradient::jacobian(IntervalMatrix& J, const VarSet* set) {
+
+	// outside definition domain -> empty jacobian
+	if (d.top->is_empty()) { J.set_empty(); return; }
+
+	if (row_node.empty()) init_rows();
+
+	int m=f.image_dim();
+
+	assert(J.nb_rows()==m);
+
+	// full gradient (only if the columns have to be selected
+	// and arguments are not all scalar)
+	IntervalVector* gbox = (set && !f.all_args_scalar()) ? new IntervalVector(f.nb_var()) : NULL;
 
-	// calculate the gradient of each component of f
 	for (int i=0; i<m; i++) {
-		const Function* fi=dynamic_cast<const Function*>(&f[i]);
-		if (fi!=NULL) {
-			// if this is a Function object we can
-			// directly calculate the gradient with d
-			fi->deriv_calculator().gradient(d,J[i]);
+
+		row_sweep(i);
+
+		if (!set) {
+			J[i].clear();
+			g.read_arg_domains(J[i]);
+		} else if (!gbox) {
+			// only the variables are read
+			for (int j=0, k=0; k<set->nb_var; j++)
+				if (set->vars[j]) J[i][k++]=g.args[j].i();
 		} else {
-			// otherwise we must give a box in argument
-			// TODO add gradient with Array<Domain> in argument
-			// in Function interface?
-			// But, for the moment, cannot happen, because
-			// this function is called by apply_bwd.
-			IntervalVector box(f.nb_var());
-			load(box,d);
-			f[i].gradient(box,J[i]);
-			if (J[i].is_empty()) { J.set_empty(); return; }
+			gbox->clear();
+			g.read_arg_domains(*gbox);
+			J.set_row(i,set->var_box(*gbox));
 		}
 	}
+
+	if (gbox) delete gbox;
+}
+
+void Gradient::row_sweep(int i) {
+
+	// symbols outside of the sub-expression must have a zero derivative.
+	for (int j=0; j<f.nb_arg(); j++)
+		g.args[j].clear();
+
+	const int* cone=NULL;
+	int size=0;
+	if (row_cone[i]!=-1) {
+		cone=&cones[row_cone[i]][0];
+		size=cones[row_cone[i]].size();
+		f.forward<Gradient>(*this,cone,size);
+	} else
+		f.forward<Gradient>(*this);
+
+	component(g[row_node[i]],row_comp[i])=1.0;
+
+	if (cone)
+		f.backward<Gradient>(*this,cone,size);
+	else
+		f.backward<Gradient>(*this);
 }
 
 void Gradient::vector_fwd(int* x, int y) {
@@ -180,7 +362,7 @@ void Gradient::apply_bwd(int* x, int y) {
 	IntervalVector tmp_g(n);
 
 	if (a.func.expr().dim.is_scalar()) {
-		a.func.deriv_calculator().gradient(d2,tmp_g);
+		_eval.ctx.apply(y).grad.gradient(d2,tmp_g);
 		//cout << "tmp-g=" << tmp_g << endl;
 		tmp_g *= g[y].i();   // pre-multiplication by y.g
 		tmp_g += old_g;      // addition to the old value of g
@@ -190,7 +372,7 @@ void Gradient::apply_bwd(int* x, int y) {
 			not_implemented("automatic differentiation of matrix-valued function");
 		int m=a.func.expr().dim.vec_size();
 		IntervalMatrix J(m,n);
-		a.func.deriv_calculator().jacobian(d2,J);
+		_eval.ctx.apply(y).grad.jacobian(d2,J);
 		tmp_g = g[y].v()*J; // pre-multiplication by y.g
 		tmp_g += old_g;
 		load(g2,tmp_g);
@@ -15,8 +15,12 @@
 #include "ibex_Eval.h"
 #include "ibex_BwdAlgorithm.h"
 
+#include <vector>
+
 namespace ibex {
 
+class VarSet;
+
 /**
  * \ingroup symbolic
  * \brief Calculates the gradient of a function.
@@ -49,6 +53,46 @@ public:
 	 */
 	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
 
+	/**
+	 * \brief Calculate the Jacobian on the box \a box and store the result in \a J.
+	 *
+	 * The function is evaluated only once (forward phase on the whole DAG).
+	 * Then, each row is obtained by a backward (reverse-mode) phase. When
+	 * f is a vector of expressions (like the function of a system), the
+	 * backward phase of the ith row is restricted to the nodes of the ith
+	 * expression.
+	 */
+	void jacobian(const IntervalVector& box, IntervalMatrix& J);
+
+	/**
+	 * \brief Calculate the Jacobian w.r.t. the variables of \a set only.
+	 *
+	 * The matrix \a J has one column per variable of \a set (parameters
+	 * are not stored).
+	 */
+	void jacobian(const IntervalVector& box, IntervalMatrix& J, const VarSet& set);
+
+	/**
+	 * \brief Calculate the Hansen matrix on the box \a box and store the result in \a H.
+	 *
+	 * The jth column of H is the jth column of the Jacobian matrix on
+	 * the box (x_1,...,x_j,mid(x_{j+1}),...,mid(x_n)).
+	 *
+	 * The forward evaluation is incremental: when x_j is widened, only
+	 * the nodes depending on x_j are re-evaluated. Then, only the rows
+	 * whose expression depend on x_j are calculated (by a backward phase),
+	 * the other entries of the column being 0.
+	 */
+	void hansen_matrix(const IntervalVector& box, IntervalMatrix& H);
+
+	/**
+	 * \brief Calculate the Hansen matrix w.r.t. the variables of \a set only.
+	 *
+	 * Parameters are fixed to their domain in \a box.
+	 * \see #hansen_matrix(const IntervalVector&, IntervalMatrix&).
+	 */
+	void hansen_matrix(const IntervalVector& box, IntervalMatrix& H, const VarSet& set);
+
 	/* ====================================== Forward =================================== */
 
 	inline void idx_fwd(int , int ) { /* nothing to do */ }
@@ -152,6 +196,52 @@ public:
 	Eval& _eval;
 	ExprDomain& d;
 	ExprDomain  g;
+
+protected:
+	/*
+	 * Calculate the rows of the Jacobian matrix (reverse sweeps),
+	 * the forward evaluation being already done.
+	 * If set!=NULL, only the columns of variables are stored.
+	 */
+	void jacobian(IntervalMatrix& J, const VarSet* set);
+
+	/*
+	 * Calculate the Hansen matrix (see above).
+	 * If set!=NULL, only the columns of variables are stored.
+	 */
+	void hansen_matrix(const IntervalVector& box, IntervalMatrix& H, const VarSet* set);
+
+	/*
+	 * Calculate the ith row of the Jacobian matrix in the
+	 * labels "g" of the symbols (reverse sweep).
+	 */
+	void row_sweep(int i);
+
+	/*
+	 * Initialize the data of the reverse sweeps (done once).
+	 */
+	void init_rows();
+
+	/* The node where the ith row is seeded */
+	std::vector<int> row_node;
+
+	/* The component of this node domain (row-major order for matrices) */
+	std::vector<int> row_comp;
+
+	/* The sub-expression of the ith row: index in "cones" (-1 means the whole DAG) */
+	std::vector<int> row_cone;
+
+	/* Sub-expressions (nodes in increasing order) */
+	std::vector<std::vector<int> > cones;
+
+	/* The argument (symbol) of the ith variable */
+	std::vector<int> var_arg;
+
+	/* The component of this symbol domain (row-major order for matrices) */
+	std::vector<int> var_comp;
+
+	/* Nodes depending on each argument (calculated on demand) */
+	std::vector<std::vector<int> > arg_dep;
 };
 
 } // namespace ibex
@@ -11,73 +11,168 @@
 #include "ibex_Function.h"
 #include "ibex_HC4Revise.h"
 
+#include <algorithm>
+#include <iterator>
+
+using namespace std;
+
 namespace ibex {
 
 const double HC4Revise::RATIO = 0.1;
 
-HC4Revise::HC4Revise(Eval& e) : f(e.f), eval(e), d(e.d) {
+HC4Revise::HC4Revise(Eval& e) : f(e.f), eval(e), d(e.d), empty(false), fwd(NULL), last(NULL), fwd_valid(false) {
+
+}
 
+HC4Revise::~HC4Revise() {
+	if (fwd) {
+		delete fwd;
+		delete last;
+	}
 }
 
-bool HC4Revise::proj(const Domain& y, Array<Domain>& x) {
+bool HC4Revise::proj(const Domain& y, Array<Domain>& x, bool& is_inner) {
 	eval.eval(x);
 
-	bool is_inner=backward(y);
+	if (!backward(y,is_inner))
+		return false;
 
 	d.read_arg_domains(x);
-
-	return is_inner;
-//	return proj(y,(const Array<const Domain>&) x);
+	return true;
 }
 
-//bool HC4Revise::proj(const Domain& y, const Array<const Domain>& x) {
-//}
-
 bool HC4Revise::proj(const Domain& y, IntervalVector& x) {
 	eval.eval(x);
 	//std::cout << "forward:" << std::endl; f.cf.print(d);
 
-	bool is_inner=false;
+	bool is_inner;
 
-	try {
-		is_inner = backward(y);
+	if (!backward(y,is_inner)) {
+		x.set_empty();
+		return false;
+	}
+
+	d.read_arg_domains(x);
+	return is_inner;
+}
 
-		d.read_arg_domains(x);
+bool HC4Revise::proj_incremental(const Domain& y, IntervalVector& x) {
 
-		return is_inner;
+	bool is_inner;
 
-	} catch(EmptyBoxException&) {
+	if (!forward_incremental(x) || !backward(y,is_inner)) {
 		x.set_empty();
 		return false;
 	}
+
+	d.read_arg_domains(x);
+	return is_inner;
 }
 
-bool HC4Revise::backward(const Domain& y) {
+bool HC4Revise::forward_incremental(const IntervalVector& x) {
+
+	if (x.is_empty()) return false;
+
+	if (!fwd) {
+		fwd=new ExprDomain(f);
+		last=new IntervalVector(x);
+		var_dep.resize(f.nb_var());
+	}
+
+	int n=f.nb_nodes();
+
+	if (!fwd_valid) {
+		// full forward
+		if (eval.eval(x).is_empty()) return false;
+
+		// note: a node domain that is a reference to another
+		// one (index, transpose) is just copied twice.
+		for (int i=0; i<n; i++)
+			(*fwd)[i]=d[i];
+
+		*last=x;
+		fwd_valid=true;
+		return true;
+	}
+
+	// union of the cones of the modified variables
+	cone.clear();
+
+	for (int v=0; v<f.nb_var(); v++) {
+		if (x[v]==(*last)[v]) continue;
+
+		vector<int>& dep=var_dep[v];
+		if (dep.empty()) f.var_dependent_nodes(v,dep);
+
+		if (cone.empty())
+			cone=dep;
+		else {
+			tmp.clear();
+			set_union(cone.begin(),cone.end(),dep.begin(),dep.end(),back_inserter(tmp));
+			cone.swap(tmp);
+		}
+	}
+
+	// the domains may have been modified by a backward
+	// phase (or by another algorithm) since the last call.
+	for (int i=0; i<n; i++)
+		d[i]=(*fwd)[i];
+
+	if (cone.empty()) return true;
+
+	d.write_arg_domains(x);
+
+	if (eval.eval(&cone[0],cone.size()).is_empty()) {
+		fwd_valid=false;
+		return false;
+	}
+
+	for (vector<int>::const_iterator it=cone.begin(); it!=cone.end(); it++)
+		(*fwd)[*it]=d[*it];
+
+	*last=x;
+	return true;
+}
+
+bool HC4Revise::backward(const Domain& y, bool& is_inner) {
 
 	Domain& root=*d.top;
 
+	is_inner=false;
+
 	if (root.is_empty())
-		throw EmptyBoxException();
+		return false;
 
 	switch(y.dim.type()) {
-	case Dim::SCALAR:       if (root.i().is_subset(y.i())) return true; break;
+	case Dim::SCALAR:       if (root.i().is_subset(y.i())) is_inner=true; break;
 	case Dim::ROW_VECTOR:
-	case Dim::COL_VECTOR:   if (root.v().is_subset(y.v())) return true; break;
-	case Dim::MATRIX:       if (root.m().is_subset(y.m())) return true; break;
+	case Dim::COL_VECTOR:   if (root.v().is_subset(y.v())) is_inner=true; break;
+	case Dim::MATRIX:       if (root.m().is_subset(y.m())) is_inner=true; break;
 	}
 
+	if (is_inner)
+		return true;
+
 	root &= y;
 
 	if (root.is_empty())
-		throw EmptyBoxException();
+		return false;
 
-	// may throw an EmptyBoxException().
-	eval.f.backward<HC4Revise>(*this);
+	empty=false;
 
-	return false;
+	return eval.f.backward<HC4Revise>(*this);
 	//std::cout << "backward:" << std::endl; f.cf.print();
 }
 
+bool HC4Revise::backward(const Domain& y) {
+	bool is_inner;
+
+	if (!backward(y,is_inner))
+		throw EmptyBoxException();
+
+	return is_inner;
+}
+
 void HC4Revise::idx_cp_bwd(int x, int y) {
 	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
 
@@ -99,11 +194,10 @@ void HC4Revise::apply_bwd(int* x, int y) {
 		d2.set_ref(i,d[x[i]]);
 	}
 
-	// if next instruction throws an EmptyBoxException,
-	// it will be caught by proj(...,IntervalVector& x).
-	// (it is a protected function, not called outside of the class
-	// so there is no risk)
-	a.func.hc4revise().proj(d[y],d2);
+	bool is_inner;
+
+	if (!eval.ctx.apply(y).hc4revise.proj(d[y],d2,is_inner))
+		empty=true;
 }
 
 void HC4Revise::vector_bwd(int* x, int y) {
@@ -118,12 +212,16 @@ void HC4Revise::vector_bwd(int* x, int y) {
 	if (v.dim.is_vector()) {
 		for (int i=0; i<v.length(); i++) {
 			if (v.arg(i).dim.is_vector()) {
-				if ((d[x[i]].v() &= d[y].v().subvector(j,j+v.arg(i).dim.vec_size())).is_empty())
-						throw EmptyBoxException();
+				if ((d[x[i]].v() &= d[y].v().subvector(j,j+v.arg(i).dim.vec_size())).is_empty()) {
+					empty=true;
+					return;
+				}
 				j+=v.arg(i).dim.vec_size();
 			} else {
-				if ((d[x[i]].i() &= d[y].v()[j]).is_empty())
-					throw EmptyBoxException();
+				if ((d[x[i]].i() &= d[y].v()[j]).is_empty()) {
+					empty=true;
+					return;
+				}
 				j++;
 			}
 		}
@@ -134,24 +232,32 @@ void HC4Revise::vector_bwd(int* x, int y) {
 		if (v.row_vector()) {
 			for (int i=0; i<v.length(); i++) {
 				if (v.arg(i).dim.is_matrix()) {
-					if ((d[x[i]].m()&=d[y].m().submatrix(0,v.dim.nb_rows(),j,v.arg(i).dim.nb_cols())).is_empty())
-						throw EmptyBoxException();
+					if ((d[x[i]].m()&=d[y].m().submatrix(0,v.dim.nb_rows(),j,v.arg(i).dim.nb_cols())).is_empty()) {
+						empty=true;
+						return;
+					}
 					j+=v.arg(i).dim.nb_cols();
 				} else if (v.arg(i).dim.is_vector()) {
-					if ((d[x[i]].v()&=d[y].m().col(j)).is_empty())
-						throw EmptyBoxException();
+					if ((d[x[i]].v()&=d[y].m().col(j)).is_empty()) {
+						empty=true;
+						return;
+					}
 					j++;
 				}
 			}
 		} else {
 			for (int i=0; i<v.length(); i++) {
 				if (v.arg(i).dim.is_matrix()) {
-					if ((d[x[i]].m()&=d[y].m().submatrix(j,v.arg(i).dim.nb_rows(),0,v.dim.nb_cols())).is_empty())
-						throw EmptyBoxException();
+					if ((d[x[i]].m()&=d[y].m().submatrix(j,v.arg(i).dim.nb_rows(),0,v.dim.nb_cols())).is_empty()) {
+						empty=true;
+						return;
+					}
 					j+=v.arg(i).dim.nb_rows();
 				} else if (v.arg(i).dim.is_vector()) {
-					if ((d[x[i]].v()&=d[y].m().row(j)).is_empty())
-						throw EmptyBoxException();
+					if ((d[x[i]].v()&=d[y].m().row(j)).is_empty()) {
+						empty=true;
+						return;
+					}
 					j++;
 				}
 			}
@@ -13,6 +13,8 @@
 
 #include "ibex_Eval.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -31,6 +33,11 @@ public:
 	 */
 	HC4Revise(Eval& e);
 
+	/**
+	 * \brief Delete this.
+	 */
+	~HC4Revise();
+
 	/**
 	 * \brief Project f(x)=y onto x (forward/backward algorithm)
 	 *
@@ -42,6 +49,23 @@ public:
 	 */
 	bool proj(const Domain& y, IntervalVector& x);
 
+	/**
+	 * \brief Project f(x)=y onto x, reusing the last forward evaluation.
+	 *
+	 * Same result as #proj(const Domain&, IntervalVector&).
+	 *
+	 * The domains calculated by the forward phase are kept from one call
+	 * to the other. Only the nodes depending on the variables whose domain
+	 * differs from the previous call are re-evaluated (the "cone" of these
+	 * variables, see #ibex::Function::var_dependent_nodes(int, std::vector<int>&)).
+	 * The backward phase is performed on the whole expression.
+	 *
+	 * This saves time when successive boxes only differ on a few
+	 * variables (e.g., after a bisection) and the function is
+	 * loosely coupled.
+	 */
+	bool proj_incremental(const Domain& y, IntervalVector& x);
+
 	/**
 	 * \brief Ratio for the contraction of a
 	 * matrix-vector / matrix-matrix multiplication.
@@ -50,38 +74,70 @@ public:
 	 */
 	static const double RATIO;
 
+	/**
+	 * \brief True if an empty domain has occurred during the last backward phase.
+	 *
+	 * Used by CompiledFunction to interrupt the backward procedure.
+	 */
+	bool bwd_empty() const;
+
 protected:
 	/**
-	 * Class used internally to interrupt the
-	 * backward procedure when an empty domain occurs.
+	 * Exception thrown by #backward(const Domain&) when an empty domain occurs.
 	 */
 	class EmptyBoxException { };
 
 	/**
 	 * Contract x w.r.t. f(x)=y, with forward + backward.
 	 *
-	 * \warning: may throw EmptyBoxException
+	 * \param is_inner - set to true iff f(x) is included in y
+	 *        (inactive constraint).
+	 * \return false if an empty domain occurs (x is outside the
+	 *         definition domain of f or f(x)=y is refuted).
 	 */
-//	bool proj(const Domain& y, const Array<const Domain>& x);
+	bool proj(const Domain& y, Array<Domain>& x, bool& is_inner);
 
 	/**
-	 * Contract x w.r.t. f(x)=y, with forward + backward.
+	 * Backward of f(x)=y.
 	 *
-	 * \warning: may throw EmptyBoxException
+	 * \param is_inner - set to true iff f(x) is included in y
+	 *        (inactive constraint).
+	 * \return false if an empty domain occurs.
 	 */
-	bool proj(const Domain& y, Array<Domain>& x);
+	bool backward(const Domain& y, bool& is_inner);
 
 	/**
 	 * Backward of f(x)=y.
 	 *
+	 * Same as #backward(const Domain&, bool&) but signals
+	 * an empty domain with an exception.
+	 *
+	 * \return true iff f(x) is included in y.
 	 * \warning: may throw EmptyBoxException
 	 */
 	bool backward(const Domain& y);
 
+	/**
+	 * Forward of f on x, with the incremental mode.
+	 *
+	 * \return false if x is outside the definition domain of f.
+	 */
+	bool forward_incremental(const IntervalVector& x);
+
 	Function& f;
 	Eval& eval;
 	ExprDomain& d;
 
+	/* Set when an empty domain occurs. */
+	bool empty;
+
+	/* Incremental mode (built on first call of proj_incremental) */
+	ExprDomain* fwd;                      // domains of the last forward phase
+	IntervalVector* last;                 // box of the last forward phase
+	bool fwd_valid;                       // true if fwd matches last
+	std::vector<std::vector<int> > var_dep; // nodes depending on each variable (computed on demand)
+	std::vector<int> cone, tmp;           // nodes to re-evaluate
+
 public: // because called from CompiledFunction
 	inline void idx_bwd    (int, int)          { /* nothing to do */ }
 	       void idx_cp_bwd (int, int);
@@ -89,48 +145,54 @@ public: // because called from CompiledFunction
 	inline void symbol_bwd (int)                 { /* nothing to do */ }
 	inline void cst_bwd    (int)                 { /* nothing to do */ }
 	       void apply_bwd  (int* x, int y);
-	inline void chi_bwd(int a, int b, int c, int y){ if (!(bwd_chi(d[y].i(),d[a].i(),d[b].i(),d[c].i()))) throw EmptyBoxException();  }
-	inline void add_bwd    (int x1, int x2, int y) { if (!(bwd_add(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void add_V_bwd  (int x1, int x2, int y) { if (!(bwd_add(d[y].v(),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
-	inline void add_M_bwd  (int x1, int x2, int y) { if (!(bwd_add(d[y].m(),d[x1].m(),d[x2].m()))) throw EmptyBoxException();  }
-	inline void mul_bwd    (int x1, int x2, int y) { if (!(bwd_mul(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void mul_SV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].i(),d[x2].v()))) throw EmptyBoxException();  }
-	inline void mul_SM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].m(),d[x1].i(),d[x2].m()))) throw EmptyBoxException();  }
-	inline void mul_VV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].i(),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
-	inline void mul_MV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].m(),d[x2].v(), RATIO))) throw EmptyBoxException();  }
-	inline void mul_VM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].v(),d[x2].m(), RATIO))) throw EmptyBoxException();  }
-	inline void mul_MM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].m(),d[x1].m(),d[x2].m(), RATIO))) throw EmptyBoxException();  }
-	inline void sub_bwd    (int x1, int x2, int y) { if (!(bwd_sub(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void sub_V_bwd  (int x1, int x2, int y) { if (!(bwd_sub(d[y].v(),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
-	inline void sub_M_bwd  (int x1, int x2, int y) { if (!(bwd_sub(d[y].m(),d[x1].m(),d[x2].m()))) throw EmptyBoxException();  }
-	inline void div_bwd    (int x1, int x2, int y) { if (!(bwd_div(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void max_bwd    (int x1, int x2, int y) { if (!(bwd_max(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void min_bwd    (int x1, int x2, int y) { if (!(bwd_min(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void atan2_bwd  (int x1, int x2, int y) { if (!(bwd_atan2(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void minus_bwd  (int x, int y)          { if ((d[x].i() &=-d[y].i()).is_empty()) throw EmptyBoxException();  }
-    inline void trans_V_bwd(int x, int y)          { if ((d[x].v() &= d[y].v()).is_empty()) throw EmptyBoxException();  }
-    inline void trans_M_bwd(int x, int y)          { if ((d[x].m() &= d[y].m().transpose()).is_empty()) throw EmptyBoxException();  }
-	inline void sign_bwd   (int x, int y)          { if (!(bwd_sign(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void abs_bwd    (int x, int y)          { if (!(bwd_abs(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void power_bwd  (int x, int y, int p)   { if (!(bwd_pow(d[y].i(),p, d[x].i()))) throw EmptyBoxException();  }
-	inline void sqr_bwd    (int x, int y)          { if (!(bwd_sqr(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void sqrt_bwd   (int x, int y)          { if (!(bwd_sqrt(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void exp_bwd    (int x, int y)          { if (!(bwd_exp(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void log_bwd    (int x, int y)          { if (!(bwd_log(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void cos_bwd    (int x, int y)          { if (!(bwd_cos(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void sin_bwd    (int x, int y)          { if (!(bwd_sin(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void tan_bwd    (int x, int y)          { if (!(bwd_tan(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void cosh_bwd   (int x, int y)          { if (!(bwd_cosh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void sinh_bwd   (int x, int y)          { if (!(bwd_sinh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void tanh_bwd   (int x, int y)          { if (!(bwd_tanh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void acos_bwd   (int x, int y)          { if (!(bwd_acos(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void asin_bwd   (int x, int y)          { if (!(bwd_asin(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void atan_bwd   (int x, int y)          { if (!(bwd_atan(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void acosh_bwd  (int x, int y)          { if (!(bwd_acosh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void asinh_bwd  (int x, int y)          { if (!(bwd_asinh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void atanh_bwd  (int x, int y)          { if (!(bwd_atanh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
+	inline void chi_bwd(int a, int b, int c, int y){ if (!(bwd_chi(d[y].i(),d[a].i(),d[b].i(),d[c].i()))) empty=true;  }
+	inline void add_bwd    (int x1, int x2, int y) { if (!(bwd_add(d[y].i(),d[x1].i(),d[x2].i()))) empty=true;  }
+	inline void add_V_bwd  (int x1, int x2, int y) { if (!(bwd_add(d[y].v(),d[x1].v(),d[x2].v()))) empty=true;  }
+	inline void add_M_bwd  (int x1, int x2, int y) { if (!(bwd_add(d[y].m(),d[x1].m(),d[x2].m()))) empty=true;  }
+	inline void mul_bwd    (int x1, int x2, int y) { if (!(bwd_mul(d[y].i(),d[x1].i(),d[x2].i()))) empty=true;  }
+	inline void mul_SV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].i(),d[x2].v()))) empty=true;  }
+	inline void mul_SM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].m(),d[x1].i(),d[x2].m()))) empty=true;  }
+	inline void mul_VV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].i(),d[x1].v(),d[x2].v()))) empty=true;  }
+	inline void mul_MV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].m(),d[x2].v(), RATIO))) empty=true;  }
+	inline void mul_VM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].v(),d[x2].m(), RATIO))) empty=true;  }
+	inline void mul_MM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].m(),d[x1].m(),d[x2].m(), RATIO))) empty=true;  }
+	inline void sub_bwd    (int x1, int x2, int y) { if (!(bwd_sub(d[y].i(),d[x1].i(),d[x2].i()))) empty=true;  }
+	inline void sub_V_bwd  (int x1, int x2, int y) { if (!(bwd_sub(d[y].v(),d[x1].v(),d[x2].v()))) empty=true;  }
+	inline void sub_M_bwd  (int x1, int x2, int y) { if (!(bwd_sub(d[y].m(),d[x1].m(),d[x2].m()))) empty=true;  }
+	inline void div_bwd    (int x1, int x2, int y) { if (!(bwd_div(d[y].i(),d[x1].i(),d[x2].i()))) empty=true;  }
+	inline void max_bwd    (int x1, int x2, int y) { if (!(bwd_max(d[y].i(),d[x1].i(),d[x2].i()))) empty=true;  }
+	inline void min_bwd    (int x1, int x2, int y) { if (!(bwd_min(d[y].i(),d[x1].i(),d[x2].i()))) empty=true;  }
+	inline void atan2_bwd  (int x1, int x2, int y) { if (!(bwd_atan2(d[y].i(),d[x1].i(),d[x2].i()))) empty=true;  }
+	inline void minus_bwd  (int x, int y)          { if ((d[x].i() &=-d[y].i()).is_empty()) empty=true;  }
+    inline void trans_V_bwd(int x, int y)          { if ((d[x].v() &= d[y].v()).is_empty()) empty=true;  }
+    inline void trans_M_bwd(int x, int y)          { if ((d[x].m() &= d[y].m().transpose()).is_empty()) empty=true;  }
+	inline void sign_bwd   (int x, int y)          { if (!(bwd_sign(d[y].i(),d[x].i()))) empty=true;  }
+	inline void abs_bwd    (int x, int y)          { if (!(bwd_abs(d[y].i(),d[x].i()))) empty=true;  }
+	inline void power_bwd  (int x, int y, int p)   { if (!(bwd_pow(d[y].i(),p, d[x].i()))) empty=true;  }
+	inline void sqr_bwd    (int x, int y)          { if (!(bwd_sqr(d[y].i(),d[x].i()))) empty=true;  }
+	inline void sqrt_bwd   (int x, int y)          { if (!(bwd_sqrt(d[y].i(),d[x].i()))) empty=true;  }
+	inline void exp_bwd    (int x, int y)          { if (!(bwd_exp(d[y].i(),d[x].i()))) empty=true;  }
+	inline void log_bwd    (int x, int y)          { if (!(bwd_log(d[y].i(),d[x].i()))) empty=true;  }
+	inline void cos_bwd    (int x, int y)          { if (!(bwd_cos(d[y].i(),d[x].i()))) empty=true;  }
+	inline void sin_bwd    (int x, int y)          { if (!(bwd_sin(d[y].i(),d[x].i()))) empty=true;  }
+	inline void tan_bwd    (int x, int y)          { if (!(bwd_tan(d[y].i(),d[x].i()))) empty=true;  }
+	inline void cosh_bwd   (int x, int y)          { if (!(bwd_cosh(d[y].i(),d[x].i()))) empty=true;  }
+	inline void sinh_bwd   (int x, int y)          { if (!(bwd_sinh(d[y].i(),d[x].i()))) empty=true;  }
+	inline void tanh_bwd   (int x, int y)          { if (!(bwd_tanh(d[y].i(),d[x].i()))) empty=true;  }
+	inline void acos_bwd   (int x, int y)          { if (!(bwd_acos(d[y].i(),d[x].i()))) empty=true;  }
+	inline void asin_bwd   (int x, int y)          { if (!(bwd_asin(d[y].i(),d[x].i()))) empty=true;  }
+	inline void atan_bwd   (int x, int y)          { if (!(bwd_atan(d[y].i(),d[x].i()))) empty=true;  }
+	inline void acosh_bwd  (int x, int y)          { if (!(bwd_acosh(d[y].i(),d[x].i()))) empty=true;  }
+	inline void asinh_bwd  (int x, int y)          { if (!(bwd_asinh(d[y].i(),d[x].i()))) empty=true;  }
+	inline void atanh_bwd  (int x, int y)          { if (!(bwd_atanh(d[y].i(),d[x].i()))) empty=true;  }
 };
 
+/*================================== inline implementations ========================================*/
+
+inline bool HC4Revise::bwd_empty() const {
+	return empty;
+}
+
 } // namespace ibex
 
 #endif // __IBEX_HC4_REVISE_H__
@@ -13,7 +13,7 @@
 
 namespace ibex {
 
-InHC4Revise::InHC4Revise(Eval& e) : f(e.f), eval(e), d(e.d), p_eval(f), p(p_eval.d) {
+InHC4Revise::InHC4Revise(Eval& e) : f(e.f), eval(e), d(e.d), p_eval(e.ctx), p(p_eval.d) {
 
 }
 
@@ -102,7 +102,7 @@ void InHC4Revise::apply_bwd(int* x, int y) {
 	// it will be caught by iproj(...,IntervalVector& x).
 	// (it is a protected function, not called outside of the class
 	// so there is no risk)
-	a.func.inhc4revise().iproj(d[y],d2,p2);
+	eval.ctx.apply(y).inhc4revise.iproj(d[y],d2,p2);
 }
 
 } // end namespace ibex
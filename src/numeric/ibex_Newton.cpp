@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Newton.h"
@@ -13,6 +13,7 @@
 #include "ibex_LinearException.h"
 
 #include <cassert>
+#include <cmath>
 
 using namespace std;
 
@@ -20,6 +21,7 @@ namespace ibex {
 
 double default_newton_prec=1e-07;
 double default_gauss_seidel_ratio=1e-04;
+double default_precond_reuse_ratio=0.1;
 
 
 namespace {
@@ -32,9 +34,46 @@ namespace {
 //	mid = box.mid();
 //	Fmid=f.eval_vector(mid);
 //
+
+// infinity norm of A-B
+double norm_diff(const Matrix& A, const Matrix& B) {
+	double norm=0;
+	for (int i=0; i<A.nb_rows(); i++) {
+		double sum=0;
+		for (int j=0; j<A.nb_cols(); j++)
+			sum+=fabs(A[i][j]-B[i][j]);
+		if (sum>norm) norm=sum;
+	}
+	return norm;
+}
+
+}
+
+NewtonPrecond::NewtonPrecond(const IntervalMatrix& J) : M(J.mid()), C(J.nb_rows(),J.nb_cols()), norm_C(0) {
+	try { real_inverse(M, C); }
+	catch (SingularMatrixException&) {
+		try { M=J.lb(); real_inverse(M, C); }
+		catch (SingularMatrixException&) {
+			M=J.ub(); real_inverse(M, C);
+		}
+	}
+
+	for (int i=0; i<C.nb_rows(); i++) {
+		double sum=0;
+		for (int j=0; j<C.nb_cols(); j++)
+			sum+=fabs(C[i][j]);
+		if (sum>norm_C) norm_C=sum;
+	}
+}
+
+bool NewtonPrecond::close(const Matrix& mid, double ratio) const {
+	if (mid.nb_rows()!=M.nb_rows() || mid.nb_cols()!=M.nb_cols()) return false;
+	// note: the norm of C is +oo if the inversion has overflowed
+	return norm_C*norm_diff(mid,M)<=ratio;
 }
 
-bool newton(const Function& f, const VarSet* vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
+bool newton(const Function& f, const VarSet* vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel,
+		shared_ptr<const NewtonPrecond>* pc, double reuse_ratio, IntervalMatrix* H=NULL, IntervalVector* H_box=NULL) {
 	int n=vars? vars->nb_var : f.nb_var();
 	int m=f.image_dim();
 	assert(full_box.size()==f.nb_var());
@@ -52,6 +91,8 @@ bool newton(const Function& f, const VarSet* vars, IntervalVector& full_box, dou
 
 	y1 = box.mid();
 
+	if (H_box) H_box->set_empty();
+
 	do {
 		if (vars)
 			f.hansen_matrix(full_box,J,*vars);
@@ -61,6 +102,12 @@ bool newton(const Function& f, const VarSet* vars, IntervalVector& full_box, dou
 
 		if (J.is_empty()) break;
 
+		if (H) {
+			// J is modified by the preconditioning
+			*H=J;
+			*H_box=full_box;
+		}
+
 		/* remove this block
 		 *
 		 for (int i=0; i<m; i++)
@@ -79,7 +126,13 @@ bool newton(const Function& f, const VarSet* vars, IntervalVector& full_box, dou
 		y1=y;
 
 		try {
-			precond(J, Fmid);
+			if (pc) {
+				if (!*pc || !(*pc)->close(J.mid(), reuse_ratio))
+					*pc = shared_ptr<const NewtonPrecond>(new NewtonPrecond(J));
+				J = (*pc)->C*J;
+				Fmid = (*pc)->C*Fmid;
+			} else
+				precond(J, Fmid);
 
 			gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
 
@@ -120,11 +173,23 @@ bool newton(const Function& f, const VarSet* vars, IntervalVector& full_box, dou
 }
 
 bool newton(const Function& f, IntervalVector& box, double prec, double ratio_gauss_seidel) {
-	return newton(f,NULL,box,prec,ratio_gauss_seidel);
+	return newton(f,NULL,box,prec,ratio_gauss_seidel,NULL,0);
 }
 
 bool newton(const Function& f, const VarSet& vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
-	return newton(f,&vars,full_box,prec,ratio_gauss_seidel);
+	return newton(f,&vars,full_box,prec,ratio_gauss_seidel,NULL,0);
+}
+
+bool newton(const Function& f, IntervalVector& box, shared_ptr<const NewtonPrecond>& pc, double prec, double ratio_gauss_seidel, double reuse_ratio) {
+	return newton(f,NULL,box,prec,ratio_gauss_seidel,&pc,reuse_ratio);
+}
+
+bool newton(const Function& f, const VarSet& vars, IntervalVector& full_box, shared_ptr<const NewtonPrecond>& pc, double prec, double ratio_gauss_seidel, double reuse_ratio) {
+	return newton(f,&vars,full_box,prec,ratio_gauss_seidel,&pc,reuse_ratio);
+}
+
+bool newton(const Function& f, IntervalVector& box, IntervalMatrix& H, IntervalVector& H_box, shared_ptr<const NewtonPrecond>* pc, double prec, double ratio_gauss_seidel, double reuse_ratio) {
+	return newton(f,NULL,box,prec,ratio_gauss_seidel,pc,reuse_ratio,&H,&H_box);
 }
 
 bool inflating_newton(const Function& f, const VarSet* vars, IntervalVector& full_box, int k_max, double mu_max, double delta, double chi) {
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_NEWTON_H__
@@ -14,6 +14,8 @@
 #include "ibex_Function.h"
 #include "ibex_VarSet.h"
 
+#include <memory>
+
 namespace ibex {
 
 /**
@@ -26,6 +28,55 @@ extern double default_newton_prec;
  */
 extern double default_gauss_seidel_ratio;
 
+/**
+ * \brief Default ratio for reusing a preconditioner
+ */
+extern double default_precond_reuse_ratio;
+
+/** \ingroup numeric
+ *
+ * \brief Preconditioner of the Newton operator.
+ *
+ * The inverse C of a real matrix M extracted from a Hansen matrix (its midpoint,
+ * or its lower or upper bound if the midpoint is singular).
+ *
+ * A preconditioner can be kept from one call of
+ * \link ibex::newton(const Function&, IntervalVector&, std::shared_ptr<const NewtonPrecond>&, double, double, double) newton \endlink
+ * to the next one, typically from a node of the search tree to its children.
+ * It is reused for a Hansen matrix [J] as long as
+ * \f[\|C\|\cdot\|{\rm mid}[J]-M\| \le ratio\f] (with the infinity norm), which bounds
+ * \f$\|I-C\cdot{\rm mid}[J]\|\f$: the preconditioned midpoint matrix is still close
+ * to the identity and computing the inverse of mid[J] again is not worth it.
+ * Note that the Newton operator is correct whatever the preconditioner is
+ * (only the contraction can be weaker).
+ */
+class NewtonPrecond {
+public:
+	/**
+	 * \brief Compute the preconditioner of a Hansen matrix.
+	 *
+	 * \throw SingularMatrixException if no real matrix extracted from [J] could be inverted.
+	 */
+	NewtonPrecond(const IntervalMatrix& J);
+
+	/**
+	 * \brief True iff this preconditioner can be used for \a J.
+	 *
+	 * \param mid - the midpoint of [J]
+	 * \param ratio - see above.
+	 */
+	bool close(const Matrix& mid, double ratio) const;
+
+	/** The inverted matrix. */
+	Matrix M;
+
+	/** The preconditioner (inverse of M) */
+	Matrix C;
+
+	/** The infinity norm of C */
+	double norm_C;
+};
+
 /** \ingroup numeric
  *
  * \brief Multivariate Newton operator (contracting).
@@ -51,6 +102,48 @@ bool newton(const Function& f, IntervalVector& box, double prec=default_newton_p
  */
 bool newton(const Function& f, const VarSet& vars, IntervalVector& full_box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
 
+/**
+ * \brief Newton with a reusable preconditioner.
+ *
+ * Same as #newton(const Function&, IntervalVector&, double, double) except
+ * that the preconditioner \a pc is reused if it is close enough to the inverse
+ * of the midpoint of the Hansen matrix (see #ibex::NewtonPrecond). Otherwise
+ * (or if \a pc is NULL) a new preconditioner is computed and \a pc is updated.
+ *
+ * The preconditioner is shared (and never modified), so that several
+ * calls (e.g., in the two children of a node) can start with the same one.
+ *
+ * \param reuse_ratio (optional) - see #ibex::NewtonPrecond. The default value is
+ * #default_precond_reuse_ratio (0.1). With 0, a preconditioner is reused only if
+ * the midpoint of the Hansen matrix has not changed.
+ */
+bool newton(const Function& f, IntervalVector& box, std::shared_ptr<const NewtonPrecond>& pc,
+		double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio,
+		double reuse_ratio=default_precond_reuse_ratio);
+
+/**
+ * \brief Newton with a reusable preconditioner on a subset of variables.
+ */
+bool newton(const Function& f, const VarSet& vars, IntervalVector& full_box, std::shared_ptr<const NewtonPrecond>& pc,
+		double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio,
+		double reuse_ratio=default_precond_reuse_ratio);
+
+/**
+ * \brief Newton returning the last Hansen matrix.
+ *
+ * Same as #newton(const Function&, IntervalVector&, std::shared_ptr<const NewtonPrecond>&, double, double, double)
+ * (or #newton(const Function&, IntervalVector&, double, double) if \a pc is NULL) except that, in return,
+ * \a H is the last Hansen matrix computed and \a H_box the box where it has been computed
+ * (the matrix can be reused, see #ibex::JacobianCache). \a H_box is empty if no matrix has been computed.
+ *
+ * \pre \a H is a m*n matrix and \a H_box a n-dimensional vector, where n (resp. m) is
+ * the number of variables (resp. of equations).
+ */
+bool newton(const Function& f, IntervalVector& box, IntervalMatrix& H, IntervalVector& H_box,
+		std::shared_ptr<const NewtonPrecond>* pc=NULL,
+		double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio,
+		double reuse_ratio=default_precond_reuse_ratio);
+
 /**
  * \ingroup numeric
  *
@@ -72,6 +72,17 @@ public:
 	 */
   virtual void separate(IntervalVector& x_in, IntervalVector& x_out) = 0;
 
+	/**
+	 * \brief Separate several boxes.
+	 *
+	 * Separate x_in[k] and x_out[k] for k=0...n-1. By default,
+	 * this function calls separate(x_in[k],x_out[k]) for each box.
+	 *
+	 * Used to process all the leaves of a set at the same depth at once
+	 * (see #contract(Set&, double)).
+	 */
+	virtual void separate_batch(IntervalVector* x_in, IntervalVector* x_out, int n);
+
 	/**
 	 * \brief Contract a set with this separator.
 	 *
@@ -134,6 +145,11 @@ inline Sep::Sep(int n) : nb_var(n), _status1(YES), _status2(NO) { }
 
 inline Sep::~Sep() { }
 
+inline void Sep::separate_batch(IntervalVector* x_in, IntervalVector* x_out, int n) {
+	for (int k=0; k<n; k++)
+		separate(x_in[k],x_out[k]);
+}
+
 inline BoolInterval Sep::status1() const { return _status1; }
 
 inline BoolInterval Sep::status2() const { return _status2; }
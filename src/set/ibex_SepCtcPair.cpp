@@ -26,4 +26,12 @@ void SepCtcPair::separate(IntervalVector& x_in, IntervalVector& x_out) {
 
 }
 
+void SepCtcPair::separate_batch(IntervalVector* x_in, IntervalVector* x_out, int n) {
+
+	ctc_out.contract_batch(x_out,n);
+
+	ctc_in.contract_batch(x_in,n);
+
+}
+
 } // namespace ibex
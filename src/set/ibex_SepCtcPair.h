@@ -34,6 +34,14 @@ public:
 	 */
 	virtual void separate(IntervalVector& x_in, IntervalVector& x_out);
 
+	/**
+	 * \brief Separate several boxes.
+	 *
+	 * Each contractor is applied to all the boxes at once
+	 * (see #ibex::Ctc::contract_batch(IntervalVector*, int)).
+	 */
+	virtual void separate_batch(IntervalVector* x_in, IntervalVector* x_out, int n);
+
 	/** Inner contractor */
 	Ctc& ctc_in;
 	/** Outer contractor */
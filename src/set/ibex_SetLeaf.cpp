@@ -8,6 +8,7 @@
 //============================================================================
 
 #include <stdlib.h>
+#include <vector>
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
 #include "ibex_SetInterval.h"
@@ -214,76 +215,141 @@ SetNode* SetLeaf::inter(bool iset, const IntervalVector& nodebox, Sep& sep, doub
 	if (status==NO || (iset && status==YES))
 		return this;
 
-	IntervalVector box1(nodebox);
-	IntervalVector box2(nodebox);
+	// The leaves created by bisection are processed by "frontiers"
+	// (breadth-first) instead of recursively: the boxes of all the
+	// leaves of a frontier are separated at once (see Sep::separate_batch).
+	// Each leaf of the next frontier is a placeholder (with the same status
+	// as this leaf) already linked in the tree, and replaced once processed.
 
-	sep.separate(box1,box2);
+	SetBisect* top_father=father;
+	father=NULL; // a placeholder without father is the root of the subtree
+	SetNode* root=this;
 
-	if (nodebox.max_diam()<=eps) {
-		if (box1.is_empty()) status=sep.status1();
-		else if (box2.is_empty()) status=sep.status2();
-		else if (!iset) status = MAYBE;
-		return this;
-	}
+	vector<SetLeaf*> leaves(1,this);
+	vector<IntervalVector> boxes(1,nodebox);
 
-	BoolInterval tmp_leaf2_status = sep.status1()==YES? MAYBE : YES;
-	pair<SetNode*,SetLeaf*> new_nodes2=diff(nodebox, box1, sep.status1(), tmp_leaf2_status, 0);
+	vector<SetBisect*> bisects; // bisections created (in order of creation)
 
-	SetNode* root2=new_nodes2.first;
-	SetLeaf* leaf2=new_nodes2.second;
+	while (!leaves.empty()) {
 
-	if (leaf2!=NULL) {
+		int n=leaves.size();
 
-		BoolInterval tmp_leaf3_status = sep.status2()==YES? MAYBE : YES;
-		pair<SetNode*,SetLeaf*> new_nodes3=diff(box1, box2, sep.status2(), tmp_leaf3_status, 0);
+		vector<IntervalVector> box1(boxes);
+		vector<IntervalVector> box2(boxes);
 
-		SetNode* root3=new_nodes3.first;
-		SetLeaf* leaf3=new_nodes3.second;
+		sep.separate_batch(&box1[0],&box2[0],n);
 
-		if (leaf2==root2) {
-			delete root2;
-			root2=root3;
-		} else {
-			leaf2->replace_with(root3);
-		}
+		vector<SetLeaf*> next_leaves;
+		vector<IntervalVector> next_boxes;
 
-		if (leaf3!=NULL) {
+		for (int k=0; k<n; k++) {
 
-			IntervalVector box=box1 & box2;
-			SetNode* root4;
+			SetLeaf* leaf=leaves[k];
 
-			if (box.max_diam()>eps) {
-				int var=box.extr_diam_index(false);
-				pair<IntervalVector,IntervalVector> p=box.bisect(var);
-				double pt=p.first[var].ub();
-				assert(box[var].interior_contains(pt));
+			if (boxes[k].max_diam()<=eps) {
+				if (box1[k].is_empty()) leaf->status=sep.status1();
+				else if (box2[k].is_empty()) leaf->status=sep.status2();
+				else if (!iset) leaf->status = MAYBE;
+				continue; // the leaf is left in place
+			}
 
-				SetNode* left = new SetLeaf(status);
-				SetNode* right = new SetLeaf(status);
+			BoolInterval tmp_leaf2_status = sep.status1()==YES? MAYBE : YES;
+			pair<SetNode*,SetLeaf*> new_nodes2=diff(boxes[k], box1[k], sep.status1(), tmp_leaf2_status, 0);
 
-				SetBisect* bis = new SetBisect(var, pt);
-				bis->left = left->inter(iset, p.first, sep, eps);
-				bis->left->father = bis;
-				bis->right = right->inter(iset, p.second, sep, eps);
-				bis->right->father = bis;
-				root4=bis->try_merge();
-			} else {
-				root4=new SetLeaf(status);
-				root4=root4->inter(iset, box, sep, eps);
-			}
+			SetNode* root2=new_nodes2.first;
+			SetLeaf* leaf2=new_nodes2.second;
 
-			//TODO : we may have two sons with same status!
+			if (leaf2!=NULL) {
 
-			if (leaf3==root2) {
-				delete root2;
-				root2=root4;
-			} else {
-				leaf3->replace_with(root4);
+				BoolInterval tmp_leaf3_status = sep.status2()==YES? MAYBE : YES;
+				pair<SetNode*,SetLeaf*> new_nodes3=diff(box1[k], box2[k], sep.status2(), tmp_leaf3_status, 0);
+
+				SetNode* root3=new_nodes3.first;
+				SetLeaf* leaf3=new_nodes3.second;
+
+				if (leaf2==root2) {
+					delete root2;
+					root2=root3;
+				} else {
+					leaf2->replace_with(root3);
+				}
+
+				if (leaf3!=NULL) {
+
+					IntervalVector box=box1[k] & box2[k];
+					SetNode* root4;
+
+					if (box.max_diam()>eps) {
+						int var=box.extr_diam_index(false);
+						pair<IntervalVector,IntervalVector> p=box.bisect(var);
+						double pt=p.first[var].ub();
+						assert(box[var].interior_contains(pt));
+
+						SetLeaf* left = new SetLeaf(leaf->status);
+						SetLeaf* right = new SetLeaf(leaf->status);
+
+						SetBisect* bis = new SetBisect(var, pt);
+						bis->left = left;
+						left->father = bis;
+						bis->right = right;
+						right->father = bis;
+						bisects.push_back(bis);
+
+						next_leaves.push_back(left);
+						next_boxes.push_back(p.first);
+						next_leaves.push_back(right);
+						next_boxes.push_back(p.second);
+						root4=bis;
+					} else {
+						SetLeaf* leaf4 = new SetLeaf(leaf->status);
+						next_leaves.push_back(leaf4);
+						next_boxes.push_back(box);
+						root4=leaf4;
+					}
+
+					//TODO : we may have two sons with same status!
+
+					if (leaf3==root2) {
+						delete root2;
+						root2=root4;
+					} else {
+						leaf3->replace_with(root4);
+					}
+				}
+			}
+
+			// replace the placeholder (note: may delete this)
+			if (leaf->father!=NULL)
+				leaf->replace_with(root2);
+			else {
+				delete leaf;
+				root=root2;
 			}
 		}
+
+		leaves.swap(next_leaves);
+		boxes.swap(next_boxes);
 	}
-	delete this;
-	return root2;
+
+	// status of children may have changed --> try merge (bottom-up)
+	for (int i=bisects.size()-1; i>=0; i--) {
+		SetBisect* bis=bisects[i];
+		SetBisect* bis_father=bis->father;
+		bool is_left=bis_father!=NULL && bis_father->left==bis;
+
+		SetNode* node=bis->try_merge();
+		if (node==bis) continue;
+
+		if (bis_father!=NULL) {
+			if (is_left) bis_father->left=node;
+			else bis_father->right=node;
+			node->father=bis_father;
+		} else
+			root=node;
+	}
+
+	root->father=top_father;
+	return root;
 }
 
 SetNode* SetLeaf::inter(bool iset, const IntervalVector& nodebox, const IntervalVector& x, BoolInterval xstatus) {
@@ -5,11 +5,30 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 11, 2012
-// Last Update : May 11, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Backtrackable.h"
 
 namespace ibex {
 
+std::vector<Backtrackable*> Backtrackable::down(int k) {
+	std::vector<Backtrackable*> data;
+	while ((int) data.size()<k) {
+		std::pair<Backtrackable*,Backtrackable*> p=down();
+		data.push_back(p.first);
+		if ((int) data.size()<k) data.push_back(p.second);
+		else delete p.second;
+	}
+	return data;
+}
+
+bool Backtrackable::serialize(std::ostream& os) const {
+	return false;
+}
+
+Backtrackable* Backtrackable::deserialize(std::istream& is) const {
+	return NULL;
+}
+
 } // end namespace ibex
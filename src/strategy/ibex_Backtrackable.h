@@ -5,13 +5,15 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 11, 2012
-// Last Update : May 11, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_BACKTRACKABLE_H__
 #define __IBEX_BACKTRACKABLE_H__
 
 #include <utility>
+#include <iostream>
+#include <vector>
 
 namespace ibex {
 
@@ -28,6 +30,10 @@ namespace ibex {
  * by aggregating children node structures when backtracking (this might be done in a future release).
  *
  * This class is an interface to be implemented by any operator data class associated to a cell.
+ *
+ * The data can also be written to and read from a binary stream (e.g., when cells
+ * are stored on disk, see #ibex::CellFileBuffer) by implementing #serialize() and
+ * #deserialize(). This is optional: data that cannot be serialized is kept in memory.
  */
 class Backtrackable {
 public:
@@ -45,6 +51,32 @@ public:
 	 */
 	virtual std::pair<Backtrackable*,Backtrackable*> down()=0;
 
+	/**
+	 * \brief Create data associated to k child cells.
+	 *
+	 * Used when a cell is split in more than two subcells (see #ibex::Cell::split()).
+	 * By default, #down() is called as many times as necessary.
+	 */
+	virtual std::vector<Backtrackable*> down(int k);
+
+	/**
+	 * \brief Write the data in a binary stream.
+	 *
+	 * Return false if the data cannot be serialized (default implementation).
+	 * In this case, nothing must be written.
+	 */
+	virtual bool serialize(std::ostream& os) const;
+
+	/**
+	 * \brief Read data written by #serialize().
+	 *
+	 * Return a new object built from *this and the content of the stream.
+	 * The object *this is an instance of the same class (e.g., a copy of the
+	 * data of the root cell), that gives the information not written by
+	 * #serialize() (for instance, a reference to a system).
+	 */
+	virtual Backtrackable* deserialize(std::istream& is) const;
+
 	/**
 	 * \brief Delete *this.
 	 */
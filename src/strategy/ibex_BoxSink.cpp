@@ -0,0 +1,134 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BoxSink.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_BoxSink.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// first bytes of a stream of boxes
+const char magic[]="IBEX-BOXES-1";
+
+/*
+ * True if the union of x and y is a box: x and y are equal
+ * except in one dimension where they are contiguous.
+ */
+bool adjacent(const IntervalVector& x, const IntervalVector& y) {
+	int diff=-1;
+	for (int i=0; i<x.size(); i++) {
+		if (x[i]==y[i]) continue;
+		if (diff!=-1) return false;
+		diff=i;
+	}
+	return diff==-1 || x[diff].ub()==y[diff].lb() || y[diff].ub()==x[diff].lb();
+}
+
+}
+
+void BoxSink::add(const IntervalVector& before, const IntervalVector& after) {
+	IntervalVector* result;
+	int nb=before.diff(after,result);
+	for (int i=0; i<nb; i++)
+		add(result[i]);
+	delete[] result;
+}
+
+void BoxSink::flush() {
+
+}
+
+BoxSink::~BoxSink() {
+
+}
+
+const unsigned int BoxStreamSink::default_window = 32;
+
+BoxStreamSink::BoxStreamSink(std::ostream& os, int n, unsigned int window) :
+		window(window), nb_received(0), nb_written(0), os(os), n(n) {
+	os.write(magic,sizeof(magic));
+	os.write((const char*) &n, sizeof(n));
+}
+
+void BoxStreamSink::add(const IntervalVector& box) {
+	assert(box.size()==n);
+
+	if (box.is_empty()) return;
+
+	nb_received++;
+
+	IntervalVector b(box);
+
+	// a merged box may be adjacent to another pending box
+	bool merged=true;
+	while (merged) {
+		merged=false;
+		for (list<IntervalVector>::iterator it=pending.begin(); it!=pending.end(); it++) {
+			if (adjacent(*it,b)) {
+				b |= *it;
+				pending.erase(it);
+				merged=true;
+				break;
+			}
+		}
+	}
+
+	pending.push_back(b);
+
+	while (pending.size()>window) {
+		write(pending.front());
+		pending.pop_front();
+	}
+}
+
+void BoxStreamSink::write(const IntervalVector& box) {
+	for (int i=0; i<n; i++) {
+		double lb=box[i].lb();
+		double ub=box[i].ub();
+		os.write((const char*) &lb, sizeof(double));
+		os.write((const char*) &ub, sizeof(double));
+	}
+	nb_written++;
+}
+
+void BoxStreamSink::flush() {
+	for (list<IntervalVector>::iterator it=pending.begin(); it!=pending.end(); it++)
+		write(*it);
+	pending.clear();
+	os.flush();
+}
+
+BoxStreamSink::~BoxStreamSink() {
+	flush();
+}
+
+BoxStreamReader::BoxStreamReader(std::istream& is) : n(0), is(is) {
+	char m[sizeof(magic)];
+	is.read(m,sizeof(magic));
+	if (!is || strncmp(m,magic,sizeof(magic))!=0) ibex_error("BoxStreamReader: not a stream of boxes");
+	is.read((char*) &n, sizeof(n));
+}
+
+bool BoxStreamReader::next(IntervalVector& box) {
+	box.resize(n);
+	for (int i=0; i<n; i++) {
+		double lb,ub;
+		is.read((char*) &lb, sizeof(double));
+		is.read((char*) &ub, sizeof(double));
+		if (!is) return false;
+		box[i]=Interval(lb,ub);
+	}
+	return true;
+}
+
+} // end namespace ibex
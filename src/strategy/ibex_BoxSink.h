@@ -0,0 +1,147 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BoxSink.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_BOX_SINK_H__
+#define __IBEX_BOX_SINK_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <iostream>
+#include <list>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Receiver of the boxes produced by a strategy.
+ *
+ * A sink receives each box as soon as it is produced: the
+ * solutions of a #ibex::Solver, or the boxes removed by the
+ * contractors of a #ibex::Paver. The strategy does not store
+ * these boxes, so that the memory used during the search does
+ * not grow with the output.
+ */
+class BoxSink {
+public:
+	/**
+	 * \brief Receive a box.
+	 */
+	virtual void add(const IntervalVector& box)=0;
+
+	/**
+	 * \brief Receive the trace of a contraction.
+	 *
+	 * The part of \a before that is not in \a after is removed.
+	 * By default, each box of this difference is passed to #add(const IntervalVector&).
+	 */
+	virtual void add(const IntervalVector& before, const IntervalVector& after);
+
+	/**
+	 * \brief Called at the end of the search, and by #ibex::Solver
+	 * before each checkpoint (see #ibex::Solver::checkpoint_file).
+	 *
+	 * By default, does nothing.
+	 */
+	virtual void flush();
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~BoxSink();
+};
+
+/** \ingroup strategy
+ *
+ * \brief Sink that writes boxes in a binary stream.
+ *
+ * Each box is written as 2n doubles (the bounds of the components).
+ * Adjacent boxes (equal in all the dimensions but one, where they
+ * are contiguous) are merged before being written. For this purpose,
+ * the last boxes received are kept in memory: a box is written when
+ * more than #window boxes are pending, or when #flush() is called.
+ *
+ * The stream can be read with #ibex::BoxStreamReader.
+ */
+class BoxStreamSink : public BoxSink {
+public:
+	/**
+	 * \brief Create a sink for boxes of size n.
+	 *
+	 * \param os     - the stream (kept by reference). Should be opened in binary mode.
+	 * \param window - the maximal number of pending boxes (0 means no merging).
+	 */
+	BoxStreamSink(std::ostream& os, int n, unsigned int window=default_window);
+
+	/**
+	 * \brief Receive a box.
+	 */
+	virtual void add(const IntervalVector& box);
+
+	using BoxSink::add;
+
+	/**
+	 * \brief Write the pending boxes.
+	 */
+	virtual void flush();
+
+	/**
+	 * \brief Delete *this (the pending boxes are written).
+	 */
+	virtual ~BoxStreamSink();
+
+	/** Maximal number of pending boxes. */
+	const unsigned int window;
+
+	/** Number of boxes received. */
+	unsigned long nb_received;
+
+	/** Number of boxes written. */
+	unsigned long nb_written;
+
+	/** Default window: 32 boxes. */
+	static const unsigned int default_window;
+
+protected:
+	void write(const IntervalVector& box);
+
+	std::ostream& os;
+	int n;
+	std::list<IntervalVector> pending;
+};
+
+/** \ingroup strategy
+ *
+ * \brief Read the boxes written by a #ibex::BoxStreamSink.
+ */
+class BoxStreamReader {
+public:
+	/**
+	 * \brief Read the header of the stream.
+	 *
+	 * \param is - the stream (kept by reference).
+	 */
+	BoxStreamReader(std::istream& is);
+
+	/**
+	 * \brief Read the next box.
+	 *
+	 * \return false if the stream is over.
+	 */
+	bool next(IntervalVector& box);
+
+	/** Size of the boxes. */
+	int n;
+
+protected:
+	std::istream& is;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_BOX_SINK_H__
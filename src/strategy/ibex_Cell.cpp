@@ -5,37 +5,327 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 10, 2012
-// Last Update : May 10, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Cell.h"
 #include <limits.h>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <utility>
 
 namespace ibex {
 
 namespace {
 
-int id_count=0;
+// atomic because cells may be created by concurrent
+// threads (see ParallelSolver)
+std::atomic<unsigned long> id_count(0);
+
+std::atomic<int> slot_count(0);
+
+/*
+ * Pool of cells.
+ *
+ * Each thread has its own list of free cells. A thread that has
+ * too many free cells (e.g., because it deletes the cells created
+ * by another thread) gives half of them back to a global list, where
+ * the threads that run out of free cells are served first.
+ * Memory is allocated by chunks and never given back to the system.
+ */
+struct FreeCell {
+	FreeCell* next;
+};
+
+const int POOL_CHUNK=256;  // number of cells allocated at once
+
+struct GlobalPool {
+	std::mutex m;
+	FreeCell* head;
+	GlobalPool() : head(NULL) { }
+};
+
+GlobalPool& global_pool() {
+	static GlobalPool* pool=new GlobalPool(); // never deleted (used until the very end)
+	return *pool;
+}
+
+struct LocalPool {
+	FreeCell* head;
+	int size;
+
+	LocalPool() : head(NULL), size(0) { }
+
+	// move n cells to the global list
+	void give_back(int n) {
+		if (n==0) return;
+		FreeCell* first=head;
+		FreeCell* last=head;
+		for (int i=1; i<n; i++) last=last->next;
+		head=last->next;
+		size-=n;
+		GlobalPool& g=global_pool();
+		std::lock_guard<std::mutex> lock(g.m);
+		last->next=g.head;
+		g.head=first;
+	}
+
+	// take up to POOL_CHUNK cells from the global list, or
+	// allocate a new chunk
+	void refill() {
+		GlobalPool& g=global_pool();
+		{
+			std::lock_guard<std::mutex> lock(g.m);
+			while (g.head && size<POOL_CHUNK) {
+				FreeCell* c=g.head;
+				g.head=c->next;
+				c->next=head;
+				head=c;
+				size++;
+			}
+		}
+		if (size>0) return;
+
+		char* chunk=(char*) ::operator new(POOL_CHUNK*sizeof(Cell));
+		for (int i=0; i<POOL_CHUNK; i++) {
+			FreeCell* c=(FreeCell*) (chunk+i*sizeof(Cell));
+			c->next=head;
+			head=c;
+		}
+		size=POOL_CHUNK;
+	}
+
+	~LocalPool() {
+		give_back(size);
+	}
+};
+
+thread_local LocalPool local_pool;
+
 }
 
- Cell::Cell(const IntervalVector& box) : box(box), id(id_count++) {
+ Cell::Cell(const IntervalVector& box) : box(box), id(id_count++), nb_data(0) {
 	 assert(id_count<ULONG_MAX);
 }
 
+Cell::Cell(IntervalVector&& box) : box(std::move(box)), id(id_count++), nb_data(0) {
+	assert(id_count<ULONG_MAX);
+}
+
+int Cell::new_slot() {
+	return slot_count++;
+}
+
+void* Cell::operator new(size_t size) {
+	if (size!=sizeof(Cell)) return ::operator new(size); // subclass
+
+	LocalPool& pool=local_pool;
+	if (!pool.head) pool.refill();
+	FreeCell* c=pool.head;
+	pool.head=c->next;
+	pool.size--;
+	return c;
+}
+
+void Cell::operator delete(void* p, size_t size) {
+	if (!p) return;
+	if (size!=sizeof(Cell)) { ::operator delete(p); return; }
+
+	LocalPool& pool=local_pool;
+	FreeCell* c=(FreeCell*) p;
+	c->next=pool.head;
+	pool.head=c;
+	pool.size++;
+	if (pool.size>=2*POOL_CHUNK) pool.give_back(POOL_CHUNK);
+}
+
+void Cell::set_data(int s, Backtrackable* d) {
+	for (; nb_data<=s; nb_data++) {
+		if (nb_data<NB_INLINE_DATA) inline_data[nb_data]=NULL;
+		else more_data.push_back(NULL);
+	}
+	if (s<NB_INLINE_DATA) inline_data[s]=d;
+	else more_data[s-NB_INLINE_DATA]=d;
+}
+
 std::pair<Cell*,Cell*> Cell::bisect(const IntervalVector& left, const IntervalVector& right) {
-	Cell* cleft = new Cell(left);
-	Cell* cright = new Cell(right);
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++) {
-		std::pair<Backtrackable*,Backtrackable*> child_data=it->second->down();
-		cleft->data.insert_new(it->first,child_data.first);
-		cright->data.insert_new(it->first,child_data.second);
+	return bisect(IntervalVector(left),IntervalVector(right));
+}
+
+std::pair<Cell*,Cell*> Cell::bisect(IntervalVector&& left, IntervalVector&& right) {
+	Cell* cleft = new Cell(std::move(left));
+	Cell* cright = new Cell(std::move(right));
+	if (nb_data>0) {
+		// allocate all the slots at once
+		cleft->set_data(nb_data-1,NULL);
+		cright->set_data(nb_data-1,NULL);
+	}
+	for (int s=0; s<nb_data; s++) {
+		Backtrackable* d=data(s);
+		if (!d) continue;
+		std::pair<Backtrackable*,Backtrackable*> child_data=d->down();
+		cleft->set_data(s,child_data.first);
+		cright->set_data(s,child_data.second);
 	}
 	return std::pair<Cell*,Cell*>(cleft,cright);
 }
 
+std::vector<Cell*> Cell::split(std::vector<IntervalVector>&& boxes) {
+	int k=boxes.size();
+	std::vector<Cell*> cells(k);
+	for (int j=0; j<k; j++) {
+		cells[j]=new Cell(std::move(boxes[j]));
+		// allocate all the slots at once
+		if (nb_data>0) cells[j]->set_data(nb_data-1,NULL);
+	}
+	for (int s=0; s<nb_data; s++) {
+		Backtrackable* d=data(s);
+		if (!d) continue;
+		std::vector<Backtrackable*> child_data=d->down(k);
+		for (int j=0; j<k; j++)
+			cells[j]->set_data(s,child_data[j]);
+	}
+	return cells;
+}
+
+namespace {
+
+// kind of data in the stream
+enum { NO_DATA, SERIALIZED_DATA, DETACHED_DATA };
+
+template<typename T>
+void write(std::ostream& os, const T& x) {
+	os.write((const char*) &x, sizeof(T));
+}
+
+template<typename T>
+void read(std::istream& is, T& x) {
+	is.read((char*) &x, sizeof(T));
+}
+
+}
+
+bool Cell::serialize(std::ostream& os, std::vector<Backtrackable*>& prototypes, bool detach) {
+	write(os,id);
+	int n=box.size();
+	write(os,n);
+	for (int i=0; i<n; i++)
+		write(os,box[i]);
+
+	add_prototypes(prototypes);
+
+	bool serialized=true;
+	write(os,nb_data);
+	for (int s=0; s<nb_data; s++) {
+		Backtrackable* d=data(s);
+		if (!d) {
+			write(os,(char) NO_DATA);
+			continue;
+		}
+
+		// the data is written in a buffer first because it may
+		// fail after writing some bytes
+		std::ostringstream buf;
+		if (d->serialize(buf)) {
+			std::string bytes=buf.str();
+			write(os,(char) SERIALIZED_DATA);
+			os.write(bytes.data(),bytes.size());
+		} else {
+			if (!detach) ibex_error("Cell::serialize: data cannot be serialized");
+			write(os,(char) DETACHED_DATA);
+			write(os,d);
+			set_data(s,NULL);
+			serialized=false;
+		}
+	}
+	return serialized;
+}
+
+void Cell::add_prototypes(std::vector<Backtrackable*>& prototypes) const {
+	for (int s=0; s<nb_data; s++) {
+		Backtrackable* d=data(s);
+		if (!d) continue;
+
+		if ((int) prototypes.size()<=s) prototypes.resize(s+1,NULL);
+		if (!prototypes[s]) {
+			std::pair<Backtrackable*,Backtrackable*> copies=d->down();
+			prototypes[s]=copies.first;
+			delete copies.second;
+		}
+	}
+}
+
+Cell* Cell::deserialize(std::istream& is, const std::vector<Backtrackable*>& prototypes, const std::vector<int>* slots) {
+	unsigned long id;
+	int n;
+	read(is,id);
+	read(is,n);
+	IntervalVector box(n);
+	for (int i=0; i<n; i++)
+		read(is,box[i]);
+
+	Cell* c=new Cell(box);
+	c->id=id;
+
+	int nb_data;
+	read(is,nb_data);
+	if (nb_data>0 && !slots) c->set_data(nb_data-1,NULL);
+
+	for (int s=0; s<nb_data; s++) {
+		char kind;
+		read(is,kind);
+		if (kind!=NO_DATA && slots && (*slots)[s]==-1)
+			ibex_error("Cell::deserialize: unknown data");
+		if (kind==SERIALIZED_DATA) {
+			c->set_data(slots? (*slots)[s] : s, prototypes[s]->deserialize(is));
+		} else if (kind==DETACHED_DATA) {
+			Backtrackable* d;
+			read(is,d);
+			c->set_data(slots? (*slots)[s] : s, d);
+		}
+	}
+	return c;
+}
+
+void Cell::serialize_classes(std::ostream& os, const std::vector<Backtrackable*>& prototypes) {
+	int nb=prototypes.size();
+	write(os,nb);
+	for (int s=0; s<nb; s++) {
+		std::string name=prototypes[s]? typeid(*prototypes[s]).name() : "";
+		int size=name.size();
+		write(os,size);
+		os.write(name.c_str(),size);
+	}
+}
+
+void Cell::deserialize_classes(std::istream& is, std::vector<Backtrackable*>& prototypes, std::vector<int>& slots) const {
+	int nb;
+	read(is,nb);
+	prototypes.assign(nb,NULL);
+	slots.assign(nb,-1);
+	for (int s=0; s<nb; s++) {
+		int size;
+		read(is,size);
+		std::string name(size,' ');
+		is.read(&name[0],size);
+		if (size==0) continue;
+		for (int s2=0; s2<nb_data && slots[s]==-1; s2++) {
+			Backtrackable* d=data(s2);
+			if (d && name==typeid(*d).name()) {
+				prototypes[s]=d;
+				slots[s]=s2;
+			}
+		}
+	}
+}
+
 Cell::~Cell() {
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++)
-		delete it->second;
+	for (int s=0; s<nb_data; s++)
+		delete data(s);
 }
 
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 10, 2012
-// Last Update : May 10, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_CELL_H__
@@ -13,8 +13,8 @@
 
 #include "ibex_IntervalVector.h"
 #include "ibex_Backtrackable.h"
-#include "ibex_SymbolMap.h"
-#include <typeinfo>
+#include <vector>
+#include <cstddef>
 
 namespace ibex {
 
@@ -36,6 +36,12 @@ namespace ibex {
  *
  * The amount of information contained in a cell can be arbitrarily augmented thanks to the
  * "data registration" technique (see #ibex::Contractor::require()).
+ *
+ * Each class of backtrackable data is given an integer slot the first time
+ * it is used (see #slot()), so that retrieving data is an array access.
+ *
+ * Cells are allocated in a pool: the memory of deleted cells is reused
+ * for new cells (by the same thread, if possible).
  */
 class Cell {
 public:
@@ -47,6 +53,13 @@ public:
 	 */
 	Cell(const IntervalVector& box);
 
+	/**
+	 * \brief Create the root cell.
+	 *
+	 * \param box - Box (moved: the storage of \a box is taken, not copied).
+	 */
+	Cell(IntervalVector&& box);
+
 	/**
 	 * \brief Bisect this cell.
 	 *
@@ -61,6 +74,24 @@ public:
 	 */
 	std::pair<Cell*,Cell*> bisect(const IntervalVector& left, const IntervalVector& right);
 
+	/**
+	 * \brief Bisect this cell.
+	 *
+	 * Same as #bisect(const IntervalVector&, const IntervalVector&) except that
+	 * the storage of \a left and \a right is moved to the subcells, so that
+	 * bisecting a cell does not copy the boxes produced by the bisector.
+	 */
+	std::pair<Cell*,Cell*> bisect(IntervalVector&& left, IntervalVector&& right);
+
+	/**
+	 * \brief Split this cell in k subcells.
+	 *
+	 * The box of the ith subcell is boxes[i] (the boxes are moved).
+	 * The subcells inherit from the data of this cell via
+	 * \link #ibex::Backtrackable::down(int) down \endlink.
+	 */
+	std::vector<Cell*> split(std::vector<IntervalVector>&& boxes);
+
 	/**
 	 * \brief Delete *this.
 	 */
@@ -74,45 +105,126 @@ public:
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class.
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	T& get() {
-		return (T&) *data[typeid(T).name()];
+		return (T&) *data(slot<T>());
 	}
 
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class.
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	const T& get() const {
-		return (T&) *data[typeid(T).name()];
+		return (const T&) *data(slot<T>());
+	}
+
+	/**
+	 * \brief True if this cell contains backtrackable data of class \a T.
+	 */
+	template<typename T>
+	bool has() const {
+		int s=slot<T>();
+		return s<nb_data && data(s)!=NULL;
 	}
 
 	/**
 	 * \brief Add backtrackable data into this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class.
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	void add() {
-		const char* id=typeid(T).name();
-		if (!data.used(id)) data.insert_new(id,new T());
+		int s=slot<T>();
+		if (!has<T>()) set_data(s,new T());
 	}
 
 	/**
-	 * \brief The box
+	 * \brief The slot of class \a T.
+	 *
+	 * The slot is allocated the first time this function
+	 * is called for \a T (by any cell).
 	 */
-	IntervalVector box;
+	template<typename T>
+	static int slot() {
+		static const int s=new_slot();
+		return s;
+	}
+
 	/**
-	 * \brief Other data.
+	 * \brief Write the cell (box and data) in a binary stream.
+	 *
+	 * The data that cannot be serialized (see #ibex::Backtrackable::serialize())
+	 * is detached from the cell and only its address is written: the cell must
+	 * be read back by the same process, once.
+	 *
+	 * \param prototypes - prototypes[s] is the prototype of the data in slot s
+	 *                     for #deserialize(). If it is missing, a copy of the
+	 *                     data of this cell is added.
+	 * \param detach     - if false, all the data must be serializable
+	 *                     (the cell can then be read by another process).
+	 * \return            false if data has been detached.
 	 */
-	SymbolMap<Backtrackable*> data;
+	bool serialize(std::ostream& os, std::vector<Backtrackable*>& prototypes, bool detach=true);
+
+	/**
+	 * \brief Add the prototypes of the data of this cell.
+	 *
+	 * For each data in slot s, a copy of the data is put in prototypes[s]
+	 * if it is missing (as in #serialize()). Allows to write the classes
+	 * (see #serialize_classes()) before the cells.
+	 */
+	void add_prototypes(std::vector<Backtrackable*>& prototypes) const;
+
+	/**
+	 * \brief Read a cell written by #serialize().
+	 *
+	 * \param prototypes - the prototypes of the data
+	 *                     (see #ibex::Backtrackable::deserialize()).
+	 * \param slots      - if not NULL, (*slots)[s] is the slot where the data
+	 *                     written in slot s is put (see #deserialize_classes()).
+	 */
+	static Cell* deserialize(std::istream& is, const std::vector<Backtrackable*>& prototypes, const std::vector<int>* slots=NULL);
+
+	/**
+	 * \brief Write the classes of the prototypes in a binary stream.
+	 *
+	 * Slots are allocated at run time, in the order the classes are first
+	 * used. Writing the classes allows a different process (where the slots
+	 * may be different) to read the cells, see #deserialize_classes().
+	 */
+	static void serialize_classes(std::ostream& os, const std::vector<Backtrackable*>& prototypes);
+
+	/**
+	 * \brief Read the classes written by #serialize_classes().
+	 *
+	 * The data of this cell are used as prototypes: for each slot s in the stream,
+	 * prototypes[s] is set to the data of this cell of the same class and slots[s]
+	 * to the slot of this data. If this cell has no such data, slots[s] is set to -1:
+	 * it is then an error to read a cell with data in slot s.
+	 */
+	void deserialize_classes(std::istream& is, std::vector<Backtrackable*>& prototypes, std::vector<int>& slots) const;
+
+	/**
+	 * \brief Allocate a cell in the pool.
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Give the memory of a cell back to the pool.
+	 */
+	static void operator delete(void* p, size_t size);
+
+	/**
+	 * \brief The box
+	 */
+	IntervalVector box;
 
 	/**
 	 * Cell unique identifier
@@ -122,8 +234,28 @@ public:
 private:
 	/* A constant to be used when no variable has been split yet (root cell). */
 	//static const int ROOT_CELL;
+
+	/* Number of slots stored in the cell itself (the other ones are in "more_data"). */
+	static const int NB_INLINE_DATA=8;
+
+	static int new_slot();
+
+	Backtrackable* data(int s) const;
+
+	void set_data(int s, Backtrackable* d);
+
+	Backtrackable* inline_data[NB_INLINE_DATA];
+	std::vector<Backtrackable*> more_data;
+	int nb_data; // number of slots used (1+the highest slot with data)
 };
 
+/*================================== inline implementations ========================================*/
+
+inline Backtrackable* Cell::data(int s) const {
+	assert(s<nb_data);
+	return s<NB_INLINE_DATA ? inline_data[s] : more_data[s-NB_INLINE_DATA];
+}
+
 std::ostream& operator<<(std::ostream& os, const Cell& c);
 
 } // end namespace ibex
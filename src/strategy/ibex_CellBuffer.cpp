@@ -5,11 +5,13 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 15, 2012
-// Last Update : May 15, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_CellBuffer.h"
 
+#include <vector>
+
 using namespace std;
 
 namespace ibex {
@@ -18,6 +20,61 @@ CellBuffer::CellBuffer() : capacity(-1), screen(1) { }
 
 CellBuffer::~CellBuffer() { }
 
+bool CellBuffer::lifo() const {
+	return false;
+}
+
+void CellBuffer::save(std::ostream& os) {
+	vector<Cell*> cells;
+	while (!empty())
+		cells.push_back(pop());
+
+	// the classes of the data are written before the cells
+	vector<Backtrackable*> prototypes;
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		(*it)->add_prototypes(prototypes);
+
+	unsigned int nb=cells.size();
+	os.write((const char*) &nb, sizeof(nb));
+	Cell::serialize_classes(os,prototypes);
+
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		(*it)->serialize(os,prototypes,false);
+
+	// push back the cells (the first popped must be on the top)
+	if (lifo())
+		for (vector<Cell*>::reverse_iterator it=cells.rbegin(); it!=cells.rend(); it++)
+			push(*it);
+	else
+		for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+			push(*it);
+
+	for (vector<Backtrackable*>::iterator it=prototypes.begin(); it!=prototypes.end(); it++)
+		delete *it;
+}
+
+void CellBuffer::load(std::istream& is, const Cell& root) {
+	unsigned int nb;
+	is.read((char*) &nb, sizeof(nb));
+
+	vector<Backtrackable*> prototypes;
+	vector<int> slots;
+	root.deserialize_classes(is,prototypes,slots);
+
+	// the cells of a stack are pushed in the reverse order
+	vector<Cell*> cells;
+	for (unsigned int i=0; i<nb; i++) {
+		Cell* c=Cell::deserialize(is,prototypes,&slots);
+		if (lifo()) cells.push_back(c);
+		else push(c);
+	}
+
+	if (!is) ibex_error("CellBuffer::load: cannot read cells");
+
+	for (vector<Cell*>::reverse_iterator it=cells.rbegin(); it!=cells.rend(); it++)
+		push(*it);
+}
+
 std::ostream& CellBuffer::print(std::ostream& os) const{
 	os << "==============================================================================\n";
 	os << "[" << screen++ << "] buffer size=" << size() << " . Cell on the top :\n\n ";
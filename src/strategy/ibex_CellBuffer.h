@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_CELL_BUFFER_H__
@@ -13,6 +13,8 @@
 
 #include "ibex_Cell.h"
 
+#include <iostream>
+
 namespace ibex {
 
 /** \ingroup strategy
@@ -73,6 +75,42 @@ class CellBuffer {
 	/** Return the next box (but does not pop it).*/
 	virtual Cell* top() const=0;
 
+	/**
+	 * \brief True if the last cell pushed is popped first.
+	 *
+	 * Only used to restore the order of the cells by #load()
+	 * (for a buffer ordered by a cost, it does not matter).
+	 * By default, false (first-in first-out).
+	 */
+	virtual bool lifo() const;
+
+	/**
+	 * \brief Write the cells in a binary stream.
+	 *
+	 * The cells are written one by one in the stream and the buffer is
+	 * unchanged. The data of the cells must be serializable (see
+	 * #ibex::Backtrackable::serialize()) so that the cells can be
+	 * read by another process.
+	 *
+	 * By default, the cells are popped and pushed back. A buffer that
+	 * does not keep its cells in memory should write them directly.
+	 */
+	virtual void save(std::ostream& os);
+
+	/**
+	 * \brief Push the cells written by #save().
+	 *
+	 * The cells are popped in the same order as in the saved buffer
+	 * (if both buffers are of the same kind). A buffer that overrides
+	 * #save() may use its own format: the cells must then be read by a
+	 * buffer of the same class.
+	 *
+	 * \param root - a cell with the same data as the saved cells (e.g., a root cell
+	 *               built as when the search started), for reading the data
+	 *               (see #ibex::Backtrackable::deserialize()). It is not pushed.
+	 */
+	virtual void load(std::istream& is, const Cell& root);
+
 	/** Count the number of cells pushed since
 	 * the object is created. */
 	//unsigned int nb_cells;
@@ -0,0 +1,299 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDeltaStack.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_CellDeltaStack.h"
+
+#include <map>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+template<typename T>
+void write(std::ostream& os, const T& x) {
+	os.write((const char*) &x, sizeof(T));
+}
+
+template<typename T>
+void read(std::istream& is, T& x) {
+	is.read((char*) &x, sizeof(T));
+}
+
+}
+
+CellDeltaStack::CellDeltaStack() : base_node(NULL), base_box(1), nb_comp(0) {
+
+}
+
+CellDeltaStack::~CellDeltaStack() {
+	flush();
+}
+
+void CellDeltaStack::flush() {
+	while (!cstack.empty()) {
+		delete cstack.back().cell;
+		release(cstack.back().node);
+		cstack.pop_back();
+	}
+	set_base(NULL);
+}
+
+unsigned int CellDeltaStack::size() const {
+	return cstack.size();
+}
+
+bool CellDeltaStack::empty() const {
+	return cstack.empty();
+}
+
+long CellDeltaStack::nb_components() const {
+	return nb_comp;
+}
+
+CellDeltaStack::Node* CellDeltaStack::diff(const IntervalVector& box) const {
+	Node* node=new Node();
+	node->n=box.size();
+	node->refs=0;
+
+	Change c;
+	if (base_node && base_box.size()==box.size()) {
+		for (c.i=0; c.i<box.size(); c.i++)
+			if (!(box[c.i]==base_box[c.i])) {
+				c.x=box[c.i];
+				c.old=base_box[c.i];
+				node->delta.push_back(c);
+			}
+
+		if (node->delta.empty()) {
+			delete node;
+			return NULL;
+		}
+		node->parent=base_node;
+		node->depth=base_node->depth+1;
+		base_node->refs++;
+	} else {
+		node->parent=NULL;
+		node->depth=0;
+		for (c.i=0; c.i<box.size(); c.i++) {
+			c.x=box[c.i];
+			node->delta.push_back(c);
+		}
+	}
+
+	nb_comp+=node->delta.size();
+	return node;
+}
+
+void CellDeltaStack::set_base(Node* node) const {
+	if (node) node->refs++;
+	if (base_node) release(base_node);
+	base_node=node;
+}
+
+void CellDeltaStack::release(Node* node) const {
+	while (node && --node->refs==0) {
+		Node* parent=node->parent;
+		nb_comp-=node->delta.size();
+		delete node;
+		node=parent;
+	}
+}
+
+void CellDeltaStack::push(Cell* cell) {
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+
+	Entry e;
+	e.cell=cell;
+	e.node=diff(cell->box);
+	if (!e.node) { // same box as the base
+		e.node=base_node;
+	}
+	e.node->refs++;
+	e.full=false;
+
+	cell->box.resize(1);
+	cstack.push_back(e);
+}
+
+void CellDeltaStack::rebuild(Entry& e) const {
+	Node* node=e.node;
+	IntervalVector& box=e.cell->box;
+
+	// find the common ancestor of the base and the node
+	Node* a=base_node;
+	Node* b=node;
+	path.clear();
+
+	if (base_node && base_box.size()==node->n) {
+		box=base_box;
+		while (a!=b) {
+			if (!a || (b && b->depth>a->depth)) {
+				path.push_back(b);
+				b=b->parent;
+			} else {
+				// undo the changes of a
+				for (vector<Change>::const_iterator it=a->delta.begin(); it!=a->delta.end(); it++)
+					box[it->i]=it->old;
+				a=a->parent;
+			}
+		}
+	} else {
+		for (; b; b=b->parent)
+			path.push_back(b);
+		box.resize(path.back()->delta.size()); // root node: all the components
+	}
+
+	for (vector<Node*>::reverse_iterator n=path.rbegin(); n!=path.rend(); n++)
+		for (vector<Change>::const_iterator it=(*n)->delta.begin(); it!=(*n)->delta.end(); it++)
+			box[it->i]=it->x;
+
+	e.full=true;
+	base_box=box;
+	set_base(node);
+}
+
+Cell* CellDeltaStack::pop() {
+	Entry& e=cstack.back();
+	if (!e.full) rebuild(e);
+
+	Cell* c=e.cell;
+
+	// The box may have been contracted since top(): the
+	// base becomes the current box (for the children).
+	if (!c->box.is_empty()) {
+		Node* node=diff(c->box);
+		if (node) {
+			set_base(node);
+			base_box=c->box;
+		}
+	}
+
+	release(e.node);
+	cstack.pop_back();
+	return c;
+}
+
+Cell* CellDeltaStack::top() const {
+	const Entry& e=cstack.back();
+	if (!e.full) rebuild((Entry&) e);
+	return e.cell;
+}
+
+bool CellDeltaStack::lifo() const {
+	return true;
+}
+
+namespace {
+
+// order of the nodes such that a parent comes before its children
+template<class Node>
+struct DepthOrder {
+	bool operator()(const Node* n1, const Node* n2) const { return n1->depth<n2->depth; }
+};
+
+}
+
+void CellDeltaStack::save(std::ostream& os) {
+	// the nodes of the cells and their ancestors
+	vector<Node*> nodes;
+	map<Node*,int> index;
+	for (vector<Entry>::iterator it=cstack.begin(); it!=cstack.end(); it++)
+		for (Node* node=it->node; node && index.find(node)==index.end(); node=node->parent) {
+			index[node]=-1;
+			nodes.push_back(node);
+		}
+	stable_sort(nodes.begin(),nodes.end(),DepthOrder<Node>());
+
+	int nb_nodes=nodes.size();
+	write(os,nb_nodes);
+	for (int k=0; k<nb_nodes; k++) {
+		Node* node=nodes[k];
+		index[node]=k;
+		int parent=node->parent? index[node->parent] : -1;
+		int nb_changes=node->delta.size();
+		write(os,parent);
+		write(os,node->n);
+		write(os,nb_changes);
+		for (vector<Change>::const_iterator it=node->delta.begin(); it!=node->delta.end(); it++) {
+			write(os,it->i);
+			write(os,it->x);
+			write(os,it->old);
+		}
+	}
+
+	vector<Backtrackable*> prototypes;
+	for (vector<Entry>::iterator it=cstack.begin(); it!=cstack.end(); it++)
+		it->cell->add_prototypes(prototypes);
+
+	unsigned int nb=cstack.size();
+	write(os,nb);
+	Cell::serialize_classes(os,prototypes);
+
+	// from the bottom to the top of the stack
+	for (vector<Entry>::iterator it=cstack.begin(); it!=cstack.end(); it++) {
+		write(os,index[it->node]);
+		write(os,it->full);
+		it->cell->serialize(os,prototypes,false);
+	}
+
+	for (vector<Backtrackable*>::iterator it=prototypes.begin(); it!=prototypes.end(); it++)
+		delete *it;
+}
+
+void CellDeltaStack::load(std::istream& is, const Cell& root) {
+	int nb_nodes;
+	read(is,nb_nodes);
+	vector<Node*> nodes(nb_nodes);
+	for (int k=0; k<nb_nodes; k++) {
+		int parent;
+		int nb_changes;
+		Node* node=new Node();
+		read(is,parent);
+		read(is,node->n);
+		read(is,nb_changes);
+		node->delta.resize(nb_changes);
+		for (vector<Change>::iterator it=node->delta.begin(); it!=node->delta.end(); it++) {
+			read(is,it->i);
+			read(is,it->x);
+			read(is,it->old);
+		}
+		node->parent=parent==-1? NULL : nodes[parent];
+		node->depth=node->parent? node->parent->depth+1 : 0;
+		node->refs=0;
+		if (node->parent) node->parent->refs++;
+		nb_comp+=node->delta.size();
+		nodes[k]=node;
+	}
+
+	unsigned int nb;
+	read(is,nb);
+
+	vector<Backtrackable*> prototypes;
+	vector<int> slots;
+	root.deserialize_classes(is,prototypes,slots);
+
+	for (unsigned int i=0; i<nb; i++) {
+		if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+		Entry e;
+		int node;
+		read(is,node);
+		read(is,e.full);
+		e.cell=Cell::deserialize(is,prototypes,&slots);
+		e.node=nodes[node];
+		e.node->refs++;
+		cstack.push_back(e);
+	}
+
+	if (!is) ibex_error("CellDeltaStack::load: cannot read cells");
+}
+
+} // end namespace ibex
@@ -0,0 +1,144 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDeltaStack.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_DELTA_STACK_H__
+#define __IBEX_CELL_DELTA_STACK_H__
+
+#include "ibex_CellBuffer.h"
+#include <vector>
+#include <utility>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Cell Stack with delta-encoded boxes.
+ *
+ * For depth-first search, like #CellStack, but with a memory footprint
+ * that does not grow with the number of variables.
+ *
+ * The boxes of the pending cells are stored as a tree of "deltas": each
+ * box is represented by the components that differ from the box of
+ * an ancestor (a box that was previously popped). When a cell is pushed,
+ * its box is compared with the box of the last cell popped (the
+ * parent cell, in a depth-first search), and only the components that
+ * have changed are kept. The box of the cell itself is then
+ * shrunk to one component.
+ *
+ * The box is rebuilt when the cell reaches the top of the stack
+ * (see #top() and #pop()), from the box of the last cell popped:
+ * the changes are undone up to the common ancestor and then applied
+ * down to the cell (each change also records the value in the parent
+ * box). Since the box of the last cell popped is read at the time
+ * of #pop(), the contractions made between #top() and #pop() are
+ * also shared by the children of this cell.
+ *
+ * With a solver that pops the current cell before pushing its children
+ * (see #ibex::Solver), the delta of a child is only the bisected
+ * variable, and the memory used by a pending cell is O(k), where k is
+ * the number of components changed by the contraction of its ancestors
+ * still in the tree, instead of O(n).
+ */
+class CellDeltaStack : public CellBuffer {
+ public:
+  /** Create an empty stack. */
+  CellDeltaStack();
+
+  /** Delete *this (and the remaining cells). */
+  ~CellDeltaStack();
+
+  /** Flush the buffer.
+   * All the remaining cells will be *deleted* */
+  void flush();
+
+  /** Return the size of the buffer. */
+  unsigned int size() const;
+
+  /** Return true if the buffer is empty. */
+  bool empty() const;
+
+  /** push a new cell on the stack. */
+  void push(Cell* cell);
+
+  /** Pop a cell from the stack and return it.*/
+  Cell* pop();
+
+  /** Return the next box (but does not pop it).*/
+  Cell* top() const;
+
+  /** Return true (last-in first-out). */
+  bool lifo() const;
+
+  /** Number of components stored in the deltas (for statistics). */
+  long nb_components() const;
+
+  /**
+   * \brief Write the cells in a binary stream.
+   *
+   * The deltas are written, not the boxes: the cells are written
+   * with the box they have in the stack.
+   */
+  void save(std::ostream& os);
+
+  /**
+   * \brief Push the cells written by #save().
+   */
+  void load(std::istream& is, const Cell& root);
+
+ private:
+  /* A component that differs from the parent node (with the value in the parent node). */
+  struct Change {
+    int i;
+    Interval x;
+    Interval old;
+  };
+
+  /* A box, given by its differences with the box of the parent node. */
+  struct Node {
+    Node* parent;
+    int n;     // size of the box
+    int depth;
+    int refs;
+    std::vector<Change> delta;
+  };
+
+  struct Entry {
+    Cell* cell;
+    Node* node;
+    bool full; // true if the box of the cell has been rebuilt
+  };
+
+  /* Create a node for "box", as a child of base_node (a root node if there is no base).
+   * Return NULL if the box is equal to the base. */
+  Node* diff(const IntervalVector& box) const;
+
+  /* Rebuild the box of the cell of the entry, and set it as the base. */
+  void rebuild(Entry& e) const;
+
+  /* Set the base node (the reference of the next deltas). */
+  void set_base(Node* node) const;
+
+  /* Decrement the reference count of a node (and delete it, if possible). */
+  void release(Node* node) const;
+
+  /* Stack of cells */
+  std::vector<Entry> cstack;
+
+  /* Nodes to be applied to the box (in #rebuild) */
+  mutable std::vector<Node*> path;
+
+  /* The base for the next deltas and its box. */
+  mutable Node* base_node;
+  mutable IntervalVector base_box;
+
+  mutable long nb_comp;
+};
+
+} // end namespace ibex
+#endif // __IBEX_CELL_DELTA_STACK_H__
@@ -0,0 +1,221 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellFileBuffer.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_CellFileBuffer.h"
+
+#include <sstream>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+const unsigned int CellFileBuffer::default_mem_capacity = 100000;
+
+bool CellFileBuffer::EltOrder::operator()(const Elt& e1, const Elt& e2) const {
+	// "greater" (the top of a std heap is the maximum)
+	return e1.cost>e2.cost || (e1.cost==e2.cost && e1.seq>e2.seq);
+}
+
+CellFileBuffer::CellFileBuffer(unsigned int mem_capacity, CostFunc<Cell>* costf) :
+		mem_capacity(mem_capacity), costf(costf), on_disk(0), seq(0) {
+	if (mem_capacity<2) ibex_error("CellFileBuffer: memory capacity must be at least 2");
+}
+
+CellFileBuffer::~CellFileBuffer() {
+	flush();
+	for (vector<Backtrackable*>::iterator it=prototypes.begin(); it!=prototypes.end(); it++)
+		delete *it;
+}
+
+namespace {
+
+struct DeleteCell {
+	void operator()(double, unsigned long, Cell* c) const { delete c; }
+};
+
+}
+
+void CellFileBuffer::flush() {
+	for (vector<Elt>::iterator it=heap.begin(); it!=heap.end(); it++)
+		delete it->cell;
+	heap.clear();
+
+	// the cells are read back to delete the data kept in memory
+	for (vector<Batch>::iterator it=batches.begin(); it!=batches.end(); it++)
+		read(*it, DeleteCell());
+	batches.clear();
+
+	on_disk=0;
+	file.clear();
+}
+
+unsigned int CellFileBuffer::size() const {
+	return heap.size()+on_disk;
+}
+
+bool CellFileBuffer::empty() const {
+	return size()==0;
+}
+
+unsigned int CellFileBuffer::nb_cells_on_disk() const {
+	return on_disk;
+}
+
+void CellFileBuffer::push(Cell* cell) {
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+
+	Elt e;
+	e.seq=seq++;
+	e.cost=costf? costf->cost(*cell) : (double) e.seq;
+	e.cell=cell;
+	insert(e);
+}
+
+void CellFileBuffer::insert(const Elt& e) {
+	heap.push_back(e);
+	push_heap(heap.begin(),heap.end(),EltOrder());
+
+	if (heap.size()>mem_capacity) spill();
+}
+
+Cell* CellFileBuffer::pop() {
+	load_next();
+	pop_heap(heap.begin(),heap.end(),EltOrder());
+	Cell* c=heap.back().cell;
+	heap.pop_back();
+	return c;
+}
+
+Cell* CellFileBuffer::top() const {
+	load_next();
+	return heap.front().cell;
+}
+
+void CellFileBuffer::spill() {
+	// the coldest half, in increasing order
+	sort_heap(heap.begin(),heap.end(),EltOrder()); // decreasing order
+	int nb=heap.size()/2;
+	reverse(heap.begin(),heap.begin()+nb);
+
+	ostringstream os;
+	bool serialized=true;
+	for (int i=0; i<nb; i++) {
+		os.write((const char*) &heap[i].cost, sizeof(double));
+		os.write((const char*) &heap[i].seq, sizeof(unsigned long));
+		serialized &= heap[i].cell->serialize(os,prototypes);
+		delete heap[i].cell;
+	}
+
+	Batch b;
+	b.block=file.write(os.str());
+	b.nb_cells=nb;
+	b.detached=!serialized;
+	b.first=heap[0];
+	batches.push_back(b);
+	on_disk+=nb;
+
+	heap.erase(heap.begin(),heap.begin()+nb);
+	make_heap(heap.begin(),heap.end(),EltOrder());
+}
+
+template<typename F>
+void CellFileBuffer::read(const Batch& b, F f) const {
+	string bytes;
+	file.read(b.block,bytes);
+
+	istringstream is(bytes);
+	for (unsigned int i=0; i<b.nb_cells; i++) {
+		double cost;
+		unsigned long seq;
+		is.read((char*) &cost, sizeof(double));
+		is.read((char*) &seq, sizeof(unsigned long));
+		f(cost,seq,Cell::deserialize(is,prototypes));
+	}
+}
+
+void CellFileBuffer::load(int i) const {
+	Batch b=batches[i];
+	batches.erase(batches.begin()+i);
+
+	struct Push {
+		Push(vector<Elt>& heap) : heap(heap) { }
+		void operator()(double cost, unsigned long seq, Cell* c) const {
+			Elt e;
+			e.cost=cost;
+			e.seq=seq;
+			e.cell=c;
+			heap.push_back(e);
+			push_heap(heap.begin(),heap.end(),EltOrder());
+		}
+		vector<Elt>& heap;
+	};
+
+	read(b, Push(heap));
+	on_disk-=b.nb_cells;
+	file.erase(b.block);
+}
+
+void CellFileBuffer::load_next() const {
+	if (batches.empty()) return;
+
+	// the batch with the smallest first cell
+	int best=0;
+	for (unsigned int i=1; i<batches.size(); i++)
+		if (EltOrder()(batches[best].first,batches[i].first)) best=i;
+
+	if (heap.empty() || EltOrder()(heap.front(),batches[best].first)) {
+		load(best);
+		// note: the memory capacity may be exceeded until the next push
+	}
+}
+
+void CellFileBuffer::save(std::ostream& os) {
+	for (vector<Batch>::iterator it=batches.begin(); it!=batches.end(); it++)
+		if (it->detached) ibex_error("CellFileBuffer::save: data cannot be serialized");
+
+	for (vector<Elt>::iterator it=heap.begin(); it!=heap.end(); it++)
+		it->cell->add_prototypes(prototypes);
+
+	unsigned int nb=size();
+	os.write((const char*) &nb, sizeof(nb));
+	Cell::serialize_classes(os,prototypes);
+
+	// same format as in the file
+	for (vector<Elt>::iterator it=heap.begin(); it!=heap.end(); it++) {
+		os.write((const char*) &it->cost, sizeof(double));
+		os.write((const char*) &it->seq, sizeof(unsigned long));
+		it->cell->serialize(os,prototypes,false);
+	}
+
+	for (vector<Batch>::iterator it=batches.begin(); it!=batches.end(); it++)
+		file.copy(it->block,os);
+}
+
+void CellFileBuffer::load(std::istream& is, const Cell& root) {
+	unsigned int nb;
+	is.read((char*) &nb, sizeof(nb));
+
+	vector<Backtrackable*> root_prototypes;
+	vector<int> slots;
+	root.deserialize_classes(is,root_prototypes,slots);
+
+	for (unsigned int i=0; i<nb; i++) {
+		Elt e;
+		is.read((char*) &e.cost, sizeof(double));
+		is.read((char*) &e.seq, sizeof(unsigned long));
+		e.cell=Cell::deserialize(is,root_prototypes,&slots);
+		if (e.seq>=seq) seq=e.seq+1;
+		insert(e);
+	}
+
+	if (!is) ibex_error("CellFileBuffer::load: cannot read cells");
+}
+
+} // end namespace ibex
@@ -0,0 +1,161 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellFileBuffer.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_FILE_BUFFER_H__
+#define __IBEX_CELL_FILE_BUFFER_H__
+
+#include "ibex_CellBuffer.h"
+#include "ibex_Heap.h"
+#include "ibex_SpillFile.h"
+
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Cell buffer stored on disk.
+ *
+ * A buffer whose size is not bounded by the memory. It keeps at most
+ * #mem_capacity cells in memory. Beyond this number, the "coldest" half of
+ * the cells in memory (the ones that would be popped last) is written to a
+ * temporary file in one batch. A batch is read back in memory as soon as it
+ * contains the next cell to be popped.
+ *
+ * The cells are popped in the order of increasing cost (for a given cost
+ * function), or in the order they have been pushed (breadth-first search)
+ * if there is no cost function. Cells with the same cost are popped
+ * in the order they have been pushed.
+ *
+ * The box and the backtrackable data of the cells are written to the file
+ * (see #ibex::Backtrackable::serialize()). Backtrackable data that cannot
+ * be serialized is kept in memory. The file is only valid for the current
+ * process and is deleted with the buffer. The space of the batches read
+ * back is reused (see #ibex::SpillFile).
+ *
+ * \note The cost of a cell is calculated once, when the cell is pushed.
+ */
+class CellFileBuffer : public CellBuffer {
+ public:
+  /**
+   * \brief Create the buffer.
+   *
+   * \param mem_capacity - the maximal number of cells in memory (at least 2).
+   * \param costf        - the cost function (NULL means breadth-first search).
+   *                       The cost function is not deleted by the buffer.
+   */
+  CellFileBuffer(unsigned int mem_capacity=default_mem_capacity, CostFunc<Cell>* costf=NULL);
+
+  /** Delete *this (and the remaining cells). */
+  ~CellFileBuffer();
+
+  /** Flush the buffer.
+   * All the remaining cells will be *deleted* */
+  void flush();
+
+  /** Return the size of the buffer. */
+  unsigned int size() const;
+
+  /** Return true if the buffer is empty. */
+  bool empty() const;
+
+  /** Push a new cell in the buffer. */
+  void push(Cell* cell);
+
+  /** Pop a cell from the buffer and return it.*/
+  Cell* pop();
+
+  /** Return the next cell (but does not pop it).*/
+  Cell* top() const;
+
+  /** Return the number of cells on disk. */
+  unsigned int nb_cells_on_disk() const;
+
+  /**
+   * \brief Write the cells in a binary stream.
+   *
+   * The cells on disk are copied from the temporary file, without
+   * being read back. The cells are written with their cost.
+   */
+  void save(std::ostream& os);
+
+  /**
+   * \brief Push the cells written by #save().
+   *
+   * The cells keep the cost and the rank they had in the saved buffer
+   * (the cost function is not called). They are written to the temporary
+   * file as they are read, if necessary.
+   */
+  void load(std::istream& is, const Cell& root);
+
+  /** The maximal number of cells in memory. */
+  const unsigned int mem_capacity;
+
+  /** The cost function (NULL means breadth-first search). */
+  CostFunc<Cell>* const costf;
+
+  /** Default maximal number of cells in memory: 100000. */
+  static const unsigned int default_mem_capacity;
+
+ private:
+  /* A cell in memory, with its rank in the buffer. */
+  struct Elt {
+    double cost;
+    unsigned long seq; // order of the push
+    Cell* cell;
+  };
+
+  /* Comparison of Elt, for a min-heap. */
+  struct EltOrder {
+    bool operator()(const Elt& e1, const Elt& e2) const;
+  };
+
+  /* A batch of cells in the file. */
+  struct Batch {
+    int block;         // block of the file
+    unsigned int nb_cells;
+    bool detached;     // true if data of the cells is kept in memory
+    Elt first;         // the cost and rank of the first cell (the cell is not set)
+  };
+
+  /* Push a cell with its cost and rank. */
+  void insert(const Elt& e);
+
+  /* Write the coldest half of the cells in memory. */
+  void spill();
+
+  /* Read the batch and remove it from the list. */
+  void load(int b) const;
+
+  /* Read the batch that contains the next cell, if necessary. */
+  void load_next() const;
+
+  /* Read the cells of the batch and give them to f */
+  template<typename F>
+  void read(const Batch& b, F f) const;
+
+  /* Cells in memory (a heap) */
+  mutable std::vector<Elt> heap;
+
+  /* Cells on disk */
+  mutable std::vector<Batch> batches;
+
+  mutable unsigned int on_disk;
+
+  /* The temporary file */
+  mutable SpillFile file;
+
+  /* Prototypes of the backtrackable data (see Cell::deserialize) */
+  mutable std::vector<Backtrackable*> prototypes;
+
+  unsigned long seq;
+};
+
+} // end namespace ibex
+#endif // __IBEX_CELL_FILE_BUFFER_H__
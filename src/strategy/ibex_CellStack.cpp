@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_CellStack.h"
@@ -42,4 +42,8 @@ Cell* CellStack::top() const {
 	return cstack.top();
 }
 
+bool CellStack::lifo() const {
+	return true;
+}
+
 } // end namespace ibex
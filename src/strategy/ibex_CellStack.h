@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_CELL_STACK_H__
@@ -43,6 +43,9 @@ class CellStack : public CellBuffer {
   /** Return the next box (but does not pop it).*/
   Cell* top() const;
 
+  /** Return true (last-in first-out). */
+  bool lifo() const;
+
  private:
   /* Stack of cells */
   std::stack<Cell*> cstack;
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 15, 2013
-// Last Update : Apr 15, 2013
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_EntailedCtr.h"
@@ -48,6 +48,18 @@ std::pair<Backtrackable*,Backtrackable*> EntailedCtr::down() {
 	return std::pair<Backtrackable*,Backtrackable*>(new EntailedCtr(*this),new EntailedCtr(*this));
 }
 
+bool EntailedCtr::serialize(std::ostream& os) const {
+	os.write((const char*) orig_entailed, orig_sys->nb_ctr*sizeof(bool));
+	os.write((const char*) norm_entailed, norm_sys->nb_ctr*sizeof(bool));
+	return true;
+}
+
+Backtrackable* EntailedCtr::deserialize(std::istream& is) const {
+	EntailedCtr* e=new EntailedCtr(*this);
+	is.read((char*) e->orig_entailed, orig_sys->nb_ctr*sizeof(bool));
+	is.read((char*) e->norm_entailed, norm_sys->nb_ctr*sizeof(bool));
+	return e;
+}
 
 void EntailedCtr::set_normalized_entailed(int i) {
 	norm_entailed[i] = true;
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 15, 2013
-// Last Update : Apr 15, 2013
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_ENTAILED_CTR_H__
@@ -82,6 +82,16 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Write the entailed constraints.
+	 */
+	bool serialize(std::ostream& os) const;
+
+	/**
+	 * \brief Read the entailed constraints (the systems are those of *this).
+	 */
+	Backtrackable* deserialize(std::istream& is) const;
+
 	/** number of constraints (normalized system) */
 	//const int n;
 
@@ -0,0 +1,69 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_JacobianCache.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_JacobianCache.h"
+
+namespace ibex {
+
+JacobianCache::JacobianCache() : f(NULL), kind(JACOBIAN), box(NULL), J(NULL) {
+
+}
+
+JacobianCache::~JacobianCache() {
+	clear();
+}
+
+std::pair<Backtrackable*,Backtrackable*> JacobianCache::down() {
+	return std::pair<Backtrackable*,Backtrackable*>(new JacobianCache(),new JacobianCache());
+}
+
+bool JacobianCache::serialize(std::ostream& os) const {
+	return true;
+}
+
+Backtrackable* JacobianCache::deserialize(std::istream& is) const {
+	return new JacobianCache();
+}
+
+void JacobianCache::store(const Function& f, const IntervalVector& box, const IntervalMatrix& J, matrix_kind kind) {
+	if (this->box && this->box->size()==box.size() &&
+			this->J->nb_rows()==J.nb_rows() && this->J->nb_cols()==J.nb_cols()) {
+		// reuse the memory
+		*this->box=box;
+		*this->J=J;
+	} else {
+		clear();
+		this->box=new IntervalVector(box);
+		this->J=new IntervalMatrix(J);
+	}
+	this->f=&f;
+	this->kind=kind;
+}
+
+IntervalMatrix* JacobianCache::find(const Function& f, const IntervalVector& box, double ratio, bool hansen) {
+	if (this->f!=&f || (kind==HANSEN && !hansen)) return NULL;
+
+	if (this->box->size()!=box.size() || !box.is_subset(*this->box)) return NULL;
+
+	if (!(this->box->rel_distance(box)<=ratio)) return NULL;
+
+	return J;
+}
+
+void JacobianCache::clear() {
+	if (box) {
+		delete box;
+		delete J;
+	}
+	f=NULL;
+	box=NULL;
+	J=NULL;
+}
+
+} // end namespace ibex
@@ -0,0 +1,103 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_JacobianCache.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_JACOBIAN_CACHE_H__
+#define __IBEX_JACOBIAN_CACHE_H__
+
+#include "ibex_Backtrackable.h"
+#include "ibex_Function.h"
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Derivatives computed in a cell.
+ *
+ * A contractor that computes the derivatives of a function (e.g., #ibex::CtcNewton)
+ * stores them in the cell, with the box where they have been computed. The bisector
+ * (e.g., #ibex::SmearFunction) can then use them instead of computing the Jacobian
+ * matrix again, as long as the box of the cell has not been contracted too much since.
+ *
+ * The derivatives are only stored if the cell contains this data, i.e., if a
+ * consumer has added it to the root cell (see #ibex::Bsc::add_backtrackable()).
+ *
+ * The subcells start with an empty cache (the derivatives are not written either
+ * when the cell is serialized).
+ */
+class JacobianCache : public Backtrackable {
+public:
+	/**
+	 * \brief Kind of matrix.
+	 *
+	 * JACOBIAN: an enclosure of the Jacobian matrix on the box.
+	 * HANSEN: a Hansen matrix (see #ibex::Function::hansen_matrix()). Its entries
+	 * are derivatives on sub-boxes, so it is not an enclosure of the Jacobian
+	 * matrix but it can be used as an approximation.
+	 */
+	typedef enum { JACOBIAN, HANSEN } matrix_kind;
+
+	/**
+	 * \brief Empty cache (root cell).
+	 */
+	JacobianCache();
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~JacobianCache();
+
+	/**
+	 * \brief Empty caches for the subcells.
+	 */
+	std::pair<Backtrackable*,Backtrackable*> down();
+
+	/**
+	 * \brief Nothing is written (the derivatives are dropped).
+	 */
+	bool serialize(std::ostream& os) const;
+
+	/**
+	 * \brief Empty cache.
+	 */
+	Backtrackable* deserialize(std::istream& is) const;
+
+	/**
+	 * \brief Store the derivatives of \a f computed on \a box.
+	 *
+	 * The previous derivatives (if any) are replaced.
+	 */
+	void store(const Function& f, const IntervalVector& box, const IntervalMatrix& J, matrix_kind kind=JACOBIAN);
+
+	/**
+	 * \brief Derivatives of \a f for \a box.
+	 *
+	 * Return NULL unless derivatives of \a f have been stored for a box B
+	 * that contains \a box, with B.rel_distance(box)<=ratio (a negative ratio
+	 * means that derivatives are never found).
+	 *
+	 * \param hansen - if false, only an enclosure of the Jacobian matrix is returned.
+	 */
+	IntervalMatrix* find(const Function& f, const IntervalVector& box, double ratio, bool hansen=false);
+
+	/**
+	 * \brief Remove the derivatives.
+	 */
+	void clear();
+
+private:
+	const Function* f;       // NULL if empty
+	matrix_kind kind;
+	IntervalVector* box;
+	IntervalMatrix* J;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_JACOBIAN_CACHE_H__
@@ -0,0 +1,331 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_ParallelSolver.h"
+#include "ibex_NoBisectableVariableException.h"
+
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Data shared by all the workers.
+ */
+class Search {
+public:
+	Search(ParallelSolver& solver) : solver(solver), nb_cells(0), nb_steals(0), pending(0), queued(0), nb_idle(0), stop(false),
+	start(chrono::steady_clock::now()) { }
+
+	ParallelSolver& solver;
+
+	/* Number of cells created so far */
+	atomic<long> nb_cells;
+
+	/* Number of cells stolen so far */
+	atomic<long> nb_steals;
+
+	/* Number of cells either stored in a deque or being processed by a worker.
+	 * The search is over when this number falls down to 0. */
+	atomic<long> pending;
+
+	/* Number of cells stored in a deque */
+	atomic<long> queued;
+
+	/* Number of workers waiting for a cell (in #wait()) */
+	atomic<int> nb_idle;
+
+	/* Set when the search has to be interrupted (limit reached or error) */
+	atomic<bool> stop;
+
+	/* Idle workers wait on "work", which is signaled when cells are
+	 * pushed and when the search is over. */
+	mutex idle_mutex;
+	condition_variable work;
+
+	/* Solutions found so far (protected by sol_mutex) */
+	vector<IntervalVector> sols;
+	mutex sol_mutex;
+
+	/* First exception thrown by a worker (protected by sol_mutex) */
+	exception_ptr error;
+
+	chrono::steady_clock::time_point start;
+
+	double elapsed() const {
+		return chrono::duration<double>(chrono::steady_clock::now()-start).count();
+	}
+
+	/* Wait until a cell is pushed or the search is over.
+	 * Return false if the search is over. */
+	bool wait() {
+		unique_lock<mutex> lock(idle_mutex);
+		nb_idle++;
+		while (queued==0 && pending>0 && !stop) work.wait(lock);
+		nb_idle--;
+		return pending>0 && !stop;
+	}
+
+	/* Wake up one idle worker, if any (a cell has been pushed). */
+	void notify_push() {
+		// the counter of cells is increased before reading nb_idle, and a worker increases
+		// nb_idle before reading the counter: a cell cannot be missed by all the idle workers
+		if (nb_idle>0) {
+			lock_guard<mutex> lock(idle_mutex);
+			work.notify_one();
+		}
+	}
+
+	/* A cell has been processed (deleted or replaced by its children). */
+	void done() {
+		if (--pending==0) notify_end();
+	}
+
+	/* Interrupt the search. Return false if it was already interrupted. */
+	bool interrupt() {
+		bool first=!stop.exchange(true);
+		notify_end();
+		return first;
+	}
+
+	/* Wake up all the idle workers (the search is over). */
+	void notify_end() {
+		lock_guard<mutex> lock(idle_mutex);
+		work.notify_all();
+	}
+};
+
+/*
+ * A worker = a thread with its own stack of cells
+ * and its own contractor and bisector.
+ */
+class Worker {
+public:
+	Worker(Search& search, Ctc& ctc, Bsc& bsc) : search(search), ctc(ctc), bsc(bsc), impact(BitSet::all(ctc.nb_var)) {
+		impact.clear();
+	}
+
+	~Worker() {
+		while (!cells.empty()) {
+			delete cells.back();
+			cells.pop_back();
+		}
+	}
+
+	/* Push a cell on the top of the stack (local end) */
+	void push(Cell* c) {
+		{
+			lock_guard<mutex> lock(cells_mutex);
+			cells.push_back(c);
+		}
+		search.queued++;
+		search.notify_push();
+	}
+
+	/* Pop a cell from the top of the stack (NULL if empty) */
+	Cell* pop() {
+		lock_guard<mutex> lock(cells_mutex);
+		if (cells.empty()) return NULL;
+		Cell* c=cells.back();
+		cells.pop_back();
+		search.queued--;
+		return c;
+	}
+
+	/* Steal a cell from the bottom of the stack (NULL if empty) */
+	Cell* steal() {
+		lock_guard<mutex> lock(cells_mutex);
+		if (cells.empty()) return NULL;
+		Cell* c=cells.front();
+		cells.pop_front();
+		search.queued--;
+		return c;
+	}
+
+	/* Contract and bisect a cell (the cell is deleted or replaced by its children) */
+	void process(Cell* c);
+
+	/* Main loop */
+	void run(vector<Worker*>& workers, int me);
+
+	Search& search;
+	Ctc& ctc;
+	Bsc& bsc;
+	BitSet impact;
+
+private:
+	deque<Cell*> cells;
+	mutex cells_mutex;
+};
+
+void Worker::process(Cell* c) {
+
+	int v=c->get<BisectedVar>().var;      // last bisected var.
+
+	if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
+		impact.add(v);
+	else                                // root node : impact set to 1 for all variables
+		impact.fill(0,ctc.nb_var-1);
+
+	ctc.contract(*c,impact);
+
+	if (v!=-1)
+		impact.remove(v);
+	else
+		impact.clear();
+
+	if (c->box.is_empty()) {
+		delete c;
+		search.done();
+		return;
+	}
+
+	try {
+		vector<Cell*> new_cells=bsc.split(*c);
+		delete c;
+
+		// note: the counter is increased before being decreased
+		// so that it never falls down to 0 while cells remain.
+		search.pending+=new_cells.size();
+		for (vector<Cell*>::iterator it=new_cells.begin(); it!=new_cells.end(); it++)
+			push(*it);
+		search.done();
+
+		long n=(search.nb_cells+=new_cells.size());
+		if (search.solver.cell_limit >=0 && n>=search.solver.cell_limit) throw CellLimitException();
+	}
+	catch (NoBisectableVariableException&) {
+		{
+			lock_guard<mutex> lock(search.sol_mutex);
+			search.sols.push_back(c->box);
+			if (search.solver.trace >=1) {
+				cout.precision(12);
+				cout << " sol " << search.sols.size() << " nb_cells " << search.nb_cells.load() << " " << c->box << endl;
+			}
+		}
+		delete c;
+		search.done();
+	}
+}
+
+void Worker::run(vector<Worker*>& workers, int me) {
+	int n=workers.size();
+
+	try {
+		while (!search.stop) {
+
+			Cell* c=pop();
+
+			// try to steal a cell from the other workers,
+			// starting with the next one
+			for (int i=1; c==NULL && i<n; i++) {
+				c=workers[(me+i)%n]->steal();
+				if (c) search.nb_steals++;
+			}
+
+			if (c==NULL) {
+				if (!search.wait()) break; // the search is over
+				continue;
+			}
+
+			process(c);
+
+			if (search.solver.time_limit>0 && search.elapsed()>=search.solver.time_limit)
+				throw TimeOutException();
+		}
+	}
+	catch (TimeOutException&) {
+		if (search.interrupt())
+			cout << "time limit " << search.solver.time_limit << "s. reached " << endl;
+	}
+	catch (CellLimitException&) {
+		if (search.interrupt())
+			cout << "cell limit " << search.solver.cell_limit << " reached " << endl;
+	}
+	catch (...) {
+		{
+			lock_guard<mutex> lock(search.sol_mutex);
+			if (!search.error) search.error=current_exception();
+		}
+		search.interrupt();
+	}
+}
+
+void run_worker(vector<Worker*>* workers, int me) {
+	(*workers)[me]->run(*workers, me);
+}
+
+} // end anonymous namespace
+
+ParallelSolver::ParallelSolver(Factory& factory, int nb_threads) : factory(factory),
+		nb_threads(nb_threads>0? nb_threads : (thread::hardware_concurrency()>0? thread::hardware_concurrency() : 1)),
+		time_limit(-1), cell_limit(-1), trace(0), nb_cells(0), nb_steals(0), time(0) {
+
+}
+
+vector<IntervalVector> ParallelSolver::solve(const IntervalVector& init_box) {
+
+	Search search(*this);
+
+	vector<Worker*> workers(nb_threads);
+
+	for (int i=0; i<nb_threads; i++) {
+		workers[i]=new Worker(search, factory.ctc(i), factory.bsc(i));
+		assert(init_box.size()==workers[i]->ctc.nb_var);
+	}
+
+	Cell* root=new Cell(init_box);
+
+	// add data required by this solver
+	root->add<BisectedVar>();
+
+	// add data required by the bisector
+	workers[0]->bsc.add_backtrackable(*root);
+
+	// add data required by the contractor
+	workers[0]->ctc.add_backtrackable(*root);
+
+	search.pending=1;
+	workers[0]->push(root);
+
+	// the calling thread plays the role of the first worker
+	vector<thread> threads;
+	for (int i=1; i<nb_threads; i++)
+		threads.push_back(thread(run_worker, &workers, i));
+
+	run_worker(&workers, 0);
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); it++)
+		it->join();
+
+	// remaining cells (if the search was interrupted)
+	// are deleted with the workers
+	for (int i=0; i<nb_threads; i++)
+		delete workers[i];
+
+	nb_cells = search.nb_cells;
+	nb_steals = search.nb_steals;
+	time = search.elapsed();
+
+	if (search.error) rethrow_exception(search.error);
+
+	return search.sols;
+}
+
+} // end namespace ibex
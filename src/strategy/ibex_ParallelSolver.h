@@ -0,0 +1,115 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_SOLVER_H__
+#define __IBEX_PARALLEL_SOLVER_H__
+
+#include "ibex_Solver.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Parallel solver.
+ *
+ * Same branch and prune algorithm as #ibex::Solver but the search tree is
+ * explored by several threads. Each thread (or "worker") has its own stack of
+ * cells (depth-first search) and, when this stack is empty, it steals the oldest
+ * cell of another worker (the cell with the largest box, in general).
+ *
+ * Contractors and bisectors are usually not thread-safe (they have internal
+ * workspaces). So each worker has its own contractor and bisector, built by a
+ * #ibex::ParallelSolver::Factory.
+ *
+ * Provided that the contractor and the bisector built for each worker behave
+ * identically and do not depend on the history of the search (which is the case
+ * with the usual ones), the search tree is the same as with #ibex::Solver: the
+ * number of cells and the solutions found are identical (up to the order in which
+ * solutions are found).
+ */
+class ParallelSolver {
+public:
+
+	/**
+	 * \brief Builds the operators of each worker.
+	 *
+	 * The objects returned by #ctc(int) and #bsc(int) are owned by the factory
+	 * (the solver never deletes them) and must not be shared between two workers.
+	 * A simple way to obtain independent contractors is to build them on a copy
+	 * of the system (see #ibex::System::System(const System&, copy_mode)).
+	 */
+	class Factory {
+	public:
+		/** \brief Delete *this. */
+		virtual ~Factory() { }
+
+		/** \brief The contractor of the worker n°i (i=0,...,nb_threads-1). */
+		virtual Ctc& ctc(int i)=0;
+
+		/** \brief The bisector of the worker n°i (i=0,...,nb_threads-1). */
+		virtual Bsc& bsc(int i)=0;
+	};
+
+	/**
+	 * \brief Build a parallel solver.
+	 *
+	 * \param factory    - builds the contractor and the bisector of each worker.
+	 * \param nb_threads - the number of workers. By default (-1), the number of
+	 *                     hardware threads.
+	 */
+	ParallelSolver(Factory& factory, int nb_threads=-1);
+
+	/**
+	 * \brief Solve the system.
+	 *
+	 * \param init_box - the initial box (the search space)
+	 *
+	 * Return :the vector of solutions (small boxes with the required precision) found by the solver.
+	 */
+	std::vector<IntervalVector> solve(const IntervalVector& init_box);
+
+	/** The factory of contractors and bisectors. */
+	Factory& factory;
+
+	/** Number of workers. */
+	const int nb_threads;
+
+	/** Maximum time used by the solver (in seconds).
+	 * Contrary to #ibex::Solver, this is a <b>real</b> time (not the cpu time
+	 * which is the sum of the time spent by all the workers).
+	 * The value can be fixed by the user. By default, it is -1 (no limit). */
+	double time_limit;
+
+	/** Maximal number of cells created by the solver.
+	 * The value can be fixed by the user. By default, it is -1 (no limit). */
+	long cell_limit;
+
+	/**
+	 * \brief Trace level
+	 *
+	 *  0  : no trace  (default value)
+	 *  1  : the solutions are printed each time a new solution is found
+	 */
+	int trace;
+
+	/** Number of nodes in the search tree */
+	long nb_cells;
+
+	/** Number of cells stolen by a worker from another one (statistic). */
+	long nb_steals;
+
+	/** Real running time of the last exploration */
+	double time;
+};
+
+} // end namespace ibex
+#endif // __IBEX_PARALLEL_SOLVER_H__
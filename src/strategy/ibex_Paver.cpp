@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Paver.h"
@@ -16,12 +16,12 @@ using namespace std;
 namespace ibex {
 
 Paver::Paver(const Array<Ctc>& c, Bsc& b, CellBuffer& buffer) :
-		capacity(-1), ctc_loop(true), ctc(c), bsc(b), buffer(buffer) {
+		capacity(-1), ctc_loop(true), ctc(c), bsc(b), buffer(buffer), nb_boxes(0) {
 
 	assert(ctc.size()>0);
 }
 
-void Paver::contract(Cell& cell, SubPaving* paving) {
+void Paver::contract(Cell& cell, const Array<BoxSink>& sinks) {
 	int i=0; // contractor number
 
 	int n=ctc.size(); // number of contractors
@@ -50,14 +50,16 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 
 		if (cell.box.is_empty()) {
 			if (trace) cout << " -> empty set" << endl;
-			paving[i].add(tmpbox);
+			sinks[i].add(tmpbox);
+			nb_boxes++;
 			return;
 		}
 
 		if (tmpbox.rel_distance(cell.box)>0) {
 			fix_count=0;
 
-			paving[i].add(tmpbox,cell.box);
+			sinks[i].add(tmpbox,cell.box);
+			nb_boxes++;
 
 			if (trace) cout << " -> contracts" << endl;
 
@@ -73,18 +75,32 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 
 void Paver::bisect(Cell& c) {
 
-	pair<IntervalVector,IntervalVector> boxes=bsc.bisect(c);
-	pair<Cell*,Cell*> new_cells=c.bisect(boxes.first,boxes.second);
+	vector<Cell*> new_cells=bsc.split(c);
 
 	delete buffer.pop();
-	buffer.push(new_cells.first);
-	buffer.push(new_cells.second);
+	for (vector<Cell*>::iterator it=new_cells.begin(); it!=new_cells.end(); it++)
+		buffer.push(*it);
 }
 
 SubPaving* Paver::pave(const IntervalVector& init_box) {
 
 	SubPaving* paving=new SubPaving[ctc.size()];
 
+	Array<BoxSink> sinks(ctc.size());
+	for (int i=0; i<ctc.size(); i++)
+		sinks.set_ref(i,paving[i]);
+
+	pave(init_box,sinks);
+
+	return paving;
+}
+
+void Paver::pave(const IntervalVector& init_box, const Array<BoxSink>& sinks) {
+
+	assert(sinks.size()==ctc.size());
+
+	nb_boxes=0;
+
 	buffer.flush();
 
 	Cell* root=new Cell(init_box);
@@ -103,26 +119,24 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 
 		if (trace) cout << buffer << endl;
 
-		contract(*c, paving);
+		contract(*c, sinks);
 
 		Timer::check(timeout);
-		check_capacity(paving);
+		check_capacity();
 
 		if (c->box.is_empty()) delete buffer.pop();
 		else bisect(*c);
 	}
 
-	return paving;
+	for (int i=0; i<sinks.size(); i++)
+		sinks[i].flush();
 }
 
 
-void Paver::check_capacity(SubPaving* paving) {
+void Paver::check_capacity() {
 	if (capacity==-1) return;
 
-	int size=0;
-	for (int i=0; i<ctc.size(); i++) size+=paving[i].size();
-
-	if (size>capacity) throw CapacityException();
+	if (nb_boxes>capacity) throw CapacityException();
 }
 
 } // end namespace ibex
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_PAVER_H__
@@ -51,6 +51,15 @@ public:
 	 */
 	SubPaving* pave(const IntervalVector& init_box);
 
+	/**
+	 * \brief Run the paver with sinks.
+	 *
+	 * The boxes removed by the ith contractor are passed to the ith sink
+	 * (see #ibex::BoxSink) as soon as they are produced, instead of being stored.
+	 * The same sink may appear several times.
+	 */
+	void pave(const IntervalVector& init_box, const Array<BoxSink>& sinks);
+
 	/*----------------------------------------------------------------------------------*/
 	/*                                        PARAMETERS                                */
 	/*----------------------------------------------------------------------------------*/
@@ -58,7 +67,7 @@ public:
 	/**
 	 * \brief Capacity of the solver.
 	 *
-	 * The total number of boxes that can be stored.
+	 * The total number of boxes that can be stored (or passed to the sinks).
 	 * This parameter allows to bound space complexity.
 	 * The value can be fixed by the user. By default, it is -1 (no limit).
 	 *
@@ -105,23 +114,26 @@ protected:
 	/**
 	 * \brief Calls all the contractors until the fix-point is reached.
 	 *
-	 * Contracted parts are put into the paving in argument.
+	 * Contracted parts are passed to the sinks in argument.
 	 *
 	 * \return the contractor number that entirely emptied the box, if any.
 	 * Otherwise, return -1 (the box is non empty and the fixpoint is reached).
 	 */
-	void contract(Cell& c, SubPaving*);
+	void contract(Cell& c, const Array<BoxSink>& sinks);
 
 	/**
-	 * \brief Check the number of boxes stored in the paving.
+	 * \brief Check the number of boxes passed to the sinks.
 	 */
-	void check_capacity(SubPaving*);
+	void check_capacity();
 
 	/**
 	 * \brief Bisect the cell and push the two subcells into the buffer.
 	 */
 	void bisect(Cell& c);
 
+	/* Number of boxes passed to the sinks. */
+	long nb_boxes;
+
 };
 
 
@@ -5,29 +5,75 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : May 13, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_Solver.h"
 #include "ibex_NoBisectableVariableException.h"
 #include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 
 using namespace std;
 
 namespace ibex {
 
-Solver::Solver(Ctc& ctc, Bsc& bsc, CellBuffer& buffer) :
-		  ctc(ctc), bsc(bsc), buffer(buffer), time_limit(-1), cell_limit(-1), trace(0), time(0), impact(BitSet::all(ctc.nb_var)) {
+namespace {
 
-	nb_cells=0;
+// sink that stores the solutions in a vector
+class SolutionVector : public BoxSink {
+public:
+	SolutionVector(vector<IntervalVector>& sols) : sols(sols) { }
+
+	void add(const IntervalVector& box) {
+		sols.push_back(box);
+	}
+
+	using BoxSink::add;
 
+	vector<IntervalVector>& sols;
+};
+
+// first bytes of a checkpoint file
+const char magic[]="IBEX-SOLVER-1";
+
+template<typename T>
+void write(ostream& os, const T& x) {
+	os.write((const char*) &x, sizeof(T));
 }
 
-void Solver::start(const IntervalVector& init_box) {
-	buffer.flush();
+template<typename T>
+void read(istream& is, T& x) {
+	is.read((char*) &x, sizeof(T));
+}
 
-	assert(init_box.size()==ctc.nb_var);
+void write(ostream& os, const IntervalVector& x) {
+	int n=x.size();
+	write(os,n);
+	for (int i=0; i<n; i++)
+		write(os,x[i]);
+}
+
+void read(istream& is, IntervalVector& x) {
+	int n;
+	read(is,n);
+	x.resize(n);
+	for (int i=0; i<n; i++)
+		read(is,x[i]);
+}
+
+}
+
+Solver::Solver(Ctc& ctc, Bsc& bsc, CellBuffer& buffer) :
+		  ctc(ctc), bsc(bsc), buffer(buffer), time_limit(-1), cell_limit(-1), trace(0), checkpoint_interval(600), time(0),
+		  impact(BitSet::all(ctc.nb_var)), last_checkpoint(0), nb_sols(0) {
 
+	nb_cells=0;
+
+}
+
+Cell* Solver::root_cell(const IntervalVector& init_box) {
 	Cell* root=new Cell(init_box);
 
 	// add data required by this solver
@@ -36,17 +82,112 @@ void Solver::start(const IntervalVector& init_box) {
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
+	// add data required by the contractor
+	ctc.add_backtrackable(*root);
+
+	return root;
+}
+
+void Solver::start(const IntervalVector& init_box) {
+	buffer.flush();
+
+	assert(init_box.size()==ctc.nb_var);
+
+	Cell* root=root_cell(init_box);
+
+	for (vector<CtcProfiler*>::iterator it=profilers.begin(); it!=profilers.end(); it++)
+		(*it)->reset();
+
 	buffer.push(root);
 
-	int nb_var=init_box.size();
+	last_checkpoint=time;
+	nb_sols=0;
+
+	Timer::start();
+
+}
+
+void Solver::restore(const char* filename, vector<IntervalVector>& sols) {
+	ifstream is(filename, ios::in | ios::binary);
+	if (!is) ibex_error("Solver: cannot open checkpoint file");
+
+	char m[sizeof(magic)];
+	is.read(m,sizeof(magic));
+	if (!is || strncmp(m,magic,sizeof(magic))!=0) ibex_error("Solver: not a checkpoint file");
+
+	int n;
+	read(is,n);
+	if (n!=ctc.nb_var) ibex_error("Solver: checkpoint of a different system");
+
+	read(is,nb_cells);
+	read(is,time);
+
+	unsigned int size;
+	read(is,size);
+	IntervalVector sol(n);
+	for (unsigned int i=0; i<size; i++) {
+		read(is,sol);
+		sols.push_back(sol);
+	}
+	nb_sols=sols.size();
+
+	buffer.flush();
 
-	IntervalVector tmpbox(ctc.nb_var);
+	// the root cell gives the prototypes of the data
+	Cell* root=root_cell(IntervalVector(n));
+	buffer.load(is,*root);
+	delete root;
+
+	for (vector<CtcProfiler*>::iterator it=profilers.begin(); it!=profilers.end(); it++)
+		(*it)->reset();
+
+	last_checkpoint=time;
 
 	Timer::start();
+}
 
+vector<IntervalVector> Solver::resume(const char* filename) {
+	vector<IntervalVector> sols;
+	restore(filename,sols);
+	while (next(sols)) { }
+	return sols;
+}
+
+void Solver::checkpoint(const char* filename, const vector<IntervalVector>& sols) {
+	string tmp=string(filename)+".tmp";
+	{
+		ofstream os(tmp.c_str(), ios::out | ios::binary | ios::trunc);
+		if (!os) ibex_error("Solver: cannot write checkpoint file");
+
+		os.write(magic,sizeof(magic));
+		write(os,ctc.nb_var);
+		write(os,nb_cells);
+		write(os,time);
+
+		unsigned int size=sols.size();
+		write(os,size);
+		for (vector<IntervalVector>::const_iterator it=sols.begin(); it!=sols.end(); it++)
+			write(os,*it);
+
+		buffer.save(os);
+
+		if (!os) ibex_error("Solver: cannot write checkpoint file");
+	}
+	if (std::rename(tmp.c_str(),filename)!=0) ibex_error("Solver: cannot write checkpoint file");
 }
 
 bool Solver::next(std::vector<IntervalVector>& sols) {
+	SolutionVector sink(sols);
+	return next(sink,sols);
+}
+
+bool Solver::next(BoxSink& sink) {
+	// the solutions are not stored
+	vector<IntervalVector> sols;
+	return next(sink,sols);
+}
+
+bool Solver::next(BoxSink& sink, const std::vector<IntervalVector>& sols) {
 	try  {
 		while (!buffer.empty()) {
 
@@ -61,7 +202,7 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 			else                                // root node : impact set to 1 for all variables
 				impact.fill(0,ctc.nb_var-1);
 
-			ctc.contract(c->box,impact);
+			ctc.contract(*c,impact);
 
 			if (c->box.is_empty()) {
 				delete buffer.pop();
@@ -77,17 +218,16 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 
 			try {
 
-				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
-				pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+				vector<Cell*> new_cells=bsc.split(*c);
 
 				delete buffer.pop();
-				buffer.push(new_cells.first);
-				buffer.push(new_cells.second);
-				nb_cells+=2;
+				for (vector<Cell*>::iterator it=new_cells.begin(); it!=new_cells.end(); it++)
+					buffer.push(*it);
+				nb_cells+=new_cells.size();
 				if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();}
 
 			catch (NoBisectableVariableException&) {
-				new_sol(sols, c->box);
+				new_sol(sink, c->box);
 				delete buffer.pop();
 				return !buffer.empty();
 				// note that we skip time_limit_check() here.
@@ -99,10 +239,23 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 				// an error case).
 			}
 			time_limit_check();
+
+			if (!checkpoint_file.empty() && time-last_checkpoint>=checkpoint_interval) {
+				// the solutions found since the last checkpoint
+				// are not in the buffer anymore
+				sink.flush();
+				checkpoint(checkpoint_file.c_str(),sols);
+				last_checkpoint=time;
+			}
 		}
 	}
 	catch (TimeOutException&) {
-		cout << "time limit " << time_limit << "s. reached " << endl; return false;
+		cout << "time limit " << time_limit << "s. reached " << endl;
+		if (!checkpoint_file.empty()) {
+			sink.flush();
+			checkpoint(checkpoint_file.c_str(),sols);
+		}
+		return false;
 	}
 	catch (CellLimitException&) {
 		cout << "cell limit " << cell_limit << " reached " << endl;
@@ -122,6 +275,19 @@ vector<IntervalVector> Solver::solve(const IntervalVector& init_box) {
 	return sols;
 }
 
+void Solver::solve(const IntervalVector& init_box, BoxSink& sink) {
+	start(init_box);
+	while (next(sink)) { }
+	sink.flush();
+}
+
+void Solver::report_profile(ostream& os, bool json) const {
+	if (json)
+		CtcProfiler::print_json(os,profilers);
+	else
+		CtcProfiler::print_table(os,profilers);
+}
+
 void Solver::time_limit_check () {
 	Timer::stop();
 	time += Timer::VIRTUAL_TIMELAPSE();
@@ -130,11 +296,12 @@ void Solver::time_limit_check () {
 }
 
 
-void Solver::new_sol (vector<IntervalVector> & sols, IntervalVector & box) {
-	sols.push_back(box);
+void Solver::new_sol (BoxSink& sink, IntervalVector & box) {
+	sink.add(box);
+	nb_sols++;
 	cout.precision(12);
 	if (trace >=1)
-		cout << " sol " << sols.size() << " nb_cells " <<  nb_cells << " "  << sols[sols.size()-1] <<   endl;
+		cout << " sol " << nb_sols << " nb_cells " <<  nb_cells << " "  << box <<   endl;
 }
 
 } // end namespace ibex
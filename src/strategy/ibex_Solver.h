@@ -5,21 +5,23 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : August 21, 2013
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_SOLVER_H__
 #define __IBEX_SOLVER_H__
 
 #include "ibex_Ctc.h"
+#include "ibex_CtcProfiler.h"
 #include "ibex_Pdc.h"
 #include "ibex_Bsc.h"
 #include "ibex_CellBuffer.h"
-#include "ibex_SubPaving.h"
+#include "ibex_BoxSink.h"
 #include "ibex_Timer.h"
 #include "ibex_Exception.h"
 
 #include <vector>
+#include <string>
 
 namespace ibex {
 
@@ -54,6 +56,14 @@ public:
 	 */
 	std::vector<IntervalVector> solve(const IntervalVector& init_box);
 
+	/**
+	 * \brief Solve the system with a sink (non-interactive mode).
+	 *
+	 * Each solution is passed to \a sink (see #ibex::BoxSink) as soon
+	 * as it is found, instead of being stored.
+	 */
+	void solve(const IntervalVector& init_box, BoxSink& sink);
+
 	/**
 	 * \brief Start solving (interactive mode).
 	 *
@@ -69,6 +79,59 @@ public:
 	 */
 	bool next(std::vector<IntervalVector>& sols);
 
+	/**
+	 * \brief Continue solving with a sink (interactive mode).
+	 *
+	 * Look for the next solution and pass it to \a sink.
+	 * The solutions are not stored: the checkpoints written
+	 * during the search (see #checkpoint_file) contain no solution.
+	 * \return false if the search is over (true otherwise).
+	 */
+	bool next(BoxSink& sink);
+
+	/**
+	 * \brief Resume a search from a checkpoint (non-interactive mode).
+	 *
+	 * \param filename - a file written by #checkpoint().
+	 *
+	 * Return: the solutions found before the checkpoint, followed by the new ones.
+	 * The solver must be built with the same contractor, bisector and kind of
+	 * buffer as the one that wrote the checkpoint (possibly in another process).
+	 */
+	std::vector<IntervalVector> resume(const char* filename);
+
+	/**
+	 * \brief Resume a search from a checkpoint (interactive mode).
+	 *
+	 * Replaces #start(const IntervalVector&): the buffer, the number of cells
+	 * and the running time are restored and the solutions found before the
+	 * checkpoint are pushed into \a sols. Continue with #next().
+	 *
+	 * The running time includes the time spent before the checkpoint:
+	 * #time_limit must be increased to resume a search that timed out.
+	 */
+	void restore(const char* filename, std::vector<IntervalVector>& sols);
+
+	/**
+	 * \brief Write a checkpoint.
+	 *
+	 * Write the pending cells, the number of cells, the running time and
+	 * the solutions \a sols in a binary file, for #resume(). To be called
+	 * between two calls to #next() (e.g., after a time out).
+	 *
+	 * The file is written under a temporary name, then renamed: a
+	 * previous checkpoint is not lost if the process is killed meanwhile.
+	 */
+	void checkpoint(const char* filename, const std::vector<IntervalVector>& sols);
+
+	/**
+	 * \brief Print the statistics of the profilers.
+	 *
+	 * \param json - if true, the statistics are printed in JSON
+	 *               (see #ibex::CtcProfiler::print_json), otherwise as a table.
+	 */
+	void report_profile(std::ostream& os=std::cout, bool json=false) const;
+
 
 	/**
 	 * \brief  The contractor 
@@ -107,6 +170,28 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Profilers.
+	 *
+	 * The profilers wrapping the contractors of the pipeline #ctc
+	 * (see #ibex::CtcProfiler). They are reset when a search starts.
+	 * Empty by default.
+	 */
+	std::vector<CtcProfiler*> profilers;
+
+	/**
+	 * \brief Checkpoint file.
+	 *
+	 * If not empty, a checkpoint (see #checkpoint()) is written in this file
+	 * by #next() every #checkpoint_interval seconds and when the time limit
+	 * is reached. The sink given to #next() is flushed before (see #ibex::BoxSink::flush()):
+	 * a solution is either in the sink or in the checkpoint. Empty by default.
+	 */
+	std::string checkpoint_file;
+
+	/** CPU time (in seconds) between two checkpoints. By default: 600. */
+	double checkpoint_interval;
+
 	/** Number of nodes  in the search tree */
 	int nb_cells;
 
@@ -116,12 +201,25 @@ public:
 
 protected :
 
+	/* Create the root cell with the data required by the solver. */
+	Cell* root_cell(const IntervalVector& init_box);
+
 	void time_limit_check();
 
-	void new_sol(std::vector<IntervalVector> & sols, IntervalVector & box);
+	/* Main loop: the solutions are passed to the sink, and "sols"
+	 * are the solutions stored in the checkpoints. */
+	bool next(BoxSink& sink, const std::vector<IntervalVector>& sols);
+
+	void new_sol(BoxSink& sink, IntervalVector & box);
 
 	BitSet impact;
 
+	/* Time of the last checkpoint */
+	double last_checkpoint;
+
+	/* Number of solutions found */
+	int nb_sols;
+
 };
 
 } // end namespace ibex
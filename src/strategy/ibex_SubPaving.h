@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_SUBPAVING_H__
@@ -14,15 +14,17 @@
 #include <utility>
 #include <vector>
 
-#include "ibex_IntervalVector.h"
+#include "ibex_BoxSink.h"
 
 namespace ibex {
 
 /** \ingroup strategy
  *
  * \brief Subpaving
+ *
+ * A sink that stores all the boxes and traces in memory.
  */
-class SubPaving {
+class SubPaving : public BoxSink {
 public:
 	/**
 	 * \brief Add the trace of a contraction into *this.
@@ -0,0 +1,78 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Adjacency.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Adjacency.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+bool less_index(const pair<int,int>& a, const pair<int,int>& b) {
+	return a.first<b.first;
+}
+
+}
+
+Adjacency::Adjacency(int nb_rows) : m(nb_rows), ptr(nb_rows+1,0) {
+
+}
+
+void Adjacency::add(int row, int col, int label) {
+	assert(row>=0 && row<m);
+	new_row.push_back(row);
+	new_col.push_back(col);
+	new_lab.push_back(label);
+}
+
+int Adjacency::find(int row, int c) const {
+	IndexSpan l=(*this)[row];
+	const int* p=lower_bound(l.begin(),l.end(),c);
+	return (p!=l.end() && *p==c) ? (int) (p-l.begin()) : -1;
+}
+
+void Adjacency::build() const {
+	if (new_row.empty()) return;
+
+	// the elements of each row (old ones first, so that they
+	// take precedence over the new ones, then in insertion order)
+	vector<vector<pair<int,int> > > rows(m);
+
+	for (int r=0; r<m; r++)
+		for (int k=ptr[r]; k<ptr[r+1]; k++)
+			rows[r].push_back(make_pair(col[k],lab[k]));
+
+	for (unsigned int k=0; k<new_row.size(); k++)
+		rows[new_row[k]].push_back(make_pair(new_col[k],new_lab[k]));
+
+	col.clear();
+	lab.clear();
+
+	for (int r=0; r<m; r++) {
+		// the first occurrence of an index comes first
+		stable_sort(rows[r].begin(), rows[r].end(), less_index);
+
+		ptr[r]=col.size();
+		for (unsigned int k=0; k<rows[r].size(); k++) {
+			if (k>0 && rows[r][k].first==rows[r][k-1].first) continue;
+			col.push_back(rows[r][k].first);
+			lab.push_back(rows[r][k].second);
+		}
+	}
+	ptr[m]=col.size();
+
+	new_row.clear();
+	new_col.clear();
+	new_lab.clear();
+}
+
+} // namespace ibex
@@ -0,0 +1,173 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Adjacency.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_ADJACENCY_H__
+#define __IBEX_ADJACENCY_H__
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Contiguous range of indices.
+ *
+ * Gives access to an adjacency list of #ibex::Adjacency
+ * without copying it.
+ */
+class IndexSpan {
+public:
+	/**
+	 * \brief Build the range [first,last).
+	 */
+	IndexSpan(const int* first, const int* last);
+
+	/**
+	 * \brief First index.
+	 */
+	const int* begin() const;
+
+	/**
+	 * \brief Past-the-end index.
+	 */
+	const int* end() const;
+
+	/**
+	 * \brief Number of indices.
+	 */
+	int size() const;
+
+	/**
+	 * \brief True iff the range is empty.
+	 */
+	bool empty() const;
+
+	/**
+	 * \brief The ith index.
+	 */
+	int operator[](int i) const;
+
+private:
+	const int* first;
+	const int* last;
+};
+
+/**
+ * \ingroup tools
+ * \brief Adjacency lists in compressed sparse row (CSR) form.
+ *
+ * The lists of all the rows are stored in a single array, in increasing
+ * order and without duplicates. Each element of a list can also carry
+ * an integer label.
+ *
+ * Elements are added with #add(int, int, int) and the arrays are (re)built
+ * on the next access. Accessing a list then neither allocates nor copies
+ * anything.
+ */
+class Adjacency {
+public:
+	/**
+	 * \brief Build empty lists for \a nb_rows rows.
+	 */
+	Adjacency(int nb_rows);
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Add \a col to the list of \a row.
+	 *
+	 * If \a col is already in the list, the element (and its label)
+	 * are left unchanged.
+	 */
+	void add(int row, int col, int label=0);
+
+	/**
+	 * \brief The list of \a row (sorted by increasing index).
+	 */
+	IndexSpan operator[](int row) const;
+
+	/**
+	 * \brief The label of the ith element in the list of \a row.
+	 */
+	int label(int row, int i) const;
+
+	/**
+	 * \brief Position of \a col in the list of \a row, -1 if absent.
+	 */
+	int find(int row, int col) const;
+
+	/**
+	 * \brief Build the arrays with the elements added so far.
+	 *
+	 * Called automatically on the first access after #add.
+	 */
+	void build() const;
+
+private:
+	int m;
+
+	/* CSR arrays: the list of row i is col[ptr[i]]...col[ptr[i+1]-1] */
+	mutable std::vector<int> ptr;
+	mutable std::vector<int> col;
+	mutable std::vector<int> lab;
+
+	/* Elements added since the last build, in insertion order */
+	mutable std::vector<int> new_row, new_col, new_lab;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline IndexSpan::IndexSpan(const int* first, const int* last) : first(first), last(last) {
+}
+
+inline const int* IndexSpan::begin() const {
+	return first;
+}
+
+inline const int* IndexSpan::end() const {
+	return last;
+}
+
+inline int IndexSpan::size() const {
+	return (int) (last-first);
+}
+
+inline bool IndexSpan::empty() const {
+	return first==last;
+}
+
+inline int IndexSpan::operator[](int i) const {
+	assert(i>=0 && i<size());
+	return first[i];
+}
+
+inline int Adjacency::nb_rows() const {
+	return m;
+}
+
+inline IndexSpan Adjacency::operator[](int row) const {
+	assert(row>=0 && row<m);
+	if (!new_row.empty()) build();
+	const int* c=col.empty() ? NULL : &col[0];
+	return IndexSpan(c+ptr[row], c+ptr[row+1]);
+}
+
+inline int Adjacency::label(int row, int i) const {
+	assert(i>=0 && i<(*this)[row].size());
+	return lab[ptr[row]+i];
+}
+
+} // namespace ibex
+
+#endif // __IBEX_ADJACENCY_H__
@@ -92,6 +92,121 @@ class Agenda {
   bool delete_it; // optim info
 };
 
+/**
+ * \ingroup tools
+ * \brief Propagation agenda with priorities.
+ *
+ * Elements are popped by decreasing priority (elements with the same
+ * priority are popped in the order they were pushed). As with #Agenda,
+ * an element is never pushed twice: pushing an element already in the
+ * agenda only updates its priority.
+ *
+ * The agenda is a binary heap of fixed size: push and pop do not allocate.
+ */
+class WeightedAgenda {
+
+ public:
+
+  WeightedAgenda(int size) : size(size), n(0), stamp(0) {
+    heap = new int[size];
+    pos = new int[size];
+    prio = new double[size];
+    order = new long[size];
+    for (int i=0; i<size; i++) {
+      pos[i]=-1;
+    }
+  }
+
+  ~WeightedAgenda() {
+    delete[] heap;
+    delete[] pos;
+    delete[] prio;
+    delete[] order;
+  }
+
+  /** Push p with a given priority (or update its priority if p is already in the agenda). */
+  inline void push(int p, double priority) {
+    if (pos[p]==-1) {
+      pos[p]=n;
+      heap[n++]=p;
+      order[p]=stamp++;
+      prio[p]=priority;
+      up(pos[p]);
+    } else if (priority>prio[p]) {
+      prio[p]=priority;
+      up(pos[p]);
+    } else if (priority<prio[p]) {
+      prio[p]=priority;
+      down(pos[p]);
+    }
+  }
+
+  /** Pop the element with the highest priority. */
+  inline void pop(int& p) {
+    if (n==0) throw EmptyAgendaException();
+
+    p = heap[0];
+    pos[p] = -1;
+
+    if (--n>0) {
+      heap[0]=heap[n];
+      pos[heap[0]]=0;
+      down(0);
+    }
+  }
+
+  inline void flush() {
+    for (int i=0; i<n; i++)
+      pos[heap[i]]=-1;
+    n=0;
+  }
+
+  inline bool empty() const {
+    return n==0;
+  }
+
+ protected:
+  /* true if p must be popped before q */
+  inline bool before(int p, int q) const {
+    return prio[p]>prio[q] || (prio[p]==prio[q] && order[p]<order[q]);
+  }
+
+  inline void swap(int i, int j) {
+    int tmp=heap[i]; heap[i]=heap[j]; heap[j]=tmp;
+    pos[heap[i]]=i;
+    pos[heap[j]]=j;
+  }
+
+  inline void up(int i) {
+    while (i>0 && before(heap[i],heap[(i-1)/2])) {
+      swap(i,(i-1)/2);
+      i=(i-1)/2;
+    }
+  }
+
+  inline void down(int i) {
+    while (true) {
+      int best=i;
+      if (2*i+1<n && before(heap[2*i+1],heap[best])) best=2*i+1;
+      if (2*i+2<n && before(heap[2*i+2],heap[best])) best=2*i+2;
+      if (best==i) return;
+      swap(i,best);
+      i=best;
+    }
+  }
+
+  int size;
+  int n;        // number of elements in the agenda
+  long stamp;   // counter of pushes (for ties)
+  int *heap;    // heap[0]...heap[n-1]: the elements
+  int *pos;     // position of an element in the heap (-1 if absent)
+  double *prio; // priority of an element
+  long *order;  // date of insertion of an element
+
+ private:
+  WeightedAgenda(const WeightedAgenda&); // forbidden
+};
+
 /**
  * \ingroup tools
  * \brief Propagation agenda (agenda)
@@ -11,6 +11,7 @@
 
 #include "ibex_DirectedHyperGraph.h"
 #include <iterator>
+#include <algorithm>
 
 namespace ibex {
 
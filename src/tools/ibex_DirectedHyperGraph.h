@@ -1,5 +1,5 @@
 /* ============================================================================
- * I B E X - Directed hyper-graph (represented by an adjacency matrix)
+ * I B E X - Directed hyper-graph (represented by adjacency lists)
  * ============================================================================
  * Copyright   : Ecole des Mines de Nantes (FRANCE)
  * License     : This program can be distributed under the terms of the GNU LGPL.
@@ -12,8 +12,9 @@
 #ifndef __IBEX_DIRECTED_HYPER_GRAPH_H__
 #define __IBEX_DIRECTED_HYPER_GRAPH_H__
 
+#include "ibex_Adjacency.h"
+
 #include <iostream>
-#include <set>
 
 namespace ibex {
 
@@ -21,6 +22,9 @@ namespace ibex {
  * \ingroup tools
  * \brief Directed hyper-graph.
  *
+ * The adjacency lists are stored in compressed sparse row form
+ * (see #ibex::Adjacency) and are accessed without copy, as ranges
+ * of indices sorted by increasing order.
  */
 class DirectedHyperGraph {
 public:
@@ -54,31 +58,39 @@ public:
 	 */
 	void add_arc(int ctr, int var, bool incoming);
 
+	/**
+	 * \brief Build the adjacency lists with the arcs added so far.
+	 *
+	 * Optional (done on the first access after #add_arc). Allows to
+	 * allocate the lists before the graph is used.
+	 */
+	void build() const;
+
 	/**
 	 * \brief Return the input variables of a constraint \a ctr.
 	 *
 	 */
-	 const std::set<int>& input_vars(int ctr) const;
+	 IndexSpan input_vars(int ctr) const;
 
 	/**
 	 * \brief Return the output variables of a constraint \a ctr.
 	 *
 	 */
-	 const std::set<int>& output_vars(int ctr) const;
+	 IndexSpan output_vars(int ctr) const;
 
 	/**
 	 * \brief Return the input constraints of a variable \a var.
 	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& input_ctrs(int var) const;
+	 IndexSpan input_ctrs(int var) const;
 
 	/**
 	 * \brief Return the output constraints of a variable \a var.
 	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& output_ctrs(int var) const;
+	 IndexSpan output_ctrs(int var) const;
 
 	/**
 	 * \brief Display the internal structure (matrix & tables).
@@ -92,27 +104,20 @@ private:
 
 	const int m;
 	const int n;
-	std::set<int> *ctr_input_adj;
-	std::set<int> *ctr_output_adj;
-	std::set<int> *var_input_adj;
-	std::set<int> *var_output_adj;
+	Adjacency ctr_input_adj;
+	Adjacency ctr_output_adj;
+	Adjacency var_input_adj;
+	Adjacency var_output_adj;
 };
 
 
 /*================================== inline implementations ========================================*/
 
-inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var) {
-	ctr_input_adj = new std::set<int>[m];
-	ctr_output_adj = new std::set<int>[m];
-	var_input_adj = new std::set<int>[n];
-	var_output_adj = new std::set<int>[n];
+inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var),
+		ctr_input_adj(nb_ctr), ctr_output_adj(nb_ctr), var_input_adj(nb_var), var_output_adj(nb_var) {
 }
 
 inline DirectedHyperGraph::~DirectedHyperGraph() {
-	delete[] ctr_input_adj;
-	delete[] ctr_output_adj;
-	delete[] var_input_adj;
-	delete[] var_output_adj;
 }
 
 inline int DirectedHyperGraph::nb_ctr() const {
@@ -125,27 +130,34 @@ inline int DirectedHyperGraph::nb_var() const {
 
 inline void DirectedHyperGraph::add_arc(int ctr, int var, bool incoming) {
 	if (incoming) {
-		ctr_input_adj[ctr].insert(var);
-		var_output_adj[var].insert(ctr);
+		ctr_input_adj.add(ctr,var);
+		var_output_adj.add(var,ctr);
 	} else {
-		ctr_output_adj[ctr].insert(var);
-		var_input_adj[var].insert(ctr);
+		ctr_output_adj.add(ctr,var);
+		var_input_adj.add(var,ctr);
 	}
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_vars(int ctr) const {
+inline void DirectedHyperGraph::build() const {
+	ctr_input_adj.build();
+	ctr_output_adj.build();
+	var_input_adj.build();
+	var_output_adj.build();
+}
+
+inline IndexSpan DirectedHyperGraph::input_vars(int ctr) const {
 	return ctr_input_adj[ctr];
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_vars(int ctr) const {
+inline IndexSpan DirectedHyperGraph::output_vars(int ctr) const {
 	return ctr_output_adj[ctr];
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_ctrs(int var) const {
+inline IndexSpan DirectedHyperGraph::input_ctrs(int var) const {
 	return var_input_adj[var];
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_ctrs(int var) const {
+inline IndexSpan DirectedHyperGraph::output_ctrs(int var) const {
 	return var_output_adj[var];
 }
 
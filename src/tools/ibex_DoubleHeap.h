@@ -13,6 +13,9 @@
 #include "ibex_SharedHeap.h"
 #include "ibex_Random.h"
 
+#include <vector>
+#include <algorithm>
+
 namespace ibex {
 
 /**
@@ -152,6 +155,19 @@ protected:
 	 */
 	void erase_subnodes(HeapNode<T>* node, bool percolate);
 
+	/**
+	 * \brief Remove the n data that would be popped last.
+	 *
+	 * The rank of a data is its rank in the first heap or in the second heap,
+	 * whichever is the best (only the heaps that can be selected, according to
+	 * #critpr, are considered). The n data with the worst ranks are removed from
+	 * the two heaps and appended to \a data, with their criteria in \a crit1 and
+	 * \a crit2. Nothing is deleted.
+	 *
+	 * Complexity: O(nb_nodes*log(nb_nodes))
+	 */
+	void pop_coldest(unsigned int n, std::vector<T*>& data, std::vector<double>& crit1, std::vector<double>& crit2);
+
 	std::ostream& print(std::ostream& os) const;
 };
 
@@ -245,6 +261,52 @@ void DoubleHeap<T>::erase_subnodes(HeapNode<T>* node, bool percolate) {
 	delete node;
 }
 
+template<class T>
+void DoubleHeap<T>::pop_coldest(unsigned int n, std::vector<T*>& data, std::vector<double>& crit1, std::vector<double>& crit2) {
+	assert(n<=nb_nodes);
+	if (n==0) return;
+
+	std::vector<HeapElt<T>*> elts(nb_nodes);
+	for (unsigned int i=0; i<nb_nodes; i++)
+		elts[i]=heap1->get_node(i)->elt;
+
+	// best[i]: the best rank of the ith element
+	std::vector<unsigned int> best(nb_nodes, nb_nodes);
+	for (int id=0; id<2; id++) {
+		if ((id==0 && critpr>=100) || (id==1 && critpr<=0)) continue;
+
+		std::vector<std::pair<double,unsigned int> > order(nb_nodes);
+		for (unsigned int i=0; i<nb_nodes; i++)
+			order[i]=std::make_pair(elts[i]->crit[id], i);
+		std::sort(order.begin(), order.end());
+
+		for (unsigned int r=0; r<nb_nodes; r++)
+			if (r<best[order[r].second]) best[order[r].second]=r;
+	}
+
+	// the worst ranks first
+	std::vector<std::pair<unsigned int,unsigned int> > cold(nb_nodes);
+	for (unsigned int i=0; i<nb_nodes; i++)
+		cold[i]=std::make_pair(best[i], i);
+	std::sort(cold.rbegin(), cold.rend());
+
+	for (unsigned int k=0; k<n; k++) {
+		HeapElt<T>* elt=elts[cold[k].second];
+		data.push_back(elt->data);
+		crit1.push_back(elt->crit[0]);
+		crit2.push_back(elt->crit[1]);
+
+		heap1->erase_node(elt->holder[0]);
+		heap2->erase_node(elt->holder[1]);
+		elt->data=NULL; // avoid the data to be deleted with the element
+		delete elt;
+	}
+	nb_nodes-=n;
+
+	assert(nb_nodes==heap1->size());
+	assert(nb_nodes==heap2->size());
+}
+
 template<class T>
 bool DoubleHeap<T>::empty() const {
 	// if one buffer is empty, the other is also empty
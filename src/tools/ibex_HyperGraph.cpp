@@ -13,62 +13,28 @@
 
 namespace ibex {
 
-HyperGraph::HyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var) {
-	matrix = new int*[m];
-	ctr_adj = new int*[m];
-	var_adj = new int*[n];
-
-	for (int i=0; i<m; i++) {
-		matrix[i]=new int[n];
-		ctr_adj[i]=new int[n+1]; // the first place is kept for storing the size (arity) of ctr i
-		for (int j=0; j<n; j++) matrix[i][j]=0;
-		for (int j=0; j<n+1; j++) ctr_adj[i][j]=0;
-	}
-	for (int j=0; j<n; j++) {
-		var_adj[j]=new int[m+1]; // the first place is kept for storing the size (arity) of var j
-		for (int i=0; i<m+1; i++) var_adj[j][i]=0;
-	}
+HyperGraph::HyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var), ctr_adj(nb_ctr), var_adj(nb_var) {
+
 }
 
 void HyperGraph::add_arc(int ctr, int var, int value) {
-	if (matrix[ctr][var]>0) return; // already present
-
-	matrix[ctr][var]=value;
+	// if the arc is already present, it is ignored by the adjacency lists
+	ctr_adj.add(ctr,var,value);
 
-	ctr_adj[ctr][++ctr_adj[ctr][0]]=var;
+	var_adj.add(var,ctr);
+}
 
-	var_adj[var][++var_adj[var][0]]=ctr;
+int HyperGraph::arc(int ctr, int var) const {
+	int i=ctr_adj.find(ctr,var);
+	return i==-1 ? 0 : ctr_adj.label(ctr,i);
 }
 
+HyperGraph::HyperGraph(const HyperGraph& g) : m(g.m), n(g.n), ctr_adj(g.ctr_adj), var_adj(g.var_adj) {
 
-HyperGraph::HyperGraph(const HyperGraph& g) : m(g.m), n(g.n) {
-	matrix = new int*[m];
-	ctr_adj = new int*[m];
-	var_adj = new int*[n];
-
-	for (int i=0; i<m; i++) {
-		matrix[i]=new int[n];
-		ctr_adj[i]=new int[n+1];
-		for (int j=0; j<n; j++) matrix[i][j]=g.matrix[i][j];
-		for (int j=0; j<n+1; j++) ctr_adj[i][j]=g.ctr_adj[i][j];
-	}
-	for (int j=0; j<n; j++) {
-		var_adj[j]=new int[m+1];
-		for (int i=0; i<m+1; i++) var_adj[j][i]=g.var_adj[j][i];
-	}
 }
 
 HyperGraph::~HyperGraph() {
-	for (int i=0; i<m; i++) {
-		delete[] matrix[i];
-		delete[] ctr_adj[i];
-	}
-	for (int j=0; j<n; j++) {
-		delete[] var_adj[j];
-	}
-	delete[] matrix;
-	delete[] ctr_adj;
-	delete[] var_adj;
+
 }
 
 std::ostream& operator<<(std::ostream& os, const HyperGraph& g) {
@@ -1,5 +1,5 @@
 /* ============================================================================
- * I B E X - Hypergraph (represented by an adjacency matrix)
+ * I B E X - Hypergraph (represented by adjacency lists)
  * ============================================================================
  * Copyright   : Ecole des Mines de Nantes (FRANCE)
  * License     : This program can be distributed under the terms of the GNU LGPL.
@@ -12,6 +12,8 @@
 #ifndef __IBEX_HYPER_GRAPH_H__
 #define __IBEX_HYPER_GRAPH_H__
 
+#include "ibex_Adjacency.h"
+
 #include <iostream>
 
 namespace ibex {
@@ -20,6 +22,9 @@ namespace ibex {
  * \ingroup tools
  * \brief Hypergraph.
  *
+ * The adjacency lists are stored in compressed sparse row form
+ * (see #ibex::Adjacency): the variables of a constraint (and the
+ * constraints of a variable) are sorted by increasing order.
  */
 class HyperGraph {
 public:
@@ -51,6 +56,8 @@ public:
 
 	/**
 	 * \brief add an arc betweeen \a ctr and \a var.
+	 *
+	 * Nothing is done if the arc is already present.
 	 */
 	void add_arc(int ctr, int var, int value);
 
@@ -58,7 +65,7 @@ public:
 	 * \brief Return the label of the arc (ctr,var), zero
 	 * if there is no such arc.
 	 */
-	inline int arc(int ctr, int var) const { return matrix[ctr][var]; }
+	int arc(int ctr, int var) const;
 
 	/**
 	 * \brief Return the number of variables linked to a constraint \a ctr.
@@ -66,7 +73,7 @@ public:
 	 *  \retval n - a value that satisfies 0 <= \a n <= #nb_var().
 	 *  \pre 0 <= \a ctr < #nb_ctr().
 	 */
-	inline int ctr_nb_vars(int ctr) const { return ctr_adj[ctr][0]; }
+	inline int ctr_nb_vars(int ctr) const { return ctr_adj[ctr].size(); }
 
 	/**
 	 * \brief Return the \a i th variable in a constraint \a ctr.
@@ -74,7 +81,14 @@ public:
 	 *  \retval var - a value that satisfies 0 <= \a var < #nb_var().
 	 *  \pre 0 <= \a var < #nb_var(). <br> 0 <= \a i < #ctr_nb_vars (\a ctr).
 	 */
-	inline int ctr_ith_var(int ctr, int i) const { return ctr_adj[ctr][i+1]; }
+	inline int ctr_ith_var(int ctr, int i) const { return ctr_adj[ctr][i]; }
+
+	/**
+	 * \brief Return the variables linked to a constraint \a ctr.
+	 *
+	 *  \pre 0 <= \a ctr < #nb_ctr().
+	 */
+	inline IndexSpan ctr_vars(int ctr) const { return ctr_adj[ctr]; }
 
 	/**
 	 * \brief Return the number of constraints linked to a variable \a var.
@@ -82,7 +96,7 @@ public:
 	 *  \pre 0 <= \a var < #nb_var().
 	 *  \retval n - a value that satisfies 0 <= \a n <= #nb_ctr().
 	 */
-	inline int var_nb_ctrs(int var) const { return var_adj[var][0]; }
+	inline int var_nb_ctrs(int var) const { return var_adj[var].size(); }
 
 	/**
 	 * \brief Return the \a i th constraint linked to a variable \a var.
@@ -90,7 +104,14 @@ public:
 	 *  \retval ctr - a value that satisfies 0 <= \a ctr < #nb_ctr().
 	 *  \pre 0 <= \a var < #nb_var(). <br> 0 <= \a i < #var_nb_ctrs (\a var).
 	 */
-	inline int var_ith_ctr(int var, int i) const { return var_adj[var][i+1]; }
+	inline int var_ith_ctr(int var, int i) const { return var_adj[var][i]; }
+
+	/**
+	 * \brief Return the constraints linked to a variable \a var.
+	 *
+	 *  \pre 0 <= \a var < #nb_var().
+	 */
+	inline IndexSpan var_ctrs(int var) const { return var_adj[var]; }
 
 	/**
 	 * \brief Display the internal structure (matrix & tables).
@@ -103,9 +124,8 @@ private:
 
 	const int m;
 	const int n;
-	int **matrix;  // return the label (an integer) of the arc (m,n). Label=0 means "no arc".
-	int **ctr_adj; // ctr_adj[i][0]=number of linked variables to the ith constraint
-	int **var_adj; // var_adj[i][0]=number of linked constraints to the ith variable
+	Adjacency ctr_adj; // variables of each constraint, with the label of the arc
+	Adjacency var_adj; // constraints of each variable
 };
 
 } // namespace ibex
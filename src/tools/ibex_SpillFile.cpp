@@ -0,0 +1,137 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SpillFile.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_SpillFile.h"
+#include "ibex_Exception.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// size of the chunks for copying a block
+const long chunk_size = 1<<16;
+
+struct OffsetOrder {
+	OffsetOrder(const vector<long>& offsets) : offsets(offsets) { }
+	bool operator()(int b1, int b2) const { return offsets[b1]<offsets[b2]; }
+	const vector<long>& offsets;
+};
+
+}
+
+SpillFile::SpillFile() : file(NULL), used(0), end(0) {
+
+}
+
+SpillFile::~SpillFile() {
+	if (file) fclose(file);
+}
+
+int SpillFile::write(const string& bytes) {
+	if (!file) {
+		file=tmpfile();
+		if (!file) ibex_error("SpillFile: cannot create a temporary file");
+	}
+
+	if (fseek(file,end,SEEK_SET)!=0 || fwrite(bytes.data(),1,bytes.size(),file)!=bytes.size())
+		ibex_error("SpillFile: cannot write the temporary file");
+
+	Block block;
+	block.offset=end;
+	block.nb_bytes=bytes.size();
+	end+=block.nb_bytes;
+	used+=block.nb_bytes;
+
+	if (free_numbers.empty()) {
+		blocks.push_back(block);
+		return blocks.size()-1;
+	} else {
+		int b=free_numbers.back();
+		free_numbers.pop_back();
+		blocks[b]=block;
+		return b;
+	}
+}
+
+void SpillFile::read(int b, string& bytes) const {
+	const Block& block=blocks[b];
+	bytes.resize(block.nb_bytes);
+	if (block.nb_bytes==0) return;
+	if (fseek(file,block.offset,SEEK_SET)!=0 || fread(&bytes[0],1,block.nb_bytes,file)!=(size_t) block.nb_bytes)
+		ibex_error("SpillFile: cannot read the temporary file");
+}
+
+void SpillFile::copy(int b, ostream& os) const {
+	const Block& block=blocks[b];
+	string chunk;
+	for (long pos=0; pos<block.nb_bytes; pos+=chunk_size) {
+		long n=std::min(chunk_size,block.nb_bytes-pos);
+		chunk.resize(n);
+		if (fseek(file,block.offset+pos,SEEK_SET)!=0 || fread(&chunk[0],1,n,file)!=(size_t) n)
+			ibex_error("SpillFile: cannot read the temporary file");
+		os.write(chunk.data(),n);
+	}
+}
+
+void SpillFile::erase(int b) {
+	used-=blocks[b].nb_bytes;
+	blocks[b].nb_bytes=-1;
+	free_numbers.push_back(b);
+
+	if (free_numbers.size()==blocks.size()) {
+		// the file can be overwritten
+		clear();
+	} else if (used<end/2) {
+		compact();
+	}
+}
+
+void SpillFile::clear() {
+	blocks.clear();
+	free_numbers.clear();
+	used=0;
+	end=0;
+}
+
+void SpillFile::compact() {
+	vector<int> order;
+	vector<long> offsets(blocks.size());
+	for (unsigned int b=0; b<blocks.size(); b++) {
+		offsets[b]=blocks[b].offset;
+		if (blocks[b].nb_bytes>=0) order.push_back(b);
+	}
+	sort(order.begin(),order.end(),OffsetOrder(offsets));
+
+	// a block is always moved backward, so a forward copy
+	// never overwrites the bytes that remain to be copied.
+	string chunk;
+	long pos=0;
+	for (vector<int>::iterator it=order.begin(); it!=order.end(); it++) {
+		Block& block=blocks[*it];
+		if (block.offset!=pos) {
+			for (long i=0; i<block.nb_bytes; i+=chunk_size) {
+				long n=std::min(chunk_size,block.nb_bytes-i);
+				chunk.resize(n);
+				if (fseek(file,block.offset+i,SEEK_SET)!=0 || fread(&chunk[0],1,n,file)!=(size_t) n)
+					ibex_error("SpillFile: cannot read the temporary file");
+				if (fseek(file,pos+i,SEEK_SET)!=0 || fwrite(chunk.data(),1,n,file)!=(size_t) n)
+					ibex_error("SpillFile: cannot write the temporary file");
+			}
+			block.offset=pos;
+		}
+		pos+=block.nb_bytes;
+	}
+	end=pos;
+}
+
+} // end namespace ibex
@@ -0,0 +1,100 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SpillFile.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_SPILL_FILE_H__
+#define __IBEX_SPILL_FILE_H__
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdio>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Temporary file of blocks.
+ *
+ * Stores blocks of bytes on disk, for the buffers that cannot keep all
+ * their data in memory (see #ibex::CellFileBuffer). A block is written
+ * once, then read and erased. The space of the erased blocks is reused:
+ * the next blocks are written from the beginning of the file when it
+ * contains no block anymore, and the remaining blocks are moved to the
+ * beginning of the file when they fill less than half of it. The file
+ * itself is never shrunk.
+ *
+ * The file is created at the first write and deleted with the object.
+ */
+class SpillFile {
+public:
+
+	/** \brief Create an empty file. */
+	SpillFile();
+
+	/** \brief Delete the file. */
+	~SpillFile();
+
+	/** \brief Write a block and return its number. */
+	int write(const std::string& bytes);
+
+	/** \brief Read the block n°b. */
+	void read(int b, std::string& bytes) const;
+
+	/** \brief Copy the block n°b to \a os (without reading it all in memory). */
+	void copy(int b, std::ostream& os) const;
+
+	/** \brief Erase the block n°b. */
+	void erase(int b);
+
+	/** \brief Erase all the blocks. */
+	void clear();
+
+	/** \brief Size (in bytes) of the block n°b. */
+	long size(int b) const;
+
+	/** \brief Total size (in bytes) of the blocks. */
+	long size() const;
+
+	/** \brief Size (in bytes) of the part of the file in use (the file may be larger). */
+	long file_size() const;
+
+private:
+	/* A block (nb_bytes<0 if the number is free). */
+	struct Block {
+		long offset;
+		long nb_bytes;
+	};
+
+	/* Move the blocks to the beginning of the file. */
+	void compact();
+
+	std::FILE* file;
+
+	std::vector<Block> blocks;
+
+	/* Numbers of the erased blocks */
+	std::vector<int> free_numbers;
+
+	/* Total size of the blocks */
+	long used;
+
+	/* End of the data in the file */
+	long end;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline long SpillFile::size(int b) const { return blocks[b].nb_bytes; }
+
+inline long SpillFile::size() const      { return used; }
+
+inline long SpillFile::file_size() const { return end; }
+
+} // end namespace ibex
+#endif // __IBEX_SPILL_FILE_H__
@@ -0,0 +1,132 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ThreadPool.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_ThreadPool.h"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+struct ThreadPool::Data {
+	Data(int n) : task(NULL), n(0), generation(0), remaining(0), quit(false), errors(n) { }
+
+	vector<thread> threads;
+
+	mutex m;
+	condition_variable start;  // signaled when a new task is submitted (or on exit)
+	condition_variable done;   // signaled when the last subtask is done
+
+	Task* task;                // the current task
+	int n;                     // number of subtasks of the current task
+	long generation;           // number of tasks submitted so far
+	int remaining;             // number of subtasks of the current task not done yet
+	bool quit;
+
+	vector<exception_ptr> errors; // exception thrown by each subtask
+};
+
+namespace {
+
+void run_subtask(ThreadPool::Task& task, int i, exception_ptr& error) {
+	try {
+		task.run(i);
+	} catch (...) {
+		error=current_exception();
+	}
+}
+
+}
+
+ThreadPool::ThreadPool(int nb_threads) : nb_threads(nb_threads), data(new Data(nb_threads)) {
+	assert(nb_threads>0);
+	for (int i=1; i<nb_threads; i++)
+		data->threads.push_back(thread(loop, data, i));
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		lock_guard<mutex> lock(data->m);
+		data->quit=true;
+	}
+	data->start.notify_all();
+
+	for (vector<thread>::iterator it=data->threads.begin(); it!=data->threads.end(); it++)
+		it->join();
+
+	delete data;
+}
+
+void ThreadPool::run(Task& task, int n) {
+	assert(n>0 && n<=nb_threads);
+
+	if (n>1) {
+		{
+			lock_guard<mutex> lock(data->m);
+			data->task=&task;
+			data->n=n;
+			data->remaining=n-1;
+			data->generation++;
+		}
+		data->start.notify_all();
+	}
+
+	run_subtask(task, 0, data->errors[0]);
+
+	if (n>1) {
+		unique_lock<mutex> lock(data->m);
+		while (data->remaining>0) data->done.wait(lock);
+	}
+
+	for (int i=0; i<n; i++) {
+		if (data->errors[i]) {
+			exception_ptr e=data->errors[i];
+			for (int j=0; j<n; j++) data->errors[j]=exception_ptr();
+			rethrow_exception(e);
+		}
+	}
+}
+
+void ThreadPool::loop(Data* data, int me) {
+	long generation=0; // last task seen by this thread
+
+	while (true) {
+		Task* task;
+		{
+			unique_lock<mutex> lock(data->m);
+			while (!data->quit && data->generation==generation)
+				data->start.wait(lock);
+
+			if (data->quit) return;
+
+			generation=data->generation;
+
+			if (me>=data->n) continue; // not involved in this task
+
+			task=data->task;
+		}
+
+		run_subtask(*task, me, data->errors[me]);
+
+		bool last;
+		{
+			lock_guard<mutex> lock(data->m);
+			last=(--data->remaining==0);
+		}
+		if (last) data->done.notify_one();
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,77 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ThreadPool.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_THREAD_POOL_H__
+#define __IBEX_THREAD_POOL_H__
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Pool of threads.
+ *
+ * A fixed number of threads, created once and for all, that execute
+ * together the subtasks of a task. The subtask n°i is always executed by
+ * the thread n°i, so that each thread can work with its own data (e.g.,
+ * its own copy of a contractor). The thread n°0 is the calling thread.
+ */
+class ThreadPool {
+public:
+
+	/**
+	 * \brief A task (a set of subtasks executed in parallel).
+	 */
+	class Task {
+	public:
+		/** \brief Delete *this. */
+		virtual ~Task() { }
+
+		/** \brief Execute the subtask n°i. */
+		virtual void run(int i)=0;
+	};
+
+	/**
+	 * \brief Create a pool of \a nb_threads threads.
+	 *
+	 * Only nb_threads-1 threads are created (the thread n°0 is the
+	 * caller of #run(Task&, int)).
+	 */
+	ThreadPool(int nb_threads);
+
+	/**
+	 * \brief Delete *this (stops the threads).
+	 */
+	~ThreadPool();
+
+	/**
+	 * \brief Execute the \a n first subtasks of \a task.
+	 *
+	 * Return when all the subtasks are done. If a subtask throws an
+	 * exception, the first one (in the order of the subtasks) is thrown
+	 * again by this function.
+	 *
+	 * \pre 0 < \a n <= #nb_threads
+	 */
+	void run(Task& task, int n);
+
+	/** Number of threads. */
+	const int nb_threads;
+
+private:
+	ThreadPool(const ThreadPool&); // forbidden
+
+	struct Data;
+	Data* data;
+
+	/* Main loop of the thread n°me (me>0). */
+	static void loop(Data* data, int me);
+};
+
+} // end namespace ibex
+#endif // __IBEX_THREAD_POOL_H__
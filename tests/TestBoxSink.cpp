@@ -0,0 +1,276 @@
+//============================================================================
+//                                  I B E X
+// File        : TestBoxSink.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestBoxSink.h"
+#include "ibex_BoxSink.h"
+#include "ibex_Solver.h"
+#include "ibex_Paver.h"
+#include "ibex_CellStack.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcEmpty.h"
+#include "ibex_PdcDiameterLT.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_LargestFirst.h"
+
+#include <sstream>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// sink that stores the boxes
+class BoxVector : public BoxSink {
+public:
+	void add(const IntervalVector& box) { boxes.push_back(box); }
+	using BoxSink::add;
+	vector<IntervalVector> boxes;
+};
+
+double volume(const vector<IntervalVector>& boxes) {
+	double v=0;
+	for (unsigned int i=0; i<boxes.size(); i++)
+		v+=boxes[i].volume();
+	return v;
+}
+
+vector<IntervalVector> read_all(istream& is) {
+	BoxStreamReader reader(is);
+	vector<IntervalVector> boxes;
+	IntervalVector box(reader.n);
+	while (reader.next(box))
+		boxes.push_back(box);
+	return boxes;
+}
+
+}
+
+void TestBoxSink::stream01() {
+	double _b[][2]={{0,1},{2,3},{-1,POS_INFINITY}};
+	IntervalVector b1(3,_b);
+	IntervalVector b2(3,Interval(-1,1));
+
+	stringstream ss;
+	{
+		BoxStreamSink sink(ss,3,0);
+		sink.add(b1);
+		sink.add(b2);
+		sink.add(IntervalVector::empty(3));
+		CPPUNIT_ASSERT(sink.nb_received==2);
+		CPPUNIT_ASSERT(sink.nb_written==2);
+	}
+
+	vector<IntervalVector> boxes=read_all(ss);
+	CPPUNIT_ASSERT(boxes.size()==2);
+	CPPUNIT_ASSERT(boxes[0]==b1);
+	CPPUNIT_ASSERT(boxes[1]==b2);
+}
+
+// a grid of 4x4 boxes in random order is merged into a single box
+void TestBoxSink::merge01() {
+	vector<IntervalVector> grid;
+	for (int i=0; i<4; i++)
+		for (int j=0; j<4; j++) {
+			IntervalVector b(2);
+			b[0]=Interval(i,i+1);
+			b[1]=Interval(j,j+1);
+			grid.push_back(b);
+		}
+
+	srand(1);
+	for (int k=0; k<50; k++) {
+		int i=rand()%16, j=rand()%16;
+		IntervalVector tmp(grid[i]);
+		grid[i]=grid[j];
+		grid[j]=tmp;
+	}
+
+	stringstream ss;
+	BoxStreamSink sink(ss,2);
+	for (unsigned int i=0; i<grid.size(); i++)
+		sink.add(grid[i]);
+	sink.flush();
+
+	CPPUNIT_ASSERT(sink.nb_received==16);
+	CPPUNIT_ASSERT(sink.nb_written==1);
+
+	vector<IntervalVector> boxes=read_all(ss);
+	CPPUNIT_ASSERT(boxes.size()==1);
+	CPPUNIT_ASSERT(boxes[0]==IntervalVector(2,Interval(0,4)));
+}
+
+// a trace is passed as the difference of the boxes
+void TestBoxSink::diff01() {
+	IntervalVector before(2,Interval(0,4));
+	IntervalVector after(2,Interval(1,2));
+
+	BoxVector sink;
+	sink.add(before,after);
+	CPPUNIT_ASSERT(sink.boxes.size()==4);
+	CPPUNIT_ASSERT(fabs(volume(sink.boxes)-15)<1e-10);
+	for (unsigned int i=0; i<sink.boxes.size(); i++)
+		CPPUNIT_ASSERT((sink.boxes[i] & after).volume()==0);
+}
+
+void TestBoxSink::solver01() {
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	CtcHC4 hc4(*sys);
+	RoundRobin rr(1e-3);
+	CellStack buff;
+
+	Solver solver(hc4,rr,buff);
+	vector<IntervalVector> sols=solver.solve(init_box);
+
+	BoxVector sink;
+	solver.solve(init_box,sink);
+	CPPUNIT_ASSERT(sink.boxes.size()==sols.size());
+	for (unsigned int i=0; i<sols.size(); i++)
+		CPPUNIT_ASSERT(sink.boxes[i]==sols[i]);
+
+	stringstream ss;
+	BoxStreamSink ssink(ss,3);
+	solver.solve(init_box,ssink);
+	CPPUNIT_ASSERT(ssink.nb_received==sols.size());
+
+	// the solutions are either written or merged
+	vector<IntervalVector> boxes=read_all(ss);
+	CPPUNIT_ASSERT(boxes.size()==ssink.nb_written);
+	for (unsigned int i=0; i<sols.size(); i++) {
+		bool found=false;
+		for (unsigned int j=0; !found && j<boxes.size(); j++)
+			found=boxes[j].is_superset(sols[i]);
+		CPPUNIT_ASSERT(found);
+	}
+	delete sys;
+}
+
+// The paving of the disk x^2+y^2<=1.
+void TestBoxSink::paver01() {
+	Variable x,y;
+	NumConstraint c1(x,y,sqr(x)+sqr(y)<=1);
+	NumConstraint c2(x,y,sqr(x)+sqr(y)>1);
+	CtcFwdBwd out(c1);
+	CtcFwdBwd in(c2);
+	PdcDiameterLT prec(0.1);
+	CtcEmpty boundary(prec);
+	Array<Ctc> ctc(in,out,boundary);
+	LargestFirst lf(0.1);
+	CellStack stack;
+	Paver p(ctc,lf,stack);
+	p.trace=false;
+	p.timeout=10;
+	p.ctc_loop=false;
+
+	IntervalVector init_box(2,Interval(-2,2));
+
+	SubPaving* paving=p.pave(init_box);
+
+	stringstream ss[3];
+	BoxStreamSink sink0(ss[0],2), sink1(ss[1],2), sink2(ss[2],2);
+	p.pave(init_box,Array<BoxSink>(sink0,sink1,sink2));
+
+	double total=0;
+	for (int i=0; i<3; i++) {
+		// boxes removed by the ith contractor
+		BoxVector removed;
+		for (unsigned int j=0; j<paving[i].traces.size(); j++)
+			removed.add(paving[i].traces[j].first,paving[i].traces[j].second);
+
+		vector<IntervalVector> boxes=read_all(ss[i]);
+		CPPUNIT_ASSERT(boxes.size()<=removed.boxes.size());
+		CPPUNIT_ASSERT(fabs(volume(boxes)-volume(removed.boxes))<1e-10);
+		total+=volume(boxes);
+	}
+	CPPUNIT_ASSERT(fabs(total-16)<1e-10);
+
+	delete[] paving;
+}
+
+// The boxes removed by the precision contractor are
+// merged into the initial box.
+void TestBoxSink::paver02() {
+	PdcDiameterLT prec(0.1);
+	CtcEmpty boundary(prec);
+	Array<Ctc> ctc(boundary);
+	LargestFirst lf(0.1);
+	CellStack stack;
+	Paver p(ctc,lf,stack);
+	p.trace=false;
+	p.timeout=10;
+
+	IntervalVector init_box(2,Interval(-2,2));
+
+	stringstream ss;
+	BoxStreamSink sink(ss,2);
+	p.pave(init_box,Array<BoxSink>(sink));
+
+	CPPUNIT_ASSERT(sink.nb_received>1000);
+	CPPUNIT_ASSERT(sink.nb_written==1);
+	vector<IntervalVector> boxes=read_all(ss);
+	CPPUNIT_ASSERT(boxes.size()==1);
+	CPPUNIT_ASSERT(boxes[0]==init_box);
+}
+
+// The search is stopped (as if the process was killed) while solutions
+// are pending in the sink, and resumed from the last checkpoint.
+void TestBoxSink::checkpoint01() {
+	const char* filename="checkpoint_box_sink.tmp";
+
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	CtcHC4 hc4(*sys);
+	RoundRobin rr(1e-3);
+	CellStack buff;
+
+	Solver solver(hc4,rr,buff);
+	vector<IntervalVector> sols=solver.solve(init_box);
+
+	Solver solver2(hc4,rr,buff);
+	solver2.checkpoint_file=filename;
+	solver2.checkpoint_interval=0; // at each cell
+	stringstream ss;
+	BoxStreamSink ssink(ss,3,1000);
+	solver2.start(init_box);
+	while (ssink.nb_received<sols.size()/2 && solver2.next(ssink)) { }
+	CPPUNIT_ASSERT(ssink.nb_written>0);
+	// the content of the stream when the process is killed
+	vector<IntervalVector> boxes=read_all(ss);
+	buff.flush();
+
+	Solver solver3(hc4,rr,buff);
+	vector<IntervalVector> sols3;
+	solver3.restore(filename,sols3);
+	remove(filename);
+	stringstream ss3;
+	{
+		BoxStreamSink ssink3(ss3,3,1000);
+		while (solver3.next(ssink3)) { }
+	}
+	vector<IntervalVector> boxes3=read_all(ss3);
+	boxes.insert(boxes.end(),boxes3.begin(),boxes3.end());
+
+	for (unsigned int i=0; i<sols.size(); i++) {
+		bool found=false;
+		for (unsigned int j=0; !found && j<boxes.size(); j++)
+			found=boxes[j].is_superset(sols[i]);
+		CPPUNIT_ASSERT(found);
+	}
+	delete sys;
+}
+
+} // end namespace ibex
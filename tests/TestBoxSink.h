@@ -0,0 +1,45 @@
+//============================================================================
+//                                  I B E X
+// File        : TestBoxSink.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_BOX_SINK_H__
+#define __TEST_BOX_SINK_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestBoxSink : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestBoxSink);
+
+		CPPUNIT_TEST(stream01);
+		CPPUNIT_TEST(merge01);
+		CPPUNIT_TEST(diff01);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(paver01);
+		CPPUNIT_TEST(paver02);
+		CPPUNIT_TEST(checkpoint01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void stream01();
+	void merge01();
+	void diff01();
+	void solver01();
+	void paver01();
+	void paver02();
+	void checkpoint01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBoxSink);
+
+} // end namespace ibex
+#endif // __TEST_BOX_SINK_H__
@@ -0,0 +1,129 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCell.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestCell.h"
+#include "ibex_Cell.h"
+#include "ibex_Bsc.h"
+
+#include <set>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// depth of the cell in the search tree
+class Depth : public Backtrackable {
+public:
+	Depth() : depth(0) { }
+	Depth(int depth) : depth(depth) { }
+
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new Depth(depth+1),new Depth(depth+1));
+	}
+
+	int depth;
+};
+
+}
+
+void TestCell::data01() {
+	Cell c(IntervalVector(2,Interval(0,1)));
+	CPPUNIT_ASSERT(!c.has<Depth>());
+	CPPUNIT_ASSERT(!c.has<BisectedVar>());
+
+	c.add<Depth>();
+	CPPUNIT_ASSERT(c.has<Depth>());
+	CPPUNIT_ASSERT(!c.has<BisectedVar>());
+	CPPUNIT_ASSERT(c.get<Depth>().depth==0);
+
+	c.get<Depth>().depth=3;
+	c.add<Depth>(); // does nothing
+	CPPUNIT_ASSERT(c.get<Depth>().depth==3);
+
+	c.add<BisectedVar>();
+	CPPUNIT_ASSERT(c.has<BisectedVar>());
+	CPPUNIT_ASSERT(c.get<BisectedVar>().var==-1);
+	CPPUNIT_ASSERT(Cell::slot<Depth>()!=Cell::slot<BisectedVar>());
+}
+
+void TestCell::bisect01() {
+	Cell* root=new Cell(IntervalVector(2,Interval(0,1)));
+	root->add<Depth>();
+
+	IntervalVector left(2,Interval(0,1));
+	IntervalVector right(2,Interval(0,1));
+	left[0]=Interval(0,0.5);
+	right[0]=Interval(0.5,1);
+
+	pair<Cell*,Cell*> p=root->bisect(left,right);
+	CPPUNIT_ASSERT(p.first->box==left);
+	CPPUNIT_ASSERT(p.second->box==right);
+	CPPUNIT_ASSERT(p.first->get<Depth>().depth==1);
+	CPPUNIT_ASSERT(p.second->get<Depth>().depth==1);
+	CPPUNIT_ASSERT(!p.first->has<BisectedVar>());
+
+	pair<Cell*,Cell*> p2=p.first->bisect(left,right);
+	CPPUNIT_ASSERT(p2.first->get<Depth>().depth==2);
+
+	delete root;
+	delete p.first;
+	delete p.second;
+	delete p2.first;
+	delete p2.second;
+}
+
+void TestCell::bisect02() {
+	Cell* root=new Cell(IntervalVector(2,Interval(0,1)));
+	root->add<Depth>();
+
+	pair<IntervalVector,IntervalVector> boxes=root->box.bisect(1);
+	IntervalVector left(boxes.first);
+	IntervalVector right(boxes.second);
+	const Interval* lvec=&boxes.first[0];
+	const Interval* rvec=&boxes.second[0];
+
+	// the boxes are moved to the subcells
+	pair<Cell*,Cell*> p=root->bisect(std::move(boxes.first),std::move(boxes.second));
+	CPPUNIT_ASSERT(&p.first->box[0]==lvec);
+	CPPUNIT_ASSERT(&p.second->box[0]==rvec);
+	CPPUNIT_ASSERT(p.first->box==left);
+	CPPUNIT_ASSERT(p.second->box==right);
+	CPPUNIT_ASSERT(p.first->get<Depth>().depth==1);
+	CPPUNIT_ASSERT(p.second->get<Depth>().depth==1);
+
+	delete root;
+	delete p.first;
+	delete p.second;
+}
+
+void TestCell::pool01() {
+	IntervalVector box(3,Interval(0,1));
+
+	// the memory of deleted cells is reused
+	set<Cell*> cells;
+	for (int i=0; i<1000; i++) {
+		Cell* c=new Cell(box);
+		c->add<Depth>();
+		cells.insert(c);
+	}
+	for (set<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		delete *it;
+
+	for (int i=0; i<100; i++) {
+		Cell* c=new Cell(box);
+		CPPUNIT_ASSERT(cells.find(c)!=cells.end());
+		CPPUNIT_ASSERT(c->box==box);
+		CPPUNIT_ASSERT(!c->has<Depth>());
+		delete c;
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,39 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCell.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_CELL_H__
+#define __TEST_CELL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCell : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCell);
+
+		CPPUNIT_TEST(data01);
+		CPPUNIT_TEST(bisect01);
+		CPPUNIT_TEST(bisect02);
+		CPPUNIT_TEST(pool01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void data01();
+	void bisect01();
+	void bisect02();
+	void pool01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCell);
+
+} // end namespace ibex
+#endif // __TEST_CELL_H__
@@ -0,0 +1,213 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCellDeltaStack.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestCellDeltaStack.h"
+#include "ibex_CellDeltaStack.h"
+#include "ibex_CellStack.h"
+#include "ibex_Solver.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_RoundRobin.h"
+
+#include <cstdlib>
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+void TestCellDeltaStack::push_pop01() {
+	CellDeltaStack buff;
+	IntervalVector box(100,Interval(0,1));
+
+	buff.push(new Cell(box));
+	CPPUNIT_ASSERT(buff.size()==1);
+	CPPUNIT_ASSERT(buff.nb_components()==100); // root
+
+	Cell* c=buff.pop();
+	CPPUNIT_ASSERT(c->box==box);
+	CPPUNIT_ASSERT(buff.empty());
+
+	pair<IntervalVector,IntervalVector> boxes=box.bisect(7);
+	pair<Cell*,Cell*> cells=c->bisect(boxes.first,boxes.second);
+	delete c;
+
+	buff.push(cells.first);
+	buff.push(cells.second);
+	CPPUNIT_ASSERT(buff.size()==2);
+	CPPUNIT_ASSERT(buff.nb_components()==102); // root + one component for each child
+
+	CPPUNIT_ASSERT(buff.top()->box==boxes.second);
+	c=buff.pop();
+	CPPUNIT_ASSERT(c->box==boxes.second);
+	delete c;
+
+	c=buff.pop();
+	CPPUNIT_ASSERT(c->box==boxes.first);
+	delete c;
+
+	CPPUNIT_ASSERT(buff.empty());
+	CPPUNIT_ASSERT(buff.nb_components()==101); // the base (last cell popped)
+	buff.flush();
+	CPPUNIT_ASSERT(buff.nb_components()==0);
+}
+
+// the box is contracted between top() and pop()
+void TestCellDeltaStack::contract01() {
+	CellDeltaStack buff;
+	IntervalVector box(10,Interval(0,1));
+	buff.push(new Cell(box));
+
+	Cell* c=buff.top();
+	c->box[3]=Interval(0,0.5);
+	c->box[4]=Interval(0.5,1);
+	IntervalVector contracted(c->box);
+	c=buff.pop();
+
+	pair<IntervalVector,IntervalVector> boxes=c->box.bisect(0);
+	pair<Cell*,Cell*> cells=c->bisect(boxes.first,boxes.second);
+	delete c;
+
+	buff.push(cells.first);
+	buff.push(cells.second);
+	// the children only store the bisected variable
+	CPPUNIT_ASSERT(buff.nb_components()==10+2+2);
+
+	c=buff.pop();
+	CPPUNIT_ASSERT(c->box==boxes.second);
+	CPPUNIT_ASSERT(c->box[3]==contracted[3]);
+	delete c;
+	c=buff.pop();
+	CPPUNIT_ASSERT(c->box==boxes.first);
+	delete c;
+}
+
+// same behavior as CellStack with random contractions and bisections
+void TestCellDeltaStack::random01() {
+	srand(1);
+	CellStack stack;
+	CellDeltaStack dstack;
+	IntervalVector box(5,Interval(0,1));
+	stack.push(new Cell(box));
+	dstack.push(new Cell(box));
+
+	for (int k=0; k<1000 && !stack.empty(); k++) {
+		Cell* c=stack.top();
+		Cell* dc=dstack.top();
+		CPPUNIT_ASSERT(c->box==dc->box);
+
+		// contract
+		int i=rand()%5;
+		Interval x=c->box[i];
+		if (rand()%2) x=Interval(x.lb(),x.ub()-x.diam()/4);
+		c->box[i]=x;
+		dc->box[i]=x;
+
+		bool discard=(rand()%3==0) || stack.size()>20;
+
+		c=stack.pop();
+		dc=dstack.pop();
+		CPPUNIT_ASSERT(c->box==dc->box);
+
+		if (!discard) {
+			int j=rand()%5;
+			pair<IntervalVector,IntervalVector> boxes=c->box.bisect(j);
+			pair<Cell*,Cell*> cells=c->bisect(boxes.first,boxes.second);
+			pair<Cell*,Cell*> dcells=dc->bisect(boxes.first,boxes.second);
+			stack.push(cells.first);
+			stack.push(cells.second);
+			dstack.push(dcells.first);
+			dstack.push(dcells.second);
+		}
+		delete c;
+		delete dc;
+		CPPUNIT_ASSERT(stack.size()==dstack.size());
+	}
+	while (!stack.empty()) {
+		Cell* c=stack.pop();
+		Cell* dc=dstack.pop();
+		CPPUNIT_ASSERT(c->box==dc->box);
+		delete c;
+		delete dc;
+	}
+	dstack.flush();
+	CPPUNIT_ASSERT(dstack.nb_components()==0);
+}
+
+void TestCellDeltaStack::solver01() {
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	CtcHC4 hc4(*sys);
+	RoundRobin rr(1e-3);
+
+	CellStack buff;
+	Solver solver(hc4,rr,buff);
+	vector<IntervalVector> sols=solver.solve(init_box);
+
+	CellDeltaStack dbuff;
+	Solver dsolver(hc4,rr,dbuff);
+	vector<IntervalVector> dsols=dsolver.solve(init_box);
+
+	CPPUNIT_ASSERT(dsolver.nb_cells==solver.nb_cells);
+	CPPUNIT_ASSERT(dsols.size()==sols.size());
+	for (unsigned int i=0; i<sols.size(); i++)
+		CPPUNIT_ASSERT(dsols[i]==sols[i]);
+	delete sys;
+}
+
+// the deltas are written, not the boxes
+void TestCellDeltaStack::save01() {
+	CellStack stack;
+	CellDeltaStack dstack;
+	IntervalVector box(100,Interval(0,1));
+	stack.push(new Cell(box));
+	dstack.push(new Cell(box));
+
+	// depth-first search down to depth 10
+	for (int k=0; k<10; k++) {
+		Cell* c=stack.pop();
+		Cell* dc=dstack.pop();
+		pair<IntervalVector,IntervalVector> boxes=c->box.bisect(k);
+		pair<Cell*,Cell*> cells=c->bisect(boxes.first,boxes.second);
+		pair<Cell*,Cell*> dcells=dc->bisect(boxes.first,boxes.second);
+		stack.push(cells.first);
+		stack.push(cells.second);
+		dstack.push(dcells.first);
+		dstack.push(dcells.second);
+		delete c;
+		delete dc;
+	}
+	dstack.top(); // the box of the top cell is rebuilt
+	long nb_comp=dstack.nb_components();
+
+	stringstream ss;
+	dstack.save(ss);
+	CPPUNIT_ASSERT(dstack.nb_components()==nb_comp);
+	// less than one box per cell
+	CPPUNIT_ASSERT(ss.str().size()<5*100*sizeof(Interval));
+
+	Cell root(box);
+	CellDeltaStack dstack2;
+	dstack2.load(ss,root);
+	CPPUNIT_ASSERT(dstack2.size()==stack.size());
+
+	while (!stack.empty()) {
+		Cell* c=stack.pop();
+		Cell* dc=dstack.pop();
+		Cell* dc2=dstack2.pop();
+		CPPUNIT_ASSERT(dc->box==c->box);
+		CPPUNIT_ASSERT(dc2->box==c->box);
+		delete c;
+		delete dc;
+		delete dc2;
+	}
+	CPPUNIT_ASSERT(dstack2.empty());
+}
+
+} // end namespace ibex
@@ -0,0 +1,41 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCellDeltaStack.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_CELL_DELTA_STACK_H__
+#define __TEST_CELL_DELTA_STACK_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellDeltaStack : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCellDeltaStack);
+
+		CPPUNIT_TEST(push_pop01);
+		CPPUNIT_TEST(contract01);
+		CPPUNIT_TEST(random01);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(save01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void push_pop01();
+	void contract01();
+	void random01();
+	void solver01();
+	void save01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCellDeltaStack);
+
+} // end namespace ibex
+#endif // __TEST_CELL_DELTA_STACK_H__
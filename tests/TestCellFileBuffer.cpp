@@ -0,0 +1,233 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCellFileBuffer.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestCellFileBuffer.h"
+#include "ibex_CellFileBuffer.h"
+#include "ibex_CellStack.h"
+#include "ibex_Bsc.h"
+#include "ibex_Solver.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_RoundRobin.h"
+
+#include <cstdlib>
+#include <set>
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// data that cannot be serialized (counts the instances)
+class NoSerial : public Backtrackable {
+public:
+	NoSerial() : k(0) { count++; }
+	NoSerial(int k) : k(k) { count++; }
+	~NoSerial() { count--; }
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new NoSerial(k),new NoSerial(k));
+	}
+	int k;
+	static int count;
+};
+
+int NoSerial::count=0;
+
+// data that fails to be serialized after writing some bytes
+class PartialSerial : public Backtrackable {
+public:
+	PartialSerial() : k(0) { }
+	PartialSerial(int k) : k(k) { }
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new PartialSerial(k),new PartialSerial(k));
+	}
+	bool serialize(std::ostream& os) const {
+		double x[2] = { (double) k, (double) k };
+		os.write((const char*) x, sizeof(x));
+		return false;
+	}
+	int k;
+};
+
+// a stream buffer that cannot seek
+class StringBuf : public std::streambuf {
+public:
+	int overflow(int c) {
+		if (c!=EOF) str+=(char) c;
+		return c;
+	}
+	std::string str;
+};
+
+class LowerBound : public CostFunc<Cell> {
+public:
+	double cost(const Cell& c) const { return c.box[0].lb(); }
+};
+
+}
+
+void TestCellFileBuffer::fifo01() {
+	CellFileBuffer buff(8);
+	for (int i=0; i<100; i++) {
+		Cell* c=new Cell(IntervalVector(3,Interval(i,i+1)));
+		c->add<BisectedVar>();
+		c->get<BisectedVar>().var=i%3;
+		buff.push(c);
+	}
+	CPPUNIT_ASSERT(buff.size()==100);
+	CPPUNIT_ASSERT(buff.nb_cells_on_disk()>=92);
+
+	for (int i=0; i<100; i++) {
+		CPPUNIT_ASSERT(buff.top()->box==IntervalVector(3,Interval(i,i+1)));
+		Cell* c=buff.pop();
+		CPPUNIT_ASSERT(c->box==IntervalVector(3,Interval(i,i+1)));
+		CPPUNIT_ASSERT(c->get<BisectedVar>().var==i%3);
+		delete c;
+	}
+	CPPUNIT_ASSERT(buff.empty());
+}
+
+// push and pop randomly (with a cost function)
+void TestCellFileBuffer::cost01() {
+	srand(1);
+	LowerBound cost;
+	CellFileBuffer buff(10,&cost);
+	multiset<int> ref;
+
+	for (int k=0; k<2000; k++) {
+		if (ref.empty() || rand()%3!=0) {
+			int x=rand()%1000;
+			buff.push(new Cell(IntervalVector(2,Interval(x,x+1))));
+			ref.insert(x);
+		} else {
+			Cell* c=buff.pop();
+			CPPUNIT_ASSERT(c->box[0].lb()==*ref.begin());
+			ref.erase(ref.begin());
+			delete c;
+		}
+		CPPUNIT_ASSERT(buff.size()==ref.size());
+	}
+	buff.flush();
+	CPPUNIT_ASSERT(buff.empty());
+}
+
+void TestCellFileBuffer::data01() {
+	int count=NoSerial::count;
+	{
+		CellFileBuffer buff(2);
+		for (int i=0; i<10; i++) {
+			Cell* c=new Cell(IntervalVector(1,Interval(i)));
+			c->add<NoSerial>();
+			c->get<NoSerial>().k=i;
+			buff.push(c);
+		}
+		CPPUNIT_ASSERT(buff.nb_cells_on_disk()>0);
+		for (int i=0; i<5; i++) {
+			Cell* c=buff.pop();
+			CPPUNIT_ASSERT(c->get<NoSerial>().k==i);
+			delete c;
+		}
+	}
+	// the data of the cells remaining in the buffer has been deleted
+	CPPUNIT_ASSERT(NoSerial::count==count);
+}
+
+// the bytes written by the data before failing are not kept
+// (the stream cannot be rewound)
+void TestCellFileBuffer::data02() {
+	StringBuf buf;
+	ostream os(&buf);
+	vector<Backtrackable*> prototypes;
+	for (int i=0; i<2; i++) {
+		Cell c(IntervalVector(1,Interval(i)));
+		c.add<PartialSerial>();
+		c.get<PartialSerial>().k=i;
+		CPPUNIT_ASSERT(!c.serialize(os,prototypes));
+		CPPUNIT_ASSERT(!c.has<PartialSerial>());
+	}
+	CPPUNIT_ASSERT(os.good());
+
+	istringstream is(buf.str);
+	for (int i=0; i<2; i++) {
+		Cell* c=Cell::deserialize(is,prototypes);
+		CPPUNIT_ASSERT(c->box[0]==Interval(i));
+		CPPUNIT_ASSERT(c->get<PartialSerial>().k==i);
+		delete c;
+	}
+	for (vector<Backtrackable*>::iterator it=prototypes.begin(); it!=prototypes.end(); it++)
+		delete *it;
+}
+
+void TestCellFileBuffer::solver01() {
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	CtcHC4 hc4(*sys);
+	RoundRobin rr(1e-3);
+
+	CellStack buff;
+	Solver solver(hc4,rr,buff);
+	vector<IntervalVector> sols=solver.solve(init_box);
+
+	CellFileBuffer fbuff(16); // breadth-first search
+	Solver fsolver(hc4,rr,fbuff);
+	vector<IntervalVector> fsols=fsolver.solve(init_box);
+
+	CPPUNIT_ASSERT(fsolver.nb_cells==solver.nb_cells);
+	CPPUNIT_ASSERT(fsols.size()==sols.size());
+	// same solutions, in a different order
+	for (unsigned int i=0; i<fsols.size(); i++) {
+		bool found=false;
+		for (unsigned int j=0; !found && j<sols.size(); j++)
+			found=(fsols[i]==sols[j]);
+		CPPUNIT_ASSERT(found);
+	}
+	delete sys;
+}
+
+// the cells on disk are not read back by save()
+void TestCellFileBuffer::save01() {
+	LowerBound cost;
+	CellFileBuffer buff(8,&cost);
+	for (int i=0; i<100; i++) {
+		int x=(i*37)%100;
+		Cell* c=new Cell(IntervalVector(2,Interval(x,x+1)));
+		c->add<BisectedVar>();
+		c->get<BisectedVar>().var=x%2;
+		buff.push(c);
+	}
+	unsigned int on_disk=buff.nb_cells_on_disk();
+	CPPUNIT_ASSERT(on_disk>=92);
+
+	stringstream ss;
+	buff.save(ss);
+	CPPUNIT_ASSERT(buff.size()==100);
+	CPPUNIT_ASSERT(buff.nb_cells_on_disk()==on_disk);
+
+	Cell root(IntervalVector(2));
+	root.add<BisectedVar>();
+	CellFileBuffer buff2(8,&cost);
+	buff2.load(ss,root);
+	CPPUNIT_ASSERT(buff2.size()==100);
+	CPPUNIT_ASSERT(buff2.nb_cells_on_disk()>=92);
+
+	for (int x=0; x<100; x++) {
+		Cell* c=buff.pop();
+		Cell* c2=buff2.pop();
+		CPPUNIT_ASSERT(c->box==IntervalVector(2,Interval(x,x+1)));
+		CPPUNIT_ASSERT(c2->box==c->box);
+		CPPUNIT_ASSERT(c2->get<BisectedVar>().var==x%2);
+		delete c;
+		delete c2;
+	}
+	CPPUNIT_ASSERT(buff2.empty());
+}
+
+} // end namespace ibex
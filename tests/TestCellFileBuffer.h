@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCellFileBuffer.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_CELL_FILE_BUFFER_H__
+#define __TEST_CELL_FILE_BUFFER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellFileBuffer : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCellFileBuffer);
+
+		CPPUNIT_TEST(fifo01);
+		CPPUNIT_TEST(cost01);
+		CPPUNIT_TEST(data01);
+		CPPUNIT_TEST(data02);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(save01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void fifo01();
+	void cost01();
+	void data01();
+	void data02();
+	void solver01();
+	void save01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCellFileBuffer);
+
+} // end namespace ibex
+#endif // __TEST_CELL_FILE_BUFFER_H__
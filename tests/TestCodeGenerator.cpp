@@ -0,0 +1,169 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCodeGenerator.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestCodeGenerator.h"
+#include "ibex_Function.h"
+#include "ibex_CodeGenerator.h"
+
+#include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * The compiler: $CXX (c++ by default).
+ */
+string compiler() {
+	const char* cxx=getenv("CXX");
+	return cxx? cxx : "c++";
+}
+
+/*
+ * Write the code generated for f and compile it as a shared object.
+ * Return false if the code cannot be compiled (the errors of the
+ * compiler are displayed).
+ *
+ * The flags for the headers of ibex are $IBEX_CFLAGS (by default,
+ * given by pkg-config).
+ */
+bool compile(const Function& f, const string& so) {
+	string src=so+".cpp";
+	{
+		ofstream os(src.c_str());
+		CodeGenerator::generate(f,os);
+	}
+	const char* flags=getenv("IBEX_CFLAGS");
+	string cmd=compiler()+" -std=c++11 -O2 -frounding-math -shared -fPIC "
+			+(flags? flags : "$(pkg-config --cflags ibex 2>/dev/null)")+" "+src+" -o "+so+" >/dev/null";
+	bool ok=system(cmd.c_str())==0;
+	remove(src.c_str());
+	return ok;
+}
+
+/*
+ * Compare the generated kernels of f with the interpreted
+ * kernels (eval, backward and jacobian) on random boxes.
+ */
+void check_kernels(const char* x, const char* y) {
+	Function f(x,y);
+	Function g(x,y); // interpreted
+
+	if (system((compiler()+" --version >/dev/null 2>&1").c_str())!=0) {
+		cout << " (skip: no compiler)" << endl;
+		return;
+	}
+
+	stringstream name;
+	name << "/tmp/ibex_codegen_" << getpid() << ".so";
+	string so=name.str();
+
+	CPPUNIT_ASSERT(compile(f,so));
+	f.load_code(so.c_str());
+	remove(so.c_str());
+
+	int n=f.nb_var();
+	int m=f.image_dim();
+	srand(1);
+
+	for (int k=0; k<1000; k++) {
+		IntervalVector box(n);
+		for (int i=0; i<n; i++) {
+			double a=-2+4.0*rand()/RAND_MAX;
+			box[i]=Interval(a,a+2.0*rand()/RAND_MAX);
+		}
+
+		CPPUNIT_ASSERT(almost_eq(f.eval_vector(box),g.eval_vector(box),ERROR));
+
+		IntervalMatrix Jf(m,n), Jg(m,n);
+		f.jacobian(box,Jf);
+		g.jacobian(box,Jg);
+		CPPUNIT_ASSERT(almost_eq(Jf,Jg,ERROR));
+
+		IntervalVector img(m);
+		for (int i=0; i<m; i++) {
+			double a=-1+2.0*rand()/RAND_MAX;
+			img[i]=Interval(a,a+0.5*rand()/RAND_MAX);
+		}
+		IntervalVector xf(box), xg(box);
+		bool rf=m==1? f.backward(img[0],xf) : f.backward(img,xf);
+		bool rg=m==1? g.backward(img[0],xg) : g.backward(img,xg);
+		CPPUNIT_ASSERT(rf==rg);
+		CPPUNIT_ASSERT(almost_eq(xf,xg,ERROR));
+	}
+}
+
+}
+
+void TestCodeGenerator::supported01() {
+	Function f("x[3]","y","(x(1)*y+sin(x(2)), sqrt(x(3))-y^3)");
+	CPPUNIT_ASSERT(CodeGenerator(f).is_supported);
+}
+
+void TestCodeGenerator::supported02() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& y1 = ExprSymbol::new_("y1");
+	Function f1(x1,y1,x1*y1,"f1");
+
+	const ExprSymbol& x2 = ExprSymbol::new_("x2");
+	Function f2(x2,ExprApply::new_(f1,Array<const ExprNode>(x2,2*x2))+x2,"f2");
+	CPPUNIT_ASSERT(!CodeGenerator(f2).is_supported);
+
+	Function h("x[2][2]","y[2]","x*y");
+	CPPUNIT_ASSERT(!CodeGenerator(h).is_supported);
+}
+
+void TestCodeGenerator::kernels01() {
+	Function f("x","y","x*y+sin(x)");
+	stringstream s;
+	CodeGenerator::generate(f,s,"foo");
+	string code=s.str();
+
+	CPPUNIT_ASSERT(code.find("foo_signature")!=string::npos);
+	CPPUNIT_ASSERT(code.find("foo_eval")!=string::npos);
+	CPPUNIT_ASSERT(code.find("foo_proj")!=string::npos);
+	CPPUNIT_ASSERT(code.find("foo_jacobian")!=string::npos);
+}
+
+void TestCodeGenerator::kernels02() {
+	// the second row of the Jacobian matrix does
+	// not depend on x: its derivative is not written.
+	Function f("x","y","(x*y,y+1)");
+	stringstream s;
+	CodeGenerator::generate(f,s);
+	string code=s.str();
+
+	CPPUNIT_ASSERT(code.find("J[1][0]=0.0;")!=string::npos);
+	CPPUNIT_ASSERT(code.find("J[0][0]=0.0;")==string::npos);
+}
+
+void TestCodeGenerator::load01() {
+	Function f("x","y","x*y");
+	CPPUNIT_ASSERT_THROW(f.load_code("/nonexistent/f.so"), CodeLoadException);
+
+	// the function is still interpreted
+	IntervalVector box(2,Interval(1,2));
+	check(f.eval(box),Interval(1,4));
+}
+
+void TestCodeGenerator::compiled01() {
+	check_kernels("x[3]","x(1)*x(2)+sin(x(1))-exp(x(2))/(1+x(3)^2)+abs(x(1)-x(3))");
+}
+
+void TestCodeGenerator::compiled02() {
+	check_kernels("x[3]","(x(1)*x(2)-sqrt(x(3)), ln(x(1))+atan2(x(2),x(3)), max(x(1),x(2))-x(3)^3, cos(x(1))*x(3)+x(2)^2)");
+}
+
+} // end namespace ibex
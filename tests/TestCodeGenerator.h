@@ -0,0 +1,45 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCodeGenerator.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_CODE_GENERATOR_H__
+#define __TEST_CODE_GENERATOR_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCodeGenerator : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCodeGenerator);
+
+		CPPUNIT_TEST(supported01);
+		CPPUNIT_TEST(supported02);
+		CPPUNIT_TEST(kernels01);
+		CPPUNIT_TEST(kernels02);
+		CPPUNIT_TEST(load01);
+		CPPUNIT_TEST(compiled01);
+		CPPUNIT_TEST(compiled02);
+	CPPUNIT_TEST_SUITE_END();
+
+	void supported01();
+	void supported02();
+	void kernels01();
+	void kernels02();
+	void load01();
+	void compiled01();
+	void compiled02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCodeGenerator);
+
+} // end namespace ibex
+#endif // __TEST_CODE_GENERATOR_H__
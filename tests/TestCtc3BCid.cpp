@@ -0,0 +1,202 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtc3BCid.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestCtc3BCid.h"
+#include "ibex_Ctc3BCid.h"
+#include "ibex_CtcAcid.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_SystemFactory.h"
+
+#include <set>
+#include <mutex>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// the only real solution is (1,1,1)
+System* sys111() {
+	SystemFactory fac;
+	Variable x("x"),y("y"),z("z");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_var(z);
+	fac.add_ctr(x+y+z=3);
+	fac.add_ctr(x*y*z=1);
+	fac.add_ctr(sqr(x)+sqr(y)+sqr(z)=3);
+	return new System(fac);
+}
+
+// one copy of the system and one HC4 per thread
+class HC4Copies {
+public:
+	HC4Copies(const System& sys, int n) : sys(n), ctcs(n) {
+		for (int i=0; i<n; i++) {
+			this->sys[i]=new System(sys);
+			ctcs.set_ref(i,*new CtcHC4(*this->sys[i]));
+		}
+	}
+
+	~HC4Copies() {
+		for (int i=0; i<ctcs.size(); i++) {
+			delete &ctcs[i];
+			delete sys[i];
+		}
+	}
+
+	vector<System*> sys;
+	Array<Ctc> ctcs;
+};
+
+// a 3BCID that records the shaved variables
+class Recorder : public Ctc3BCid {
+public:
+	Recorder(Ctc& ctc, set<int>& vars, mutex& m) : Ctc3BCid(ctc), vars(vars), m(m) { }
+
+	Recorder(const Array<Ctc>& ctcs, set<int>& vars, mutex& m) : Ctc3BCid(ctcs), vars(vars), m(m) { }
+
+	bool var3BCID_dicho(IntervalVector& box, int var, double wv) {
+		record(var);
+		return Ctc3BCid::var3BCID_dicho(box,var,wv);
+	}
+
+	bool var3BCID_slices(IntervalVector& box, int var, int locs3b, double w_DC, Interval& dom) {
+		record(var);
+		return Ctc3BCid::var3BCID_slices(box,var,locs3b,w_DC,dom);
+	}
+
+	Ctc3BCid* shaver(Ctc& ctc) {
+		return new Recorder(ctc,vars,m);
+	}
+
+	void record(int var) {
+		lock_guard<mutex> lock(m);
+		vars.insert(var);
+	}
+
+	set<int>& vars;
+	mutex& m;
+};
+
+}
+
+void TestCtc3BCid::one_thread01() {
+	System* sys=sys111();
+	HC4Copies c(*sys,1);
+	CtcHC4 hc4(*sys);
+
+	Ctc3BCid seq(hc4);
+	Ctc3BCid par(c.ctcs);
+	CPPUNIT_ASSERT(par.nb_threads==1);
+
+	IntervalVector box1(3,Interval(-10,10));
+	IntervalVector box2(box1);
+	seq.contract(box1);
+	par.contract(box2);
+	CPPUNIT_ASSERT(box1==box2);
+
+	delete sys;
+}
+
+void TestCtc3BCid::parallel01() {
+	System* sys=sys111();
+	HC4Copies c(*sys,3);
+	CtcHC4 hc4(*sys);
+
+	Ctc3BCid seq(hc4);
+	Ctc3BCid par(c.ctcs);
+	CPPUNIT_ASSERT(par.nb_threads==3);
+
+	IntervalVector init_box(3,Interval(-10,10));
+	IntervalVector box(init_box);
+	par.contract(box);
+
+	// sound
+	CPPUNIT_ASSERT(box.contains(Vector(3,1.0)));
+
+	// stronger than the sub-contractor
+	IntervalVector hc4_box(init_box);
+	hc4.contract(hc4_box);
+	CPPUNIT_ASSERT(box.is_subset(hc4_box));
+	CPPUNIT_ASSERT(box!=hc4_box);
+
+	// deterministic
+	for (int k=0; k<10; k++) {
+		IntervalVector box2(init_box);
+		par.contract(box2);
+		CPPUNIT_ASSERT(box2==box);
+	}
+
+	delete sys;
+}
+
+void TestCtc3BCid::parallel02() {
+	System* sys=sys111();
+	HC4Copies c(*sys,8); // more threads than variables
+
+	Ctc3BCid par(c.ctcs, 20, 1, 10);
+	IntervalVector box(3,Interval(-10,10));
+	par.contract(box);
+
+	CPPUNIT_ASSERT(box.contains(Vector(3,1.0)));
+
+	// a box without solution
+	IntervalVector box2(3,Interval(1.5,10));
+	par.contract(box2);
+	CPPUNIT_ASSERT(box2.is_empty());
+
+	delete sys;
+}
+
+void TestCtc3BCid::subclass01() {
+	System* sys=sys111();
+	HC4Copies c(*sys,3);
+
+	set<int> vars;
+	mutex m;
+	Recorder par(c.ctcs,vars,m);
+
+	IntervalVector box(3,Interval(-10,10));
+	par.contract(box);
+	CPPUNIT_ASSERT(box.contains(Vector(3,1.0)));
+
+	// the three variables are shaved in the same round, by
+	// different threads, all with the shaving of the subclass
+	CPPUNIT_ASSERT(vars.size()==3);
+
+	delete sys;
+}
+
+void TestCtc3BCid::acid01() {
+	System* sys=sys111();
+	HC4Copies c(*sys,2);
+
+	IntervalVector init_box(3,Interval(-10,10));
+	IntervalVector box1(init_box);
+	IntervalVector box2(init_box);
+
+	// two identical contractors give the same result
+	CtcAcid acid1(*sys, c.ctcs);
+	CtcAcid acid2(*sys, c.ctcs);
+
+	for (int k=0; k<60; k++) { // includes the end of the first tuning phase
+		box1=init_box;
+		box2=init_box;
+		acid1.contract(box1);
+		acid2.contract(box2);
+		CPPUNIT_ASSERT(box1==box2);
+		CPPUNIT_ASSERT(box1.contains(Vector(3,1.0)));
+	}
+
+	delete sys;
+}
+
+} // end namespace ibex
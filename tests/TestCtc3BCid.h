@@ -0,0 +1,41 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtc3BCid.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_3B_CID_H__
+#define __TEST_CTC_3B_CID_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtc3BCid : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtc3BCid);
+
+		CPPUNIT_TEST(one_thread01);
+		CPPUNIT_TEST(parallel01);
+		CPPUNIT_TEST(parallel02);
+		CPPUNIT_TEST(subclass01);
+		CPPUNIT_TEST(acid01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void one_thread01();
+	void parallel01();
+	void parallel02();
+	void subclass01();
+	void acid01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtc3BCid);
+
+} // end namespace ibex
+#endif // __TEST_CTC_3B_CID_H__
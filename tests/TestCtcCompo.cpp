@@ -0,0 +1,116 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcCompo.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestCtcCompo.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcIdentity.h"
+#include "ibex_CtcProfiler.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// halves the domain of the first variable once activated
+class CtcHalf : public Ctc {
+public:
+	CtcHalf(int n) : Ctc(n), active(false) { }
+
+	void contract(IntervalVector& box) {
+		if (active) box[0]=Interval(box[0].lb(),box[0].mid());
+	}
+
+	bool active;
+};
+
+// a composition where each call to a sub-contractor takes one
+// unit of time (so that the adaptive mode is deterministic)
+class UnitTimeCompo : public CtcCompo {
+public:
+	UnitTimeCompo(Ctc& c1, Ctc& c2) : CtcCompo(c1,c2), t(0) { }
+
+	double time() {
+		return t++; // called before and after each call
+	}
+
+	double t;
+};
+
+}
+
+void TestCtcCompo::compo01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)-1);
+	Function g(x,y,x-y);
+	CtcFwdBwd c1(f);
+	CtcFwdBwd c2(g);
+	CtcCompo compo(c1,c2);
+
+	IntervalVector box(2);
+	box[0]=Interval(-10,10);
+	box[1]=Interval(0,10);
+	compo.contract(box);
+	CPPUNIT_ASSERT(almost_eq(box,IntervalVector(2,Interval(0,1)),1e-10));
+}
+
+void TestCtcCompo::adaptive01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)-1);
+	CtcFwdBwd c(f);
+	CtcIdentity id(2);
+	CtcProfiler p(id,"id");
+	UnitTimeCompo compo(c,p);
+	compo.adaptive=true;
+
+	const int N=1000;
+	for (int k=0; k<N; k++) {
+		IntervalVector box(2,Interval(-10,10));
+		compo.contract(box);
+		CPPUNIT_ASSERT(almost_eq(box,IntervalVector(2,Interval(-1,1)),1e-10));
+	}
+
+	// the identity is called with periods 1,2,4,...,64
+	CPPUNIT_ASSERT(p.nb_calls>=N/(compo.max_period+1));
+	CPPUNIT_ASSERT(p.nb_calls<=N/(compo.max_period+1)+2*compo.max_period);
+}
+
+void TestCtcCompo::adaptive02() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)-1);
+	CtcFwdBwd c(f);
+	CtcHalf half(2);
+	CtcProfiler p(half,"half");
+	UnitTimeCompo compo(c,p);
+	compo.adaptive=true;
+
+	const int N=1000;
+	for (int k=0; k<N; k++) {
+		IntervalVector box(2,Interval(-10,10));
+		compo.contract(box);
+	}
+	CPPUNIT_ASSERT(p.nb_calls<N/10);
+
+	// the contractor becomes useful: it is called again after
+	// at most max_period calls, and then always.
+	half.active=true;
+	p.reset();
+	for (int k=0; k<N; k++) {
+		IntervalVector box(2,Interval(-10,10));
+		compo.contract(box);
+	}
+	CPPUNIT_ASSERT(p.nb_calls>=N-compo.max_period);
+
+	IntervalVector box(2,Interval(-10,10));
+	compo.contract(box);
+	CPPUNIT_ASSERT(almost_eq(box[0],Interval(-1,0),1e-10));
+}
+
+} // end namespace ibex
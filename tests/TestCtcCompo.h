@@ -0,0 +1,37 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcCompo.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_COMPO_H__
+#define __TEST_CTC_COMPO_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcCompo : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcCompo);
+
+		CPPUNIT_TEST(compo01);
+		CPPUNIT_TEST(adaptive01);
+		CPPUNIT_TEST(adaptive02);
+	CPPUNIT_TEST_SUITE_END();
+
+	void compo01();
+	void adaptive01();
+	void adaptive02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcCompo);
+
+} // end namespace ibex
+#endif // __TEST_CTC_COMPO_H__
@@ -55,4 +55,30 @@ void TestCtcHC4::ponts30() {
 	}
 }
 
+// with a small ratio, the FIFO and the weighted agendas reach the same fixpoint
+void TestCtcHC4::weighted01() {
+	Ponts30 p30;
+
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++)
+		ctr[i]=new NumConstraint(dynamic_cast<Function&>((*p30.f)[i]),EQ);
+
+	Array<NumConstraint> a(ctr,30);
+	CtcHC4 hc4(a,1e-10);
+	CtcHC4 whc4(a,1e-10,false,true);
+
+	IntervalVector box=p30.init_box;
+	hc4.contract(box);
+
+	// the weights are learned along several calls
+	for (int k=0; k<3; k++) {
+		IntervalVector wbox=p30.init_box;
+		whc4.contract(wbox);
+		CPPUNIT_ASSERT(almost_eq(wbox, box, 1e-08));
+	}
+
+	for (int i=0; i<30; i++)
+		delete ctr[i];
+}
+
 } // end namespace ibex
@@ -23,9 +23,11 @@ public:
 	CPPUNIT_TEST_SUITE(TestCtcHC4);
 	
 		CPPUNIT_TEST(ponts30);
+		CPPUNIT_TEST(weighted01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void ponts30();
+	void weighted01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcHC4);
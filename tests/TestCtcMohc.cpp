@@ -0,0 +1,117 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcMohc.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestCtcMohc.h"
+#include "ibex_CtcMohc.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestCtcMohc::occurrences01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)-x-y);
+	CtcMohcRevise c(f);
+	CPPUNIT_ASSERT(c.nb_occ[0]==2);
+	CPPUNIT_ASSERT(c.nb_occ[1]==1);
+
+	Variable v(3);
+	Function g(v,v[0]*v[1]+v[0]);
+	CtcMohcRevise c2(g);
+	CPPUNIT_ASSERT(c2.nb_occ[0]==2);
+	CPPUNIT_ASSERT(c2.nb_occ[1]==1);
+	CPPUNIT_ASSERT(c2.nb_occ[2]==0);
+}
+
+// x^2-x is increasing on [1,2] but HC4Revise overestimates it
+void TestCtcMohc::revise01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)-x-y);
+	CtcMohcRevise mohc(f);
+	CtcFwdBwd hc4r(f);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(1.5,10);
+	IntervalVector box2(box);
+
+	mohc.contract(box);
+	hc4r.contract(box2);
+
+	// x >= (1+sqrt(7))/2 = 1.8228...
+	double x_min=(1+::sqrt(7.0))/2;
+	CPPUNIT_ASSERT(box.is_subset(box2));
+	CPPUNIT_ASSERT(box[0].lb()<=x_min);
+	CPPUNIT_ASSERT(box[0].lb()>=x_min-mohc.eps*(2-1.58));
+	CPPUNIT_ASSERT(box2[0].lb()<1.6);
+	// y only occurs once and is contracted by HC4Revise: sqr([1,2])-[1,2]=[-1,3]
+	CPPUNIT_ASSERT(almost_eq(box[1],Interval(1.5,3),1e-10));
+}
+
+// inequality (only one side can be shaved)
+void TestCtcMohc::revise02() {
+	Variable x,y;
+	Function f(x,y,sqr(x)-x-y);
+	CtcMohcRevise mohc(f,LEQ);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(0,0.5);
+	mohc.contract(box);
+
+	// x^2-x <= 0.5 <=> x <= (1+sqrt(3))/2 = 1.366...
+	double x_max=(1+::sqrt(3.0))/2;
+	CPPUNIT_ASSERT(box[0].lb()==1);
+	CPPUNIT_ASSERT(box[0].ub()>=x_max);
+	CPPUNIT_ASSERT(box[0].ub()<=x_max+mohc.eps);
+}
+
+// no monotonicity across a pole
+void TestCtcMohc::pole01() {
+	Variable x,y;
+	Function f(x,y,1/x+1/x-y);
+	CtcMohcRevise mohc(f);
+
+	IntervalVector box(2);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(2,3);
+	mohc.contract(box);
+
+	// 2/x in [2,3] for x in [2/3,1]
+	CPPUNIT_ASSERT(box[0].is_superset(Interval(2.0/3,1)));
+}
+
+void TestCtcMohc::propag01() {
+	SystemFactory fac;
+	Variable x("x"),y("y");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)-x-y=0);
+	fac.add_ctr(x+y<=4);
+	System sys(fac);
+
+	CtcMohc mohc(sys);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(1.5,10);
+
+	mohc.contract(box);
+
+	// the solution set is {(x,x^2-x), x in [(1+sqrt(7))/2,2]}
+	double x_min=(1+::sqrt(7.0))/2;
+	CPPUNIT_ASSERT(box[0].lb()<=x_min);
+	CPPUNIT_ASSERT(box[0].lb()>1.8);
+	CPPUNIT_ASSERT(box[0].ub()==2);
+	CPPUNIT_ASSERT(box[1].is_superset(Interval(1.5,2)));
+	CPPUNIT_ASSERT(box[1].ub()<2.2);
+}
+
+} // end namespace ibex
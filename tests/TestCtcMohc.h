@@ -0,0 +1,41 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcMohc.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_MOHC_H__
+#define __TEST_CTC_MOHC_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcMohc : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcMohc);
+
+		CPPUNIT_TEST(occurrences01);
+		CPPUNIT_TEST(revise01);
+		CPPUNIT_TEST(revise02);
+		CPPUNIT_TEST(pole01);
+		CPPUNIT_TEST(propag01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void occurrences01();
+	void revise01();
+	void revise02();
+	void pole01();
+	void propag01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcMohc);
+
+} // end namespace ibex
+#endif // __TEST_CTC_MOHC_H__
@@ -0,0 +1,119 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcProfiler.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestCtcProfiler.h"
+#include "ibex_CtcProfiler.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcNewton.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+#include "ibex_Solver.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+void TestCtcProfiler::contract01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)-1);
+	CtcFwdBwd c(f);
+	CtcProfiler p(c,"circle");
+
+	IntervalVector box(2,Interval(-10,10));
+	p.contract(box);
+
+	CPPUNIT_ASSERT(almost_eq(box,IntervalVector(2,Interval(-1,1)),1e-10));
+	CPPUNIT_ASSERT(p.nb_calls==1);
+	CPPUNIT_ASSERT(p.nb_empty==0);
+	CPPUNIT_ASSERT(almost_eq(p.log_volume_reduction,2*::log(10.0),1e-10));
+	CPPUNIT_ASSERT(p.real_time>=0 && p.cpu_time>=0);
+
+	p.contract(box);
+	CPPUNIT_ASSERT(p.nb_calls==2);
+	CPPUNIT_ASSERT(almost_eq(p.log_volume_reduction,2*::log(10.0),1e-10));
+
+	p.reset();
+	CPPUNIT_ASSERT(p.nb_calls==0);
+	CPPUNIT_ASSERT(p.log_volume_reduction==0);
+}
+
+void TestCtcProfiler::empty01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)-1);
+	CtcFwdBwd c(f);
+	CtcProfiler p1(c,"circle");
+	CtcCompo compo(p1,c);
+	CtcProfiler p2(compo,"compo");
+
+	IntervalVector box(2,Interval(2,3));
+	BitSet flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS));
+	((Ctc&) p2).contract(box,BitSet::all(2),flags);
+
+	CPPUNIT_ASSERT(box.is_empty());
+	CPPUNIT_ASSERT(p1.nb_calls==1);
+	CPPUNIT_ASSERT(p1.nb_empty==1);
+	CPPUNIT_ASSERT(p2.nb_calls==1);
+	CPPUNIT_ASSERT(p2.nb_empty==1);
+	// the flags of the composition are recorded and forwarded
+	CPPUNIT_ASSERT(p2.nb_fixpoint==1);
+	CPPUNIT_ASSERT(flags[Ctc::FIXPOINT]);
+}
+
+void TestCtcProfiler::solver01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	CtcFwdBwd c(f);
+	CtcNewton newton(f);
+	CtcProfiler p1(c,"fwdbwd"), p2(newton,"newton");
+	CtcCompo compo(p1,p2);
+	RoundRobin rr(1e-3);
+	CellStack buff;
+	Solver s(compo,rr,buff);
+	s.profilers.push_back(&p1);
+	s.profilers.push_back(&p2);
+
+	vector<IntervalVector> sols=s.solve(IntervalVector(2,Interval(-10,10)));
+	CPPUNIT_ASSERT(!sols.empty());
+	// one contraction per cell (the root cell included)
+	CPPUNIT_ASSERT(p1.nb_calls==s.nb_cells+1);
+	CPPUNIT_ASSERT(p2.nb_calls+p1.nb_empty==p1.nb_calls);
+
+	long nb_calls=p1.nb_calls;
+	s.solve(IntervalVector(2,Interval(-10,10)));
+	CPPUNIT_ASSERT(p1.nb_calls==nb_calls); // reset by the solver
+
+	stringstream ss;
+	s.report_profile(ss);
+	CPPUNIT_ASSERT(ss.str().find("fwdbwd")!=string::npos);
+	CPPUNIT_ASSERT(ss.str().find("newton")!=string::npos);
+}
+
+void TestCtcProfiler::json01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)-1);
+	CtcFwdBwd c(f);
+	CtcProfiler p1(c,"a\"b"), p2(c,"c");
+	IntervalVector box(2,Interval(-10,10));
+	p1.contract(box);
+
+	vector<CtcProfiler*> v;
+	v.push_back(&p1);
+	v.push_back(&p2);
+	stringstream ss;
+	CtcProfiler::print_json(ss,v);
+	string s=ss.str();
+	CPPUNIT_ASSERT(s[0]=='[');
+	CPPUNIT_ASSERT(s.find("{\"name\": \"a\\\"b\", \"calls\": 1,")!=string::npos);
+	CPPUNIT_ASSERT(s.find("{\"name\": \"c\", \"calls\": 0,")!=string::npos);
+}
+
+} // end namespace ibex
@@ -0,0 +1,39 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcProfiler.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_PROFILER_H__
+#define __TEST_CTC_PROFILER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcProfiler : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcProfiler);
+
+		CPPUNIT_TEST(contract01);
+		CPPUNIT_TEST(empty01);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(json01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void contract01();
+	void empty01();
+	void solver01();
+	void json01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcProfiler);
+
+} // end namespace ibex
+#endif // __TEST_CTC_PROFILER_H__
@@ -212,4 +212,77 @@ void TestEval::apply04() {
 	CPPUNIT_ASSERT((f3.eval_domain(_x3).i()).is_superset(Interval(10,10)));
 }
 
+// box outside the definition domain of an applied function
+void TestEval::apply05() {
+
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& x2 = ExprSymbol::new_("x2");
+
+	Function f1(x1,sqrt(x1));
+	Function f2(x2,f1(x2)+Interval(1,1));
+
+	IntervalVector _x2(1,Interval(-2,-1));
+	CPPUNIT_ASSERT(f2.eval(_x2).is_empty());
+
+	// the evaluator can be reused after an empty domain
+	_x2[0]=Interval(4,4);
+	check(f2.eval(_x2), Interval(3,3));
+}
+
+// scalar function, several blocks, empty boxes and images
+void TestEval::batch01() {
+
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+
+	Function f(x,y,sqrt(x)*y+sin(x-y)-log(y+2.0)+pow(x,3));
+
+	int n=150;
+	vector<IntervalVector> boxes;
+	for (int k=0; k<n; k++) {
+		IntervalVector box(2);
+		box[0]=Interval(k/10.0-3,k/10.0-2);
+		box[1]=Interval(-(k%7),k%5);
+		if (k==40) box.set_empty();
+		boxes.push_back(box);
+	}
+
+	vector<IntervalVector> images(n,IntervalVector(1));
+
+	f.eval_batch(&boxes[0],&images[0],n);
+
+	for (int k=0; k<n; k++) {
+		IntervalVector expected=f.eval_vector(boxes[k]);
+		if (expected.is_empty())
+			CPPUNIT_ASSERT(images[k].is_empty());
+		else
+			CPPUNIT_ASSERT(images[k]==expected);
+	}
+}
+
+// vector-valued function with a vector argument
+void TestEval::batch02() {
+
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+
+	Function f(x,y,Return(x[0]*x[1]-y,x[2]+exp(x[0]),-x[1]));
+
+	int n=70;
+	vector<IntervalVector> boxes;
+	for (int k=0; k<n; k++) {
+		IntervalVector box(4);
+		for (int i=0; i<4; i++)
+			box[i]=Interval(-(k%(i+2)),k%(i+3)+1);
+		boxes.push_back(box);
+	}
+
+	vector<IntervalVector> images(n,IntervalVector(3));
+
+	f.eval_batch(&boxes[0],&images[0],n);
+
+	for (int k=0; k<n; k++)
+		CPPUNIT_ASSERT(images[k]==f.eval_vector(boxes[k]));
+}
+
 }
@@ -35,6 +35,10 @@ public:
 		CPPUNIT_TEST(apply02);
 		CPPUNIT_TEST(apply03);
 		CPPUNIT_TEST(apply04);
+		CPPUNIT_TEST(apply05);
+
+		CPPUNIT_TEST(batch01);
+		CPPUNIT_TEST(batch02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void deco01();
@@ -46,6 +50,10 @@ public:
 	void apply02();
 	void apply03();
 	void apply04();
+	void apply05();
+
+	void batch01();
+	void batch02();
 
 private:
 	void check_deco(Function& f, const ExprNode& e);
@@ -0,0 +1,157 @@
+//============================================================================
+//                                  I B E X
+// File        : TestEvalContext.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestEvalContext.h"
+#include "ibex_Function.h"
+#include "ibex_EvalContext.h"
+
+#include <thread>
+
+using namespace std;
+
+namespace ibex {
+
+void TestEvalContext::eval01() {
+	Function f("x","y","x*y+sin(x)");
+	EvalContext ctx(f);
+
+	IntervalVector box1(2,Interval(1,2));
+	IntervalVector box2(2,Interval(-1,0));
+
+	Interval y1=f.eval(box1,ctx);
+	// the default context must not interfere with ctx
+	Interval y2=f.eval(box2);
+
+	CPPUNIT_ASSERT(y1==f.eval(box1));
+	CPPUNIT_ASSERT(ctx.eval.d.top->i()==y1);
+	CPPUNIT_ASSERT(f.basic_evaluator().d.top->i()==y1);
+	CPPUNIT_ASSERT(y2==f.eval(box2,ctx));
+}
+
+void TestEvalContext::gradient01() {
+	Function f("x","y","x*y+sin(x)");
+	EvalContext ctx(f);
+
+	IntervalVector box(2,Interval(1,2));
+	IntervalVector g1(2);
+	IntervalVector g2(2);
+
+	f.gradient(box,g1,ctx);
+	f.gradient(box,g2);
+	CPPUNIT_ASSERT(g1==g2);
+}
+
+void TestEvalContext::backward01() {
+	Function f("x","y","x+y");
+	EvalContext ctx(f);
+
+	double _box[][2] = {{0,10},{0,10}};
+	IntervalVector box1(2,_box);
+	IntervalVector box2(box1);
+
+	f.backward(Interval(0,1),box1,ctx);
+	f.backward(Interval(0,1),box2);
+	CPPUNIT_ASSERT(box1==box2);
+	check(box1,IntervalVector(2,Interval(0,1)));
+
+	// outside the image
+	f.backward(Interval(-2,-1),box1,ctx);
+	CPPUNIT_ASSERT(box1.is_empty());
+}
+
+void TestEvalContext::apply01() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& y1 = ExprSymbol::new_("y1");
+	Function f1(x1,y1,x1*y1,"f1");
+
+	const ExprSymbol& x2 = ExprSymbol::new_("x2");
+	Function f2(x2,ExprApply::new_(f1,Array<const ExprNode>(x2,2*x2))+x2,"f2");
+
+	EvalContext ctx(f2);
+
+	IntervalVector box(1,Interval(2,3));
+	// evaluate the applied function with its default context
+	// in between (must not interfere)
+	check(f2.eval(box,ctx),Interval(10,21));
+	check(f1.eval(IntervalVector(2,Interval(0,1))),Interval(0,1));
+	check(ctx.eval.d.top->i(),Interval(10,21));
+
+	IntervalVector g(1);
+	f2.gradient(box,g,ctx);
+	check(g[0],Interval(9,13));
+
+	f2.backward(Interval(0,12),box,ctx);
+	CPPUNIT_ASSERT(!box.is_empty());
+	CPPUNIT_ASSERT(box[0].ub()<3);
+}
+
+namespace {
+
+// evaluate and contract many boxes with a given context
+void run(const Function* f, EvalContext* ctx, const vector<IntervalVector>* boxes, vector<Interval>* y, vector<IntervalVector>* x) {
+	for (unsigned int i=0; i<boxes->size(); i++) {
+		(*y)[i]=f->eval((*boxes)[i],*ctx);
+		(*x)[i]=(*boxes)[i];
+		f->backward(Interval(-1,1),(*x)[i],*ctx);
+	}
+}
+
+}
+
+void TestEvalContext::threads01() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x");
+	const ExprSymbol& x2 = ExprSymbol::new_("y");
+	const ExprSymbol& x3 = ExprSymbol::new_("z");
+	Function f(x1,x2,x3,x1*exp(x2)-sin(x2*x3)+sqr(x3-x1));
+
+	int n=500;
+	int nb_threads=4;
+
+	vector<IntervalVector> boxes;
+	for (int i=0; i<n; i++) {
+		IntervalVector box(3);
+		box[0]=Interval(-1+0.01*i, 0.01*i);
+		box[1]=Interval(-0.003*i, 1-0.003*i);
+		box[2]=Interval(0.5-0.001*i, 0.5+0.002*i);
+		boxes.push_back(box);
+	}
+
+	// sequential reference (default context)
+	vector<Interval> y(n);
+	vector<IntervalVector> x(n,IntervalVector(3));
+	for (int i=0; i<n; i++) {
+		y[i]=f.eval(boxes[i]);
+		x[i]=boxes[i];
+		f.backward(Interval(-1,1),x[i]);
+	}
+
+	vector<EvalContext*> ctx(nb_threads);
+	vector<vector<Interval> > ty(nb_threads, vector<Interval>(n));
+	vector<vector<IntervalVector> > tx(nb_threads, vector<IntervalVector>(n,IntervalVector(3)));
+	vector<thread> threads;
+
+	for (int t=0; t<nb_threads; t++) {
+		ctx[t]=new EvalContext(f);
+		threads.push_back(thread(run, &f, ctx[t], &boxes, &ty[t], &tx[t]));
+	}
+
+	for (int t=0; t<nb_threads; t++) {
+		threads[t].join();
+		delete ctx[t];
+	}
+
+	for (int t=0; t<nb_threads; t++) {
+		for (int i=0; i<n; i++) {
+			CPPUNIT_ASSERT(ty[t][i]==y[i]);
+			CPPUNIT_ASSERT(tx[t][i]==x[i]);
+		}
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,41 @@
+//============================================================================
+//                                  I B E X
+// File        : TestEvalContext.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_EVAL_CONTEXT_H__
+#define __TEST_EVAL_CONTEXT_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestEvalContext : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestEvalContext);
+
+		CPPUNIT_TEST(eval01);
+		CPPUNIT_TEST(gradient01);
+		CPPUNIT_TEST(backward01);
+		CPPUNIT_TEST(apply01);
+		CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void eval01();
+	void gradient01();
+	void backward01();
+	void apply01();
+	void threads01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestEvalContext);
+
+} // end namespace ibex
+#endif // __TEST_EVAL_CONTEXT_H__
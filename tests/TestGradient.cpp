@@ -12,6 +12,7 @@
 #include "ibex_Function.h"
 #include "ibex_Expr.h"
 #include "ibex_Eval.h"
+#include "ibex_VarSet.h"
 #include "Ponts30.h"
 
 using namespace std;
@@ -469,6 +470,41 @@ void TestGradient::jac03() {
 	CPPUNIT_ASSERT(J.is_empty());
 }
 
+void TestGradient::jac04() {
+	// the Jacobian must coincide with the gradients of the
+	// components, even with shared subexpressions and vector arguments.
+	Variable x(2),y;
+	const ExprNode& e=x[0]*y;
+	Function f(x,y,Return(e+sin(x[1]),sqr(e)-x[0],exp(x[1]*y)));
+
+	double _box[][2]={{1,2},{-1,1},{0.5,1.5}};
+	IntervalVector box(3,_box);
+
+	IntervalMatrix J=f.jacobian(box);
+	for (int i=0; i<3; i++) {
+		IntervalVector g=f[i].gradient(box);
+		CPPUNIT_ASSERT(almost_eq(J[i],g,1e-10));
+	}
+}
+
+void TestGradient::jac05() {
+	Variable x,y,z;
+	Function f(x,y,z,Return(x*y+z,sqr(x)-y*z,y));
+	VarSet set(f,x,z);
+
+	double _box[][2]={{1,2},{3,4},{-1,1}};
+	IntervalVector box(3,_box);
+
+	IntervalMatrix J=f.jacobian(box);
+	IntervalMatrix Jxz(3,2);
+	f.jacobian(box,Jxz,set);
+
+	for (int i=0; i<3; i++) {
+		check(Jxz[i][0],J[i][0]);
+		check(Jxz[i][1],J[i][2]);
+	}
+}
+
 void TestGradient::hansen01() {
 	IntervalMatrix H(30,30);
 	Ponts30 p30;
@@ -588,5 +624,46 @@ void TestGradient::hansen01() {
 
 }
 
+void TestGradient::hansen02() {
+	// compare with the non-incremental calculation
+	Variable x(2),y,z;
+	const ExprNode& e=x[0]*y;
+	Function f(x,y,z,Return(e+sin(x[1]),sqr(e)-z,exp(x[1]*z)+y));
+
+	double _box[][2]={{1,2},{-1,1},{0.5,1.5},{-2,3}};
+	IntervalVector box(4,_box);
+
+	IntervalMatrix H(3,4);
+	f.hansen_matrix(box,H);
+
+	IntervalVector x2=box.mid();
+	for (int j=0; j<4; j++) {
+		x2[j]=box[j];
+		IntervalMatrix J=f.jacobian(x2);
+		for (int i=0; i<3; i++)
+			check(H[i][j],J[i][j]);
+	}
+}
+
+void TestGradient::hansen03() {
+	Variable x,y,z;
+	Function f(x,y,z,Return(x*y+z,sqr(x)-y*z,y));
+	VarSet set(f,x,z);
+
+	double _box[][2]={{1,2},{3,4},{-1,1}};
+	IntervalVector box(3,_box);
+
+	IntervalMatrix H(3,2);
+	f.hansen_matrix(box,H,set);
+
+	IntervalVector x2=box;
+	x2[2]=box[2].mid();
+	IntervalMatrix J=f.jacobian(x2);
+	for (int i=0; i<3; i++) check(H[i][0],J[i][0]);
+
+	J=f.jacobian(box);
+	for (int i=0; i<3; i++) check(H[i][1],J[i][2]);
+}
+
 } // end namespace
 
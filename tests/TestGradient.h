@@ -37,7 +37,11 @@ public:
 		CPPUNIT_TEST(jac01);
 		CPPUNIT_TEST(jac02);
 		CPPUNIT_TEST(jac03);
+		CPPUNIT_TEST(jac04);
+		CPPUNIT_TEST(jac05);
 		CPPUNIT_TEST(hansen01);
+		CPPUNIT_TEST(hansen02);
+		CPPUNIT_TEST(hansen03);
 		CPPUNIT_TEST(mulVV);
 		CPPUNIT_TEST(transpose01);
 		CPPUNIT_TEST(mulMV01);
@@ -56,7 +60,11 @@ public:
 	void jac01();
 	void jac02();
 	void jac03();
+	void jac04();
+	void jac05();
 	void hansen01();
+	void hansen02();
+	void hansen03();
 
 	void mulVV();
 	// for vectors
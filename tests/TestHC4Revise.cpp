@@ -14,6 +14,7 @@
 #include "ibex_Expr.h"
 #include "ibex_NumConstraint.h"
 #include "ibex_HC4Revise.h"
+#include "ibex_EvalContext.h"
 
 using namespace std;
 
@@ -131,5 +132,168 @@ void TestHC4Revise::dist02() {
 	check(box, boxR);
 }
 
-} // end namespace
+// box outside the definition domain or constraint refuted
+void TestHC4Revise::empty01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	Function f(x,sqrt(x)+log(x));
+
+	Domain zero(Dim::scalar());
+	zero.i()=Interval(0,0);
+
+	IntervalVector box(1,Interval(-2,-1));
+	CPPUNIT_ASSERT(!f.backward(zero,box));
+	CPPUNIT_ASSERT(box.is_empty());
+
+	zero.i()=Interval(-10,-5);
+	box[0]=Interval(1,2);
+	CPPUNIT_ASSERT(!f.backward(zero,box));
+	CPPUNIT_ASSERT(box.is_empty());
+
+	// the same function can be used again
+	zero.i()=Interval(0,10);
+	box[0]=Interval(1,2);
+	CPPUNIT_ASSERT(f.backward(zero,box));
+	check(box[0],Interval(1,2));
+}
+
+// constraint refuted inside an applied function
+void TestHC4Revise::apply01() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& x2 = ExprSymbol::new_("x2");
+
+	Function f1(x1,x1-x1);
+	Function f2(x2,f1(x2));
+
+	Domain y(Dim::scalar());
+	y.i()=Interval(0.7,1);
+
+	IntervalVector box(1,Interval(0,1));
+	CPPUNIT_ASSERT(!f2.backward(y,box));
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+// same contraction as backward() box by box
+void TestHC4Revise::batch01() {
+
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+
+	// note: x[0]*x[0] and sqr(y+x[1]) test multiple occurrences
+	Function f(x,y,x[0]*x[0]+sqr(y+x[1])-sqrt(y)+min(x[1],y));
+
+	Domain d(Dim::scalar());
+	d.i()=Interval(0,1);
+
+	int n=100;
+	vector<IntervalVector> boxes;
+	for (int k=0; k<n; k++) {
+		IntervalVector box(3);
+		box[0]=Interval(-(k%3)-0.5,k%4);
+		box[1]=Interval(-(k%5),k%2+0.25);
+		box[2]=Interval(k%6-3,k%6-3+(k%7)*0.5);
+		if (k==10) box.set_empty();
+		boxes.push_back(box);
+	}
+
+	vector<IntervalVector> expected(boxes);
+
+	f.backward_batch(d,&boxes[0],n);
+
+	for (int k=0; k<n; k++) {
+		f.backward(d,expected[k]);
+		if (expected[k].is_empty())
+			CPPUNIT_ASSERT(boxes[k].is_empty());
+		else
+			CPPUNIT_ASSERT(boxes[k]==expected[k]);
+	}
+}
+
+// function not handled in batch (matrix operator)
+void TestHC4Revise::batch02() {
+
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+
+	IntervalMatrix M(2,2,Interval(1,2));
+	Function f(x,ExprConstant::new_matrix(M)*x);
+
+	IntervalVector y(2,Interval(-1,1));
+	Domain d(y,false);
+
+	vector<IntervalVector> boxes;
+	for (int k=0; k<5; k++)
+		boxes.push_back(IntervalVector(2,Interval(-k,k+0.5)));
+	vector<IntervalVector> expected(boxes);
 
+	f.backward_batch(d,&boxes[0],5);
+
+	for (int k=0; k<5; k++) {
+		f.backward(d,expected[k]);
+		CPPUNIT_ASSERT(boxes[k]==expected[k]);
+	}
+}
+
+// boxes that differ on one variable at a time
+void TestHC4Revise::incr01() {
+
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& z = ExprSymbol::new_("z");
+
+	Function f(x,y,z,x[0]*x[0]+sqr(y+x[1])-sqrt(y)+min(x[1],y)+exp(z));
+
+	Domain d(Dim::scalar());
+	d.i()=Interval(0,5);
+
+	IntervalVector box(4,Interval(0,2));
+
+	for (int k=0; k<50; k++) {
+		// the context is also used by f.backward (in between)
+		IntervalVector expected(box);
+		bool inner=f.backward(d,expected);
+
+		IntervalVector result(box);
+		CPPUNIT_ASSERT(f.hc4revise().proj_incremental(d,result)==inner);
+
+		if (expected.is_empty())
+			CPPUNIT_ASSERT(result.is_empty());
+		else
+			CPPUNIT_ASSERT(result==expected);
+
+		box[k%4]=Interval(-(k%3)-0.5,k%4+0.5);
+	}
+}
+
+// vector-valued function with an applied function and
+// boxes outside the definition domain
+void TestHC4Revise::incr02() {
+
+	const ExprSymbol& a = ExprSymbol::new_("a");
+	Function g(a,log(a)+1);
+
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	Function f(x,Return(g(x[0])-x[1],x[1]*x[2],x[2]));
+
+	IntervalVector y(3,Interval(-1,1));
+	Domain d(y,false);
+
+	EvalContext ctx(f);
+
+	for (int k=0; k<30; k++) {
+		IntervalVector box(3);
+		box[0]=Interval(k%5-1,k%5+1);
+		box[1]=Interval(-k%2-1,k%3);
+		box[2]=Interval(k%4-2,2);
+
+		IntervalVector expected(box);
+		bool inner=f.backward(d,expected);
+
+		CPPUNIT_ASSERT(ctx.hc4revise.proj_incremental(d,box)==inner);
+
+		if (expected.is_empty())
+			CPPUNIT_ASSERT(box.is_empty());
+		else
+			CPPUNIT_ASSERT(box==expected);
+	}
+}
+
+} // end namespace
@@ -33,6 +33,12 @@ public:
 		CPPUNIT_TEST(min01);
 		CPPUNIT_TEST(dist01);
 		CPPUNIT_TEST(dist02);
+		CPPUNIT_TEST(empty01);
+		CPPUNIT_TEST(apply01);
+		CPPUNIT_TEST(batch01);
+		CPPUNIT_TEST(batch02);
+		CPPUNIT_TEST(incr01);
+		CPPUNIT_TEST(incr02);
 	CPPUNIT_TEST_SUITE_END();
 	void id01();
 	void add01();
@@ -45,6 +51,15 @@ public:
 
 	void dist01();
 	void dist02();
+
+	void empty01();
+	void apply01();
+
+	void batch01();
+	void batch02();
+
+	void incr01();
+	void incr02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestHC4Revise);
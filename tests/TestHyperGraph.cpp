@@ -0,0 +1,87 @@
+/* ============================================================================
+ * I B E X - HyperGraph Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestHyperGraph.h"
+#include "ibex_HyperGraph.h"
+#include "ibex_DirectedHyperGraph.h"
+
+using namespace std;
+
+void TestHyperGraph::graph01() {
+	HyperGraph g(2,4);
+	g.add_arc(0,3,1);
+	g.add_arc(0,1,2);
+	g.add_arc(1,1,3);
+	g.add_arc(0,3,4); // already present
+
+	CPPUNIT_ASSERT(g.ctr_nb_vars(0)==2);
+	CPPUNIT_ASSERT(g.ctr_ith_var(0,0)==1);
+	CPPUNIT_ASSERT(g.ctr_ith_var(0,1)==3);
+	CPPUNIT_ASSERT(g.ctr_nb_vars(1)==1);
+	CPPUNIT_ASSERT(g.ctr_ith_var(1,0)==1);
+
+	CPPUNIT_ASSERT(g.var_nb_ctrs(0)==0);
+	CPPUNIT_ASSERT(g.var_nb_ctrs(1)==2);
+	CPPUNIT_ASSERT(g.var_ith_ctr(1,0)==0);
+	CPPUNIT_ASSERT(g.var_ith_ctr(1,1)==1);
+	CPPUNIT_ASSERT(g.var_nb_ctrs(3)==1);
+
+	CPPUNIT_ASSERT(g.arc(0,3)==1);
+	CPPUNIT_ASSERT(g.arc(0,1)==2);
+	CPPUNIT_ASSERT(g.arc(1,1)==3);
+	CPPUNIT_ASSERT(g.arc(1,3)==0);
+	CPPUNIT_ASSERT(g.arc(0,0)==0);
+}
+
+// arcs added after the graph has been accessed, copy
+void TestHyperGraph::graph02() {
+	HyperGraph g(2,3);
+	g.add_arc(1,2,1);
+	CPPUNIT_ASSERT(g.ctr_nb_vars(1)==1);
+
+	g.add_arc(1,0,2);
+	g.add_arc(1,2,3); // already present
+
+	HyperGraph g2(g);
+	IndexSpan vars=g2.ctr_vars(1);
+	CPPUNIT_ASSERT(vars.size()==2);
+	CPPUNIT_ASSERT(vars[0]==0);
+	CPPUNIT_ASSERT(vars[1]==2);
+	CPPUNIT_ASSERT(g2.arc(1,2)==1);
+	CPPUNIT_ASSERT(g2.var_ctrs(2).size()==1);
+	CPPUNIT_ASSERT(g2.ctr_vars(0).empty());
+}
+
+void TestHyperGraph::directed01() {
+	DirectedHyperGraph g(3,3);
+	g.add_arc(0,2,true);
+	g.add_arc(0,0,true);
+	g.add_arc(0,1,false);
+	g.add_arc(2,1,true);
+	g.add_arc(2,1,true); // already present
+	g.add_arc(2,1,false);
+
+	IndexSpan in=g.input_vars(0);
+	CPPUNIT_ASSERT(in.size()==2);
+	CPPUNIT_ASSERT(in[0]==0);
+	CPPUNIT_ASSERT(in[1]==2);
+	CPPUNIT_ASSERT(g.output_vars(0).size()==1);
+	CPPUNIT_ASSERT(*g.output_vars(0).begin()==1);
+	CPPUNIT_ASSERT(g.input_vars(1).empty());
+
+	IndexSpan out=g.output_ctrs(1);
+	CPPUNIT_ASSERT(out.size()==1);
+	CPPUNIT_ASSERT(out[0]==2);
+	IndexSpan in2=g.input_ctrs(1);
+	CPPUNIT_ASSERT(in2.size()==2);
+	CPPUNIT_ASSERT(in2[0]==0);
+	CPPUNIT_ASSERT(in2[1]==2);
+	CPPUNIT_ASSERT(g.output_ctrs(0).size()==1);
+}
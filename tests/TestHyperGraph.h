@@ -0,0 +1,37 @@
+/* ============================================================================
+ * I B E X - HyperGraph Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_HYPER_GRAPH_H__
+#define __TEST_HYPER_GRAPH_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestHyperGraph : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestHyperGraph);
+		CPPUNIT_TEST(graph01);
+		CPPUNIT_TEST(graph02);
+		CPPUNIT_TEST(directed01);
+	CPPUNIT_TEST_SUITE_END();
+
+private:
+	void graph01();
+	void graph02();
+	void directed01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestHyperGraph);
+
+#endif // __TEST_HYPER_GRAPH_H__
@@ -0,0 +1,180 @@
+//============================================================================
+//                                  I B E X
+// File        : TestJacobianCache.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestJacobianCache.h"
+#include "ibex_JacobianCache.h"
+#include "ibex_Cell.h"
+#include "ibex_CtcNewton.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_SmearFunction.h"
+#include "ibex_Solver.h"
+#include "ibex_CellStack.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// true if x intersects one of the boxes
+bool intersects(const IntervalVector& x, const vector<IntervalVector>& boxes) {
+	for (vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); it++)
+		if (x.intersects(*it)) return true;
+	return false;
+}
+
+}
+
+void TestJacobianCache::find01() {
+	Variable x,y;
+	Function f(x,y,Return(x*y,x+y));
+	Function g(x,y,Return(x*y,x-y));
+
+	IntervalVector box(2,Interval(0,1));
+	IntervalMatrix J(2,2);
+	f.jacobian(box,J);
+
+	JacobianCache cache;
+	CPPUNIT_ASSERT(!cache.find(f,box,0.1));
+
+	cache.store(f,box,J);
+	CPPUNIT_ASSERT(cache.find(f,box,0.1));
+	CPPUNIT_ASSERT(*cache.find(f,box,0.1)==J);
+	CPPUNIT_ASSERT(!cache.find(g,box,0.1));
+	CPPUNIT_ASSERT(!cache.find(f,box,-1));
+
+	// a box slightly smaller
+	IntervalVector box2(2,Interval(0,0.95));
+	CPPUNIT_ASSERT(cache.find(f,box2,0.1));
+
+	// a box too small
+	IntervalVector box3(2,Interval(0,0.5));
+	CPPUNIT_ASSERT(!cache.find(f,box3,0.1));
+
+	// a box not included
+	IntervalVector box4(2,Interval(0,1.01));
+	CPPUNIT_ASSERT(!cache.find(f,box4,0.1));
+
+	// Hansen matrices are only given on demand
+	cache.store(f,box,J,JacobianCache::HANSEN);
+	CPPUNIT_ASSERT(!cache.find(f,box,0.1));
+	CPPUNIT_ASSERT(cache.find(f,box,0.1,true));
+
+	cache.clear();
+	CPPUNIT_ASSERT(!cache.find(f,box,0.1,true));
+}
+
+void TestJacobianCache::down01() {
+	Variable x,y;
+	Function f(x,y,Return(x*y,x+y));
+
+	Cell* root=new Cell(IntervalVector(2,Interval(0,1)));
+	root->add<JacobianCache>();
+	IntervalMatrix J(2,2);
+	f.jacobian(root->box,J);
+	root->get<JacobianCache>().store(f,root->box,J);
+
+	pair<IntervalVector,IntervalVector> boxes=root->box.bisect(0);
+	pair<Cell*,Cell*> p=root->bisect(boxes.first,boxes.second);
+	CPPUNIT_ASSERT(p.first->has<JacobianCache>());
+	CPPUNIT_ASSERT(!p.first->get<JacobianCache>().find(f,p.first->box,1));
+	CPPUNIT_ASSERT(!p.second->get<JacobianCache>().find(f,p.second->box,1));
+
+	delete root;
+	delete p.first;
+	delete p.second;
+}
+
+void TestJacobianCache::newton01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)-y,x-y));
+
+	IntervalVector box(2,Interval(0.9,1.1));
+	Cell cell(box);
+	cell.add<JacobianCache>();
+
+	CtcNewton newton(f,1);
+	Ctc& ctc=newton;
+	ctc.contract(cell);
+	CPPUNIT_ASSERT(cell.box.is_strict_subset(box));
+
+	// the box has been contracted since the last Hansen matrix
+	IntervalMatrix* H=cell.get<JacobianCache>().find(f,cell.box,1,true);
+	CPPUNIT_ASSERT(H);
+	CPPUNIT_ASSERT(H->nb_rows()==2 && H->nb_cols()==2);
+	CPPUNIT_ASSERT(!cell.get<JacobianCache>().find(f,cell.box,1));
+
+	// no cache, nothing stored
+	Cell cell2(box);
+	ctc.contract(cell2);
+	CPPUNIT_ASSERT(cell2.box==cell.box);
+	CPPUNIT_ASSERT(!cell2.has<JacobianCache>());
+}
+
+void TestJacobianCache::smear01() {
+	SystemFactory fac;
+	Variable x("x"),y("y");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y=0);
+	System sys(fac);
+
+	SmearMax smear(sys,1e-3);
+	Cell cell(IntervalVector(2,Interval(0,1)));
+	smear.add_backtrackable(cell);
+	CPPUNIT_ASSERT(cell.has<JacobianCache>());
+
+	// the derivatives of the cell make y the variable with maximal impact
+	IntervalMatrix J(1,2);
+	J[0][0]=Interval(1);
+	J[0][1]=Interval(5);
+	cell.get<JacobianCache>().store(sys.f,cell.box,J,JacobianCache::HANSEN);
+
+	pair<IntervalVector,IntervalVector> boxes=smear.bisect(cell);
+	CPPUNIT_ASSERT(boxes.first[0]==Interval(0,1));
+	CPPUNIT_ASSERT(boxes.first[1]!=Interval(0,1));
+
+	// the Jacobian matrix (1 1) is computed: x is bisected
+	smear.reuse_ratio=-1;
+	cell.get<BisectedVar>().var=-1;
+	boxes=smear.bisect(cell);
+	CPPUNIT_ASSERT(boxes.first[0]!=Interval(0,1));
+	CPPUNIT_ASSERT(boxes.first[1]==Interval(0,1));
+}
+
+void TestJacobianCache::solver01() {
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	CtcHC4 hc4(*sys);
+	CtcNewton newton(sys->f);
+	CtcCompo ctc(hc4,newton);
+
+	SmearSumRelative smear(*sys,1e-3);
+	CellStack buff;
+	Solver solver(ctc,smear,buff);
+	vector<IntervalVector> sols=solver.solve(init_box);
+
+	SmearSumRelative smear2(*sys,1e-3);
+	smear2.reuse_ratio=-1;
+	CellStack buff2;
+	Solver solver2(ctc,smear2,buff2);
+	vector<IntervalVector> sols2=solver2.solve(init_box);
+
+	CPPUNIT_ASSERT(!sols.empty());
+	CPPUNIT_ASSERT(sols.size()==sols2.size());
+	for (vector<IntervalVector>::iterator it=sols.begin(); it!=sols.end(); it++)
+		CPPUNIT_ASSERT(intersects(*it,sols2));
+
+	delete sys;
+}
+
+} // end namespace ibex
@@ -0,0 +1,46 @@
+//============================================================================
+//                                  I B E X
+// File        : TestJacobianCache.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_JACOBIAN_CACHE_H__
+#define __TEST_JACOBIAN_CACHE_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestJacobianCache : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestJacobianCache);
+
+		CPPUNIT_TEST(find01);
+		CPPUNIT_TEST(down01);
+		CPPUNIT_TEST(newton01);
+		CPPUNIT_TEST(smear01);
+		CPPUNIT_TEST(solver01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// when derivatives are found
+	void find01();
+	// subcells start with an empty cache
+	void down01();
+	// Newton stores the Hansen matrix
+	void newton01();
+	// the smear function uses the derivatives of the cell
+	void smear01();
+	// same solutions with and without reuse
+	void solver01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestJacobianCache);
+
+} // end namespace ibex
+#endif // __TEST_JACOBIAN_CACHE_H__
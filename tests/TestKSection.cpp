@@ -0,0 +1,179 @@
+//============================================================================
+//                                  I B E X
+// File        : TestKSection.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestKSection.h"
+#include "ibex_KSection.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_Solver.h"
+#include "ibex_CellStack.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcNewton.h"
+#include "ibex_CtcCompo.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+void delete_cells(vector<Cell*>& cells) {
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		delete *it;
+}
+
+// true if x intersects one of the boxes
+bool intersects(const IntervalVector& x, const vector<IntervalVector>& boxes) {
+	for (vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); it++)
+		if (x.intersects(*it)) return true;
+	return false;
+}
+
+}
+
+void TestKSection::split01() {
+	RoundRobin rr(1e-3);
+	Cell root(IntervalVector(2,Interval(0,1)));
+	rr.add_backtrackable(root);
+
+	vector<Cell*> cells=rr.split(root);
+	CPPUNIT_ASSERT(cells.size()==2);
+	CPPUNIT_ASSERT(cells[0]->box[0].lb()==0);
+	CPPUNIT_ASSERT(cells[0]->box[0].ub()==cells[1]->box[0].lb());
+	CPPUNIT_ASSERT(cells[1]->box[0].ub()==1);
+	for (int j=0; j<2; j++) {
+		CPPUNIT_ASSERT(cells[j]->box[1]==Interval(0,1));
+		CPPUNIT_ASSERT(cells[j]->get<BisectedVar>().var==0);
+	}
+	delete_cells(cells);
+}
+
+void TestKSection::ksection01() {
+	RoundRobin rr(1e-3);
+	KSection ks(rr,4);
+	IntervalVector box(2);
+	box[0]=Interval(0,4);
+	box[1]=Interval(0,1);
+	Cell root(box);
+	ks.add_backtrackable(root);
+
+	vector<Cell*> cells=ks.split(root);
+	CPPUNIT_ASSERT(cells.size()==4);
+	for (int j=0; j<4; j++) {
+		CPPUNIT_ASSERT(cells[j]->box[0]==Interval(j,j+1));
+		CPPUNIT_ASSERT(cells[j]->box[1]==Interval(0,1));
+		CPPUNIT_ASSERT(cells[j]->get<BisectedVar>().var==0);
+	}
+
+	// round-robin: the next variable is split
+	vector<Cell*> cells2=ks.split(*cells[0]);
+	CPPUNIT_ASSERT(cells2.size()==4);
+	for (int j=0; j<4; j++) {
+		CPPUNIT_ASSERT(cells2[j]->box[0]==Interval(0,1));
+		CPPUNIT_ASSERT(cells2[j]->box[1]==Interval(j*0.25,(j+1)*0.25));
+		CPPUNIT_ASSERT(cells2[j]->get<BisectedVar>().var==1);
+	}
+
+	delete_cells(cells);
+	delete_cells(cells2);
+}
+
+void TestKSection::ksection02() {
+	RoundRobin rr(0.3);
+	KSection ks(rr,5);
+	Cell root(IntervalVector(1,Interval(0,1)));
+	ks.add_backtrackable(root);
+
+	// 1/5 and 1/4 are less than the precision
+	vector<Cell*> cells=ks.split(root);
+	CPPUNIT_ASSERT(cells.size()==3);
+	CPPUNIT_ASSERT(cells[0]->box[0].lb()==0);
+	CPPUNIT_ASSERT(cells[2]->box[0].ub()==1);
+	for (int j=0; j<3; j++) {
+		CPPUNIT_ASSERT(cells[j]->box[0].diam()>=0.3);
+		if (j>0) CPPUNIT_ASSERT(cells[j]->box[0].lb()==cells[j-1]->box[0].ub());
+	}
+	delete_cells(cells);
+}
+
+void TestKSection::multi01() {
+	RoundRobin rr(1e-3);
+	MultiSection ms(rr,2);
+	Cell root(IntervalVector(3,Interval(0,1)));
+	ms.add_backtrackable(root);
+
+	vector<Cell*> cells=ms.split(root);
+	CPPUNIT_ASSERT(cells.size()==4);
+	double vol=0;
+	for (int j=0; j<4; j++) {
+		CPPUNIT_ASSERT(cells[j]->box[0]!=Interval(0,1));
+		CPPUNIT_ASSERT(cells[j]->box[1]!=Interval(0,1));
+		CPPUNIT_ASSERT(cells[j]->box[2]==Interval(0,1));
+		CPPUNIT_ASSERT(cells[j]->get<BisectedVar>().var==1);
+		vol+=cells[j]->box.volume();
+	}
+	CPPUNIT_ASSERT(fabs(vol-1)<1e-12);
+	delete_cells(cells);
+
+	// two variables in 3 slices each
+	KSection ks(rr,3);
+	MultiSection ms2(ks,2);
+	vector<Cell*> cells2=ms2.split(root);
+	CPPUNIT_ASSERT(cells2.size()==9);
+	delete_cells(cells2);
+}
+
+void TestKSection::multi02() {
+	RoundRobin rr(0.6);
+	MultiSection ms(rr,3);
+	IntervalVector box(2);
+	box[0]=Interval(0,1);
+	box[1]=Interval(0,0.1);
+	Cell root(box);
+	ms.add_backtrackable(root);
+
+	// the two halves of x cannot be split anymore
+	vector<Cell*> cells=ms.split(root);
+	CPPUNIT_ASSERT(cells.size()==2);
+	CPPUNIT_ASSERT(cells[0]->box[1]==Interval(0,0.1));
+	CPPUNIT_ASSERT(cells[1]->box[1]==Interval(0,0.1));
+	delete_cells(cells);
+}
+
+void TestKSection::solver01() {
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	// with Newton, each solution is isolated in a small box
+	CtcHC4 hc4(*sys);
+	CtcNewton newton(sys->f);
+	CtcCompo ctc(hc4,newton);
+	RoundRobin rr(1e-3);
+	CellStack buff;
+	Solver solver(ctc,rr,buff);
+	vector<IntervalVector> sols=solver.solve(init_box);
+	CPPUNIT_ASSERT(!sols.empty());
+
+	KSection ks(rr,3);
+	MultiSection ms(rr,2);
+	Bsc* bsc[2] = { &ks, &ms };
+
+	for (int i=0; i<2; i++) {
+		CellStack buff2;
+		Solver solver2(ctc,*bsc[i],buff2);
+		vector<IntervalVector> sols2=solver2.solve(init_box);
+		CPPUNIT_ASSERT(sols2.size()==sols.size());
+		for (vector<IntervalVector>::iterator it=sols.begin(); it!=sols.end(); it++)
+			CPPUNIT_ASSERT(intersects(*it,sols2));
+		for (vector<IntervalVector>::iterator it=sols2.begin(); it!=sols2.end(); it++)
+			CPPUNIT_ASSERT(intersects(*it,sols));
+	}
+	delete sys;
+}
+
+} // end namespace ibex
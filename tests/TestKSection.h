@@ -0,0 +1,49 @@
+//============================================================================
+//                                  I B E X
+// File        : TestKSection.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_KSECTION_H__
+#define __TEST_KSECTION_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestKSection : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestKSection);
+
+		CPPUNIT_TEST(split01);
+		CPPUNIT_TEST(ksection01);
+		CPPUNIT_TEST(ksection02);
+		CPPUNIT_TEST(multi01);
+		CPPUNIT_TEST(multi02);
+		CPPUNIT_TEST(solver01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// default split: bisection
+	void split01();
+	// slices
+	void ksection01();
+	// slices larger than the precision
+	void ksection02();
+	// several variables
+	void multi01();
+	// subcells that cannot be split
+	void multi02();
+	// same solutions as with bisection
+	void solver01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestKSection);
+
+} // end namespace ibex
+#endif // __TEST_KSECTION_H__
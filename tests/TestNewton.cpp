@@ -13,6 +13,7 @@
 #include "ibex_Newton.h"
 #include "ibex_CtcNewton.h"
 #include "ibex_LinearException.h"
+#include "ibex_Cell.h"
 
 using namespace std;
 
@@ -133,4 +134,65 @@ void TestNewton::ctc_parameter01() {
 	CPPUNIT_ASSERT(box[0].diam()<=0.1);
 	CPPUNIT_ASSERT(box[1].diam()<=0.1);
 }
+
+void TestNewton::precond01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	Vector sol(2,(::sqrt(2)/2));
+
+	std::shared_ptr<const NewtonPrecond> pc;
+	IntervalVector box(2,Interval(0.6,0.8));
+	newton(f,box,pc);
+	CPPUNIT_ASSERT(pc);
+	CPPUNIT_ASSERT(box.contains(sol));
+	CPPUNIT_ASSERT(box.max_diam()<1e-10);
+
+	// the preconditioner is kept on a close box
+	std::shared_ptr<const NewtonPrecond> pc2(pc);
+	IntervalVector box2(2,Interval(0.7,0.72));
+	newton(f,box2,pc2);
+	CPPUNIT_ASSERT(pc2==pc);
+	CPPUNIT_ASSERT(box2.contains(sol));
+	CPPUNIT_ASSERT(box2.max_diam()<1e-10);
+
+	// with a ratio of 0, it is replaced
+	IntervalVector box3(2,Interval(0.7,0.72));
+	newton(f,box3,pc2,default_newton_prec,default_gauss_seidel_ratio,0);
+	CPPUNIT_ASSERT(pc2!=pc);
+	CPPUNIT_ASSERT(box3.contains(sol));
+	CPPUNIT_ASSERT(box3.max_diam()<1e-10);
+}
+
+void TestNewton::warm_start01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	Vector sol(2,(::sqrt(2)/2));
+
+	CtcNewton newton(f,POS_INFINITY);
+	newton.warm_start=true;
+
+	Cell* root=new Cell(IntervalVector(2,Interval(0.6,0.8)));
+	newton.add_backtrackable(*root);
+	((Ctc&) newton).contract(*root);
+	std::shared_ptr<const NewtonPrecond> pc=root->get<NewtonPrecondData>().pc;
+	CPPUNIT_ASSERT(pc);
+	CPPUNIT_ASSERT(root->box.contains(sol));
+
+	IntervalVector box(2,Interval(0.7,0.72));
+	std::pair<IntervalVector,IntervalVector> boxes=box.bisect(0,0.6);
+	std::pair<Cell*,Cell*> cells=root->bisect(boxes.first,boxes.second);
+	CPPUNIT_ASSERT(cells.first->get<NewtonPrecondData>().pc==pc);
+	CPPUNIT_ASSERT(cells.second->get<NewtonPrecondData>().pc==pc);
+
+	// the child that contains the solution
+	Cell* child=boxes.first.contains(sol) ? cells.first : cells.second;
+	((Ctc&) newton).contract(*child);
+	CPPUNIT_ASSERT(child->get<NewtonPrecondData>().pc==pc);
+	CPPUNIT_ASSERT(child->box.contains(sol));
+	CPPUNIT_ASSERT(child->box.max_diam()<1e-10);
+
+	delete cells.first;
+	delete cells.second;
+	delete root;
+}
 } // end namespace ibex
@@ -27,11 +27,15 @@ public:
 		CPPUNIT_TEST(newton01);
 		CPPUNIT_TEST(inflating_newton01);
 		CPPUNIT_TEST(ctc_parameter01);
+		CPPUNIT_TEST(precond01);
+		CPPUNIT_TEST(warm_start01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void newton01();
 	void inflating_newton01();
 	void ctc_parameter01();
+	void precond01();
+	void warm_start01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestNewton);
@@ -0,0 +1,102 @@
+//============================================================================
+//                                  I B E X
+// File        : TestParallelSolver.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestParallelSolver.h"
+#include "ibex_ParallelSolver.h"
+#include "ibex_Solver.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// each worker has its own copy of the system
+class HC4Factory : public ParallelSolver::Factory {
+public:
+	HC4Factory(const System& sys, int n) : sys(n), ctcs(n), bscs(n) {
+		for (int i=0; i<n; i++) {
+			this->sys[i]=new System(sys);
+			ctcs[i]=new CtcHC4(*this->sys[i]);
+			bscs[i]=new RoundRobin(1e-3);
+		}
+	}
+
+	~HC4Factory() {
+		for (unsigned int i=0; i<sys.size(); i++) {
+			delete bscs[i];
+			delete ctcs[i];
+			delete sys[i];
+		}
+	}
+
+	Ctc& ctc(int i) { return *ctcs[i]; }
+	Bsc& bsc(int i) { return *bscs[i]; }
+
+	vector<System*> sys;
+	vector<Ctc*> ctcs;
+	vector<Bsc*> bscs;
+};
+
+// number of occurrences of x in sols
+int count(const vector<IntervalVector>& sols, const IntervalVector& x) {
+	int n=0;
+	for (unsigned int i=0; i<sols.size(); i++)
+		if (sols[i]==x) n++;
+	return n;
+}
+
+}
+
+void TestParallelSolver::check_same(int nb_threads) {
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	CtcHC4 hc4(*sys);
+	RoundRobin rr(1e-3);
+	CellStack buff;
+	Solver solver(hc4,rr,buff);
+	vector<IntervalVector> sols=solver.solve(init_box);
+
+	HC4Factory factory(*sys,nb_threads);
+	ParallelSolver psolver(factory,nb_threads);
+	vector<IntervalVector> psols=psolver.solve(init_box);
+
+	CPPUNIT_ASSERT(psolver.nb_cells==solver.nb_cells);
+	CPPUNIT_ASSERT(psols.size()==sols.size());
+
+	// same solutions, up to ordering
+	for (unsigned int i=0; i<sols.size(); i++)
+		CPPUNIT_ASSERT(count(psols,sols[i])==count(sols,sols[i]));
+
+	delete sys;
+}
+
+void TestParallelSolver::same_as_solver01() {
+	check_same(1);
+}
+
+void TestParallelSolver::same_as_solver02() {
+	check_same(4);
+}
+
+void TestParallelSolver::cell_limit01() {
+	System* sys=cyclohexane();
+	HC4Factory factory(*sys,2);
+	ParallelSolver psolver(factory,2);
+	psolver.cell_limit=10;
+	psolver.solve(IntervalVector(3,Interval(-100,100)));
+	CPPUNIT_ASSERT(psolver.nb_cells>=10);
+	delete sys;
+}
+
+} // end namespace ibex
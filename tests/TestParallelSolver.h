@@ -0,0 +1,40 @@
+//============================================================================
+//                                  I B E X
+// File        : TestParallelSolver.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_PARALLEL_SOLVER_H__
+#define __TEST_PARALLEL_SOLVER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestParallelSolver : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestParallelSolver);
+
+		CPPUNIT_TEST(same_as_solver01);
+		CPPUNIT_TEST(same_as_solver02);
+		CPPUNIT_TEST(cell_limit01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void same_as_solver01();
+	void same_as_solver02();
+	void cell_limit01();
+
+private:
+	void check_same(int nb_threads);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestParallelSolver);
+
+} // end namespace ibex
+#endif // __TEST_PARALLEL_SOLVER_H__
@@ -0,0 +1,103 @@
+//============================================================================
+//                                  I B E X
+// File        : TestQInter.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestQInter.h"
+#include "ibex_QInter.h"
+
+#include <cstdlib>
+
+using namespace std;
+
+namespace ibex {
+
+void TestQInter::qinter01() {
+	vector<IntervalVector> v(6, IntervalVector(2));
+	v[0][0] = Interval(2, 29);  v[0][1] = Interval(6,13);
+	v[1][0] = Interval(5, 13);  v[1][1] = Interval(2,11);
+	v[2][0] = Interval(5, 15);  v[2][1] = Interval(16, 26);
+	v[3][0] = Interval(7, 25);  v[3][1] = Interval(8, 19);
+	v[4][0] = Interval(11, 20); v[4][1] = Interval(10, 22);
+	v[5][0] = Interval(17, 21); v[5][1] = Interval(11, 17);
+
+	Array<IntervalVector> boxes(v.size());
+	for (int i=0; i<v.size(); i++) boxes.set_ref(i,v[i]);
+
+	vector<IntervalVector> res(6, IntervalVector(2));
+	res[0][0] = Interval(2, 29);  res[0][1] = Interval(2, 26);
+	res[1][0] = Interval(5, 25);  res[1][1] = Interval(6, 22);
+	res[2][0] = Interval(7, 21);  res[2][1] = Interval(8, 19);
+	res[3][0] = Interval(11, 20); res[3][1] = Interval(10, 13);
+	res[4].set_empty();
+	res[5].set_empty();
+
+	for (int q=1; q<=6; q++)
+		CPPUNIT_ASSERT(qinter(boxes,q)==res[q-1]);
+}
+
+void TestQInter::qinter02() {
+	IntervalVector x1(1,Interval(0,4));
+	IntervalVector x2(1,Interval(1,5));
+	IntervalVector x3(1,Interval(3,8));
+	IntervalVector x4(1,Interval(6,7));
+	Array<IntervalVector> boxes(x1,x2,x3,x4);
+
+	CPPUNIT_ASSERT(qinter(boxes,1)==IntervalVector(1,Interval(0,8)));
+	CPPUNIT_ASSERT(qinter(boxes,2)==IntervalVector(1,Interval(1,7)));
+	CPPUNIT_ASSERT(qinter(boxes,3)==IntervalVector(1,Interval(3,4)));
+	CPPUNIT_ASSERT(qinter(boxes,4).is_empty());
+}
+
+// boxes that only touch each other
+void TestQInter::degenerated01() {
+	double _x1[][2] = {{0,1},{0,1}};
+	double _x2[][2] = {{1,2},{0,1}};
+	double _x3[][2] = {{1,2},{1,2}};
+	IntervalVector x1(2,_x1);
+	IntervalVector x2(2,_x2);
+	IntervalVector x3(2,_x3);
+	Array<IntervalVector> boxes(x1,x2,x3);
+
+	double _res2[][2] = {{1,2},{0,1}};
+	double _res3[][2] = {{1,1},{1,1}};
+	CPPUNIT_ASSERT(qinter(boxes,2)==IntervalVector(2,_res2));
+	CPPUNIT_ASSERT(qinter(boxes,3)==IntervalVector(2,_res3));
+}
+
+void TestQInter::empty01() {
+	IntervalVector x1(2,Interval(0,1));
+	IntervalVector x2(2);
+	x2.set_empty();
+	IntervalVector x3(2,Interval(0.5,2));
+	Array<IntervalVector> boxes(x1,x2,x3);
+
+	CPPUNIT_ASSERT(qinter(boxes,2)==IntervalVector(2,Interval(0.5,1)));
+	CPPUNIT_ASSERT(qinter(boxes,3).is_empty());
+}
+
+// compare with the grid algorithm on random boxes
+void TestQInter::grid01() {
+	srand(1);
+	for (int t=0; t<200; t++) {
+		int n=1+rand()%3;
+		int p=1+rand()%10;
+		int q=1+rand()%p;
+		vector<IntervalVector> v(p, IntervalVector(n));
+		Array<IntervalVector> boxes(p);
+		for (int j=0; j<p; j++) {
+			for (int i=0; i<n; i++) {
+				double a=10.0*rand()/RAND_MAX;
+				v[j][i]=Interval(a,a+5.0*rand()/RAND_MAX);
+			}
+			boxes.set_ref(j,v[j]);
+		}
+		CPPUNIT_ASSERT(qinter(boxes,q)==qinter_grid(boxes,q));
+	}
+}
+
+} // end namespace ibex
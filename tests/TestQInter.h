@@ -0,0 +1,41 @@
+//============================================================================
+//                                  I B E X
+// File        : TestQInter.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_QINTER_H__
+#define __TEST_QINTER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestQInter : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestQInter);
+
+		CPPUNIT_TEST(qinter01);
+		CPPUNIT_TEST(qinter02);
+		CPPUNIT_TEST(degenerated01);
+		CPPUNIT_TEST(empty01);
+		CPPUNIT_TEST(grid01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void qinter01();
+	void qinter02();
+	void degenerated01();
+	void empty01();
+	void grid01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestQInter);
+
+} // end namespace ibex
+#endif // __TEST_QINTER_H__
@@ -11,11 +11,40 @@
 #include "ibex_Set.h"
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
+#include "ibex_SetVisitor.h"
+#include "ibex_SepFwdBwd.h"
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// separator that separates the boxes one by one
+class SepOneByOne : public Sep {
+public:
+	SepOneByOne(Sep& sep) : Sep(sep.nb_var), sep(sep) { }
+
+	void separate(IntervalVector& x_in, IntervalVector& x_out) {
+		sep.separate(x_in,x_out);
+	}
+
+	Sep& sep;
+};
+
+class LeafList : public SetVisitor {
+public:
+	void visit_leaf(const IntervalVector& box, BoolInterval status) {
+		boxes.push_back(box);
+		status_list.push_back(status);
+	}
+
+	vector<IntervalVector> boxes;
+	vector<BoolInterval> status_list;
+};
+
+}
+
 
 void TestSet::diff01() {
 	IntervalVector x(2,Interval(0,1));
@@ -420,4 +449,39 @@ void TestSet::diff15() {
 	CPPUNIT_ASSERT(leaf->status==MAYBE);
 
 }
+void TestSet::sep_batch01() {
+
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+
+	Function f(x,y,sqr(x)+sqr(y)-1);
+	NumConstraint c(f,LEQ);
+	SepFwdBwd sep(c);
+
+	// the leaves of a frontier are separated at once
+	Set set1(2);
+	sep.contract(set1,0.1);
+
+	Set set2(2);
+	SepOneByOne sep2(sep);
+	sep2.contract(set2,0.1);
+
+	LeafList l1, l2;
+	set1.visit(l1);
+	set2.visit(l2);
+
+	CPPUNIT_ASSERT(l1.boxes.size()==l2.boxes.size());
+
+	int nb_yes=0;
+	int nb_no=0;
+	for (unsigned int i=0; i<l1.boxes.size(); i++) {
+		CPPUNIT_ASSERT(l1.boxes[i]==l2.boxes[i]);
+		CPPUNIT_ASSERT(l1.status_list[i]==l2.status_list[i]);
+		if (l1.status_list[i]==YES) nb_yes++;
+		if (l1.status_list[i]==NO) nb_no++;
+	}
+	CPPUNIT_ASSERT(nb_yes>0);
+	CPPUNIT_ASSERT(nb_no>0);
+}
+
 } // end namespace ibex
@@ -36,6 +36,7 @@ public:
 //		CPPUNIT_TEST(diff13);
 //		CPPUNIT_TEST(diff14);
 		CPPUNIT_TEST(diff15);
+		CPPUNIT_TEST(sep_batch01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void diff01();
@@ -54,6 +55,8 @@ public:
 	void diff14();
 	void diff15();
 
+	void sep_batch01();
+
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSet);
@@ -0,0 +1,109 @@
+//============================================================================
+//                                  I B E X
+// File        : TestSolver.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestSolver.h"
+#include "ibex_Solver.h"
+#include "ibex_CellStack.h"
+#include "ibex_CellFileBuffer.h"
+#include "ibex_CellDeltaStack.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_RoundRobin.h"
+
+#include <cstdio>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char* filename="checkpoint_solver.tmp";
+
+// Stop the search after "nb" solutions, write a checkpoint, and resume
+// the search with another solver. The solutions must be the same, in the
+// same order, as without interruption.
+void check_resume(CellBuffer& buff1, CellBuffer& buff2, CellBuffer& buff3, int nb) {
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	CtcHC4 hc4(*sys);
+	RoundRobin rr(1e-3);
+
+	Solver solver(hc4,rr,buff1);
+	vector<IntervalVector> sols=solver.solve(init_box);
+
+	Solver solver2(hc4,rr,buff2);
+	vector<IntervalVector> sols2;
+	solver2.start(init_box);
+	while ((int) sols2.size()<nb && solver2.next(sols2)) { }
+	solver2.checkpoint(filename,sols2);
+	int nb_cells2=solver2.nb_cells;
+	buff2.flush();
+
+	// build new objects, as in another process
+	CtcHC4 hc4_3(*sys);
+	RoundRobin rr3(1e-3);
+	Solver solver3(hc4_3,rr3,buff3);
+	vector<IntervalVector> sols3=solver3.resume(filename);
+	remove(filename);
+
+	CPPUNIT_ASSERT(nb_cells2<solver.nb_cells);
+	CPPUNIT_ASSERT(solver3.nb_cells==solver.nb_cells);
+	CPPUNIT_ASSERT(sols3.size()==sols.size());
+	for (unsigned int i=0; i<sols.size(); i++)
+		CPPUNIT_ASSERT(sols3[i]==sols[i]);
+
+	delete sys;
+}
+
+}
+
+void TestSolver::checkpoint01() {
+	CellStack buff1,buff2,buff3;
+	check_resume(buff1,buff2,buff3,10);
+}
+
+void TestSolver::checkpoint02() {
+	CellFileBuffer buff1(16),buff2(16),buff3(16);
+	check_resume(buff1,buff2,buff3,10);
+}
+
+void TestSolver::checkpoint03() {
+	System* sys=cyclohexane();
+	IntervalVector init_box(3,Interval(-100,100));
+
+	CtcHC4 hc4(*sys);
+	RoundRobin rr(1e-3);
+	CellStack buff;
+	Solver solver(hc4,rr,buff);
+	vector<IntervalVector> sols=solver.solve(init_box);
+
+	Solver solver2(hc4,rr,buff);
+	solver2.time_limit=1e-9;
+	solver2.checkpoint_file=filename;
+	vector<IntervalVector> sols2=solver2.solve(init_box);
+	CPPUNIT_ASSERT(sols2.size()<sols.size());
+	buff.flush();
+
+	Solver solver3(hc4,rr,buff);
+	vector<IntervalVector> sols3=solver3.resume(filename);
+	remove(filename);
+
+	CPPUNIT_ASSERT(solver3.nb_cells==solver.nb_cells);
+	CPPUNIT_ASSERT(sols3.size()==sols.size());
+
+	delete sys;
+}
+
+void TestSolver::checkpoint04() {
+	CellDeltaStack buff1,buff2,buff3;
+	check_resume(buff1,buff2,buff3,10);
+}
+
+} // end namespace ibex
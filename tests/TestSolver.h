@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : TestSolver.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_SOLVER_H__
+#define __TEST_SOLVER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestSolver : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestSolver);
+
+		CPPUNIT_TEST(checkpoint01);
+		CPPUNIT_TEST(checkpoint02);
+		CPPUNIT_TEST(checkpoint03);
+		CPPUNIT_TEST(checkpoint04);
+	CPPUNIT_TEST_SUITE_END();
+
+	// depth-first search
+	void checkpoint01();
+	// breadth-first search
+	void checkpoint02();
+	// automatic checkpoint on time out
+	void checkpoint03();
+	// depth-first search with delta-encoded boxes
+	void checkpoint04();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSolver);
+
+} // end namespace ibex
+#endif // __TEST_SOLVER_H__
@@ -0,0 +1,91 @@
+//============================================================================
+//                                  I B E X
+// File        : TestSpillFile.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestSpillFile.h"
+#include "ibex_SpillFile.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// pseudo-random numbers (the state of rand() is left unchanged)
+unsigned int next(unsigned int& seed) {
+	seed=seed*1103515245+12345;
+	return (seed/65536)%32768;
+}
+
+string block(int i, int size) {
+	string s(size,'\0');
+	for (int k=0; k<size; k++) s[k]=(char) (i+k);
+	return s;
+}
+
+}
+
+void TestSpillFile::block01() {
+	SpillFile file;
+	int b1=file.write(block(1,100));
+	int b2=file.write(block(2,200000)); // more than one chunk
+	CPPUNIT_ASSERT(file.size()==200100);
+
+	string s;
+	file.read(b1,s);
+	CPPUNIT_ASSERT(s==block(1,100));
+
+	ostringstream os;
+	file.copy(b2,os);
+	CPPUNIT_ASSERT(os.str()==block(2,200000));
+
+	file.erase(b1);
+	file.read(b2,s);
+	CPPUNIT_ASSERT(s==block(2,200000));
+
+	// the number of an erased block is reused
+	CPPUNIT_ASSERT(file.write(block(3,10))==b1);
+
+	file.erase(b1);
+	file.erase(b2);
+	CPPUNIT_ASSERT(file.size()==0);
+	CPPUNIT_ASSERT(file.file_size()==0);
+}
+
+// one block stays in the file while the others are written and erased
+void TestSpillFile::compact01() {
+	unsigned int seed=1;
+	SpillFile file;
+	int first=file.write(block(0,1000));
+
+	vector<int> b;
+	vector<int> id;
+	for (int k=0; k<1000; k++) {
+		if (b.empty() || next(seed)%2==0) {
+			b.push_back(file.write(block(k,1000+next(seed)%1000)));
+			id.push_back(k);
+		} else {
+			int i=next(seed)%b.size();
+			string s;
+			file.read(b[i],s);
+			CPPUNIT_ASSERT(s==block(id[i],s.size()));
+			file.erase(b[i]);
+			b.erase(b.begin()+i);
+			id.erase(id.begin()+i);
+		}
+		CPPUNIT_ASSERT(file.file_size()<=2*file.size()+2000);
+	}
+
+	string s;
+	file.read(first,s);
+	CPPUNIT_ASSERT(s==block(0,1000));
+}
+
+} // end namespace ibex
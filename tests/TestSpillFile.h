@@ -0,0 +1,35 @@
+//============================================================================
+//                                  I B E X
+// File        : TestSpillFile.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_SPILL_FILE_H__
+#define __TEST_SPILL_FILE_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestSpillFile : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestSpillFile);
+
+		CPPUNIT_TEST(block01);
+		CPPUNIT_TEST(compact01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void block01();
+	void compact01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSpillFile);
+
+} // end namespace ibex
+#endif // __TEST_SPILL_FILE_H__
@@ -10,6 +10,7 @@
  * ---------------------------------------------------------------------------- */
 
 #include "utils.h"
+#include "ibex_SystemFactory.h"
 #include <cppunit/TestAssert.h>
 #include <math.h>
 #include <sstream>
@@ -116,4 +117,14 @@ bool almost_eq(const IntervalMatrix& y_actual, const IntervalMatrix& y_expected,
 	return true;
 }
 
-
+System* cyclohexane() {
+	SystemFactory fac;
+	Variable x("x"),y("y"),z("z");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_var(z);
+	fac.add_ctr(sqr(y)*(1+sqr(z))+z*(z-24*y)=-13);
+	fac.add_ctr(sqr(x)*(1+sqr(y))+y*(y-24*x)=-13);
+	fac.add_ctr(sqr(z)*(1+sqr(x))+x*(x-24*z)=-13);
+	return new System(fac);
+}
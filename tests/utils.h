@@ -15,6 +15,7 @@
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
 #include "ibex_Expr.h"
+#include "ibex_System.h"
 
 using namespace ibex;
 
@@ -27,6 +28,10 @@ bool almost_eq(const Interval& y_actual, const Interval& y_expected, double err)
 bool almost_eq(const IntervalVector& y_actual, const IntervalVector& y_expected, double err);
 bool almost_eq(const IntervalMatrix& y_actual, const IntervalMatrix& y_expected, double err);
 
+// the cyclohexane problem (see benchs/cyclohexan3D.bch),
+// to be deleted by the caller
+System* cyclohexane();
+
 extern double ERROR;
 
 #endif // __UTILS_H__